@@ -287,6 +287,8 @@ do
         echo_log_eval $program a11c
         echo_log_eval $program simple_ad
         echo_log_eval $program team_example
+        echo_log_eval $program team_splice
+        echo_log_eval $program team_subgraph_jac
     fi
 done
 if [ "$program_list" != '' ]
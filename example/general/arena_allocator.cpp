@@ -0,0 +1,95 @@
+/* --------------------------------------------------------------------------
+CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-21 Bradley M. Bell
+
+CppAD is distributed under the terms of the
+             Eclipse Public License Version 2.0.
+
+This Source Code may also be made available under the following
+Secondary License when the conditions for such availability set forth
+in the Eclipse Public License, Version 2.0 are satisfied:
+      GNU General Public License, Version 2.0 or later.
+---------------------------------------------------------------------------- */
+
+/*
+$begin arena_allocator.cpp$$
+
+$section Recording Scope Arena Allocator: Example and Test$$
+
+$srcthisfile%0%// BEGIN C++%// END C++%1%$$
+
+$end
+*/
+// BEGIN C++
+
+# include <cppad/cppad.hpp>
+# include <list>
+
+bool arena_allocator(void)
+{   bool ok = true;
+    using CppAD::AD;
+    using CppAD::NearEqual;
+    using CppAD::thread_alloc;
+    typedef CppAD::arena_vector< AD<double> > ad_vector;
+    typedef std::list< ad_vector, CppAD::arena_allocator<ad_vector> > ad_list;
+    double eps99 = 99.0 * std::numeric_limits<double>::epsilon();
+
+    // memory currently in use by this thread
+    size_t thread = thread_alloc::thread_num();
+    size_t inuse  = thread_alloc::inuse(thread);
+    {
+        // start recording
+        size_t n = 3;
+        ad_vector ax(n);
+        for(size_t j = 0; j < n; ++j)
+            ax[j] = double(j + 1);
+        CppAD::Independent(ax);
+
+        // many short vectors of intermediate values
+        ad_list list;
+        for(size_t k = 0; k < 1000; ++k)
+        {   ad_vector au(n);
+            for(size_t j = 0; j < n; ++j)
+                au[j] = double(k) * ax[j];
+            list.push_back(au);
+        }
+
+        // vectors allocated one after the other are close together in memory
+        size_t chunk_bytes = CppAD::arena_allocator<double>::chunk_bytes();
+        ad_vector au(n), av(n);
+        const char* u_ptr = reinterpret_cast<const char*>( au.data() );
+        const char* v_ptr = reinterpret_cast<const char*>( av.data() );
+        ok &= u_ptr < v_ptr && size_t(v_ptr - u_ptr) < chunk_bytes;
+
+        // y = sum of the elements in the list
+        ad_vector ay(1);
+        ay[0] = 0.0;
+        for(const ad_vector& aw : list)
+        {   for(size_t j = 0; j < n; ++j)
+                ay[0] += aw[j];
+        }
+        CppAD::ADFun<double> f(ax, ay);
+
+        // the list can be used after the recording has ended
+        ok &= list.size() == 1000;
+        ok &= CppAD::Value( list.back()[2] ) == 999.0 * 3.0;
+
+        // check f(x) = (0 + 1 + ... + 999) * (x_0 + x_1 + x_2)
+        CPPAD_TESTVECTOR(double) x(n), y(1);
+        for(size_t j = 0; j < n; ++j)
+            x[j] = double(j);
+        y = f.Forward(0, x);
+        ok &= NearEqual(y[0], 999.0 * 1000.0 / 2.0 * 3.0, eps99, eps99);
+    }
+    // the arena was freed when the last vector that used it was destroyed
+    ok &= thread_alloc::inuse(thread) == inuse;
+    {
+        // memory allocated when not recording comes from thread_alloc
+        ad_vector aw(2);
+        ok &= thread_alloc::inuse(thread) > inuse;
+    }
+    ok &= thread_alloc::inuse(thread) == inuse;
+
+    return ok;
+}
+
+// END C++
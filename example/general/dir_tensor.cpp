@@ -0,0 +1,157 @@
+/* --------------------------------------------------------------------------
+CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-21 Bradley M. Bell
+
+CppAD is distributed under the terms of the
+             Eclipse Public License Version 2.0.
+
+This Source Code may also be made available under the following
+Secondary License when the conditions for such availability set forth
+in the Eclipse Public License, Version 2.0 are satisfied:
+      GNU General Public License, Version 2.0 or later.
+---------------------------------------------------------------------------- */
+
+/*
+$begin dir_tensor.cpp$$
+$spell
+    dir
+$$
+
+$section Higher Order Partials in a Subspace: Example and Test$$
+
+$srcthisfile%0%// BEGIN C++%// END C++%1%$$
+
+$end
+*/
+// BEGIN C++
+# include <cppad/cppad.hpp>
+namespace {
+    // derivative of order k of x^power
+    double d_pow(size_t k, double x, size_t power)
+    {   if( k > power )
+            return 0.0;
+        double result = 1.0;
+        for(size_t t = 0; t < k; ++t)
+            result *= double(power - t);
+        for(size_t t = k; t < power; ++t)
+            result *= x;
+        return result;
+    }
+    // derivative of order k of sin(x)
+    double d_sin(size_t k, double x)
+    {   switch( k % 4 )
+        {   case 0: return   std::sin(x);
+            case 1: return   std::cos(x);
+            case 2: return - std::sin(x);
+        }
+        return - std::cos(x);
+    }
+}
+bool dir_tensor(void)
+{   bool ok = true;
+    using CppAD::AD;
+    using CppAD::NearEqual;
+    double eps99 = 99.0 * std::numeric_limits<double>::epsilon();
+
+    // domain space vector
+    size_t n = 3;
+    CPPAD_TESTVECTOR(AD<double>) ax(n);
+    for(size_t j = 0; j < n; ++j)
+        ax[j] = double(j + 1);
+
+    // declare independent variables and start recording
+    CppAD::Independent(ax);
+
+    // range space vector
+    size_t m = 2;
+    CPPAD_TESTVECTOR(AD<double>) ay(m);
+    ay[0] = ax[0] * ax[0] * ax[1] + exp( ax[0] ) * ax[2];
+    ay[1] = sin( ax[1] ) * ax[2] * ax[2];
+
+    // create f : x -> y and stop recording
+    CppAD::ADFun<double> f(ax, ay);
+
+    // point at which to evaluate the partials
+    CPPAD_TESTVECTOR(double) x(n);
+    x[0] = 0.5;
+    x[1] = 1.5;
+    x[2] = 2.5;
+
+    // all partials of order one through three: S is the identity matrix
+    size_t p = 3;
+    size_t r = n;
+    CPPAD_TESTVECTOR(double) s(n * r), dy;
+    CPPAD_TESTVECTOR(size_t) index;
+    for(size_t j = 0; j < n; ++j)
+        for(size_t ell = 0; ell < r; ++ell)
+            s[j * r + ell] = double( j == ell );
+    f.dir_tensor(p, x, s, index, dy);
+
+    // number of multi-indices with order one through three
+    size_t K = 3 + 6 + 10;
+    ok &= index.size() == K * r;
+    ok &= dy.size() == m * K;
+    for(size_t k = 0; k < K; ++k)
+    {   size_t a = index[k * r + 0];
+        size_t b = index[k * r + 1];
+        size_t c = index[k * r + 2];
+        ok &= 1 <= a + b + c && a + b + c <= p;
+        //
+        // partial of y_0 = x_0^2 x_1 + exp(x_0) x_2
+        double check = 0.0;
+        if( c == 0 )
+            check += d_pow(a, x[0], 2) * d_pow(b, x[1], 1);
+        if( b == 0 )
+            check += std::exp( x[0] ) * d_pow(c, x[2], 1);
+        ok &= NearEqual(dy[0 * K + k], check, eps99, eps99);
+        //
+        // partial of y_1 = sin(x_1) x_2^2
+        check = 0.0;
+        if( a == 0 )
+            check = d_sin(b, x[1]) * d_pow(c, x[2], 2);
+        ok &= NearEqual(dy[1 * K + k], check, eps99, eps99);
+    }
+
+    // two directions that are not coordinate directions
+    p = 2;
+    r = 2;
+    s.resize(n * r);
+    for(size_t j = 0; j < n; ++j)
+    {   s[j * r + 0] = double(j + 1);
+        s[j * r + 1] = 1.0 / double(j + 1);
+    }
+    f.dir_tensor(p, x, s, index, dy);
+    K = 2 + 3;
+    ok &= index.size() == K * r;
+    ok &= dy.size() == m * K;
+
+    // compare with Jacobian and Hessian
+    CPPAD_TESTVECTOR(double) jac = f.Jacobian(x);
+    for(size_t i = 0; i < m; ++i)
+    {   CPPAD_TESTVECTOR(double) hes = f.Hessian(x, i);
+        for(size_t k = 0; k < K; ++k)
+        {   size_t a = index[k * r + 0];
+            size_t b = index[k * r + 1];
+            // the directions corresponding to this partial
+            size_t u = 0, v = 1;
+            if( a == 2 )
+                v = 0;
+            if( b == 2 )
+                u = 1;
+            double check = 0.0;
+            if( a + b == 1 )
+            {   for(size_t j = 0; j < n; ++j)
+                    check += jac[i * n + j] * s[j * r + b];
+            }
+            else
+            {   for(size_t j1 = 0; j1 < n; ++j1)
+                    for(size_t j2 = 0; j2 < n; ++j2)
+                        check += s[j1 * r + u]
+                               * hes[j1 * n + j2] * s[j2 * r + v];
+            }
+            ok &= NearEqual(dy[i * K + k], check, eps99, eps99);
+        }
+    }
+
+    return ok;
+}
+// END C++
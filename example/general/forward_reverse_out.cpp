@@ -0,0 +1,111 @@
+/* --------------------------------------------------------------------------
+CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-21 Bradley M. Bell
+
+CppAD is distributed under the terms of the
+             Eclipse Public License Version 2.0.
+
+This Source Code may also be made available under the following
+Secondary License when the conditions for such availability set forth
+in the Eclipse Public License, Version 2.0 are satisfied:
+      GNU General Public License, Version 2.0 or later.
+---------------------------------------------------------------------------- */
+
+/*
+$begin forward_reverse_out.cpp$$
+$spell
+    yq
+    dw
+$$
+
+$section Forward and Reverse Mode With Output Arguments: Example and Test$$
+
+$head Purpose$$
+This example shows that, after the first evaluation,
+$codei%f%.Forward(%q%, %xq%, %yq%)%$$ and
+$codei%f%.Reverse(%q%, %w%, %dw%)%$$ do not allocate any memory.
+
+$srcthisfile%0%// BEGIN C++%// END C++%1%$$
+
+$end
+*/
+// BEGIN C++
+
+# include <cppad/cppad.hpp>
+
+bool forward_reverse_out(void)
+{   bool ok = true;
+    using CppAD::AD;
+    using CppAD::NearEqual;
+    using CppAD::thread_alloc;
+    double eps99 = 99.0 * std::numeric_limits<double>::epsilon();
+
+    // f(x) = [ x_0 * x_1 , exp(x_0) * pow(x_1, 2.5) ]
+    size_t n = 2, m = 2;
+    CPPAD_TESTVECTOR(AD<double>) ax(n), ay(m);
+    ax[0] = 0.5;
+    ax[1] = 2.0;
+    CppAD::Independent(ax);
+    ay[0] = ax[0] * ax[1];
+    ay[1] = exp(ax[0]) * pow(ax[1], 2.5);
+    CppAD::ADFun<double> f(ax, ay);
+
+    // vectors used for the arguments and results
+    CPPAD_TESTVECTOR(double) x(n), dx(n), y(m), dy(m), w(m), dw(2 * n);
+    x[0]  = 0.5;
+    x[1]  = 2.0;
+    dx[0] = 1.0;
+    dx[1] = 0.0;
+    w[0]  = 1.0;
+    w[1]  = 1.0;
+
+    // The first evaluation may allocate memory; e.g., more Taylor coefficient
+    // orders and the reverse mode partial derivatives.
+    f.Forward(0, x, y);
+    f.Forward(1, dx, dy);
+    f.Reverse(2, w, dw);
+
+    // check the results against the versions that return the vectors
+    CPPAD_TESTVECTOR(double) check(m);
+    check = f.Forward(0, x);
+    for(size_t i = 0; i < m; ++i)
+        ok &= NearEqual(y[i], check[i], eps99, eps99);
+    check = f.Forward(1, dx);
+    for(size_t i = 0; i < m; ++i)
+        ok &= NearEqual(dy[i], check[i], eps99, eps99);
+    check = f.Reverse(2, w);
+    for(size_t j = 0; j < 2 * n; ++j)
+        ok &= NearEqual(dw[j], check[j], eps99, eps99);
+
+    // Hold memory that is returned so that we can detect any memory
+    // that was allocated and then returned during the evaluations below.
+    size_t thread = thread_alloc::thread_num();
+    thread_alloc::hold_memory(true);
+    thread_alloc::free_available(thread);
+    size_t inuse  = thread_alloc::inuse(thread);
+
+    // repeated evaluations
+    for(size_t count = 0; count < 10; ++count)
+    {   x[0] = 0.5 + double(count) / 10.0;
+        f.Forward(0, x, y);
+        f.Forward(1, dx, dy);
+        f.Reverse(2, w, dw);
+    }
+
+    // no memory was allocated
+    ok &= thread_alloc::inuse(thread) == inuse;
+    ok &= thread_alloc::available(thread) == 0;
+
+    // check the last evaluation;
+    // the partial of w^T f(x) w.r.t. x_0 is dw[0 * 2 + 0]
+    double x0  = x[0], x1 = x[1];
+    double d0  = x1 + exp(x0) * pow(x1, 2.5);
+    ok &= NearEqual(dw[0], d0, eps99, eps99);
+
+    // return thread_alloc to its default mode
+    thread_alloc::hold_memory(false);
+    thread_alloc::free_available(thread);
+
+    return ok;
+}
+
+// END C++
@@ -0,0 +1,92 @@
+/* --------------------------------------------------------------------------
+CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-21 Bradley M. Bell
+
+CppAD is distributed under the terms of the
+             Eclipse Public License Version 2.0.
+
+This Source Code may also be made available under the following
+Secondary License when the conditions for such availability set forth
+in the Eclipse Public License, Version 2.0 are satisfied:
+      GNU General Public License, Version 2.0 or later.
+---------------------------------------------------------------------------- */
+
+/*
+$begin fun_compress.cpp$$
+$spell
+$$
+
+$section Compress an ADFun Object: Example and Test$$
+
+$srcthisfile%0%// BEGIN C++%// END C++%1%$$
+
+$end
+*/
+// BEGIN C++
+
+# include <cppad/cppad.hpp>
+
+bool fun_compress(void)
+{   bool ok = true;
+    using CppAD::AD;
+    using CppAD::NearEqual;
+    double eps99 = 99.0 * std::numeric_limits<double>::epsilon();
+
+    // f(x) = sum_k x[k % n] * x[(k+1) % n] + CondExpLt(x[0], x[1], x[0], x[1])
+    size_t n = 5;
+    CPPAD_TESTVECTOR(AD<double>) ax(n), ay(1);
+    for(size_t j = 0; j < n; ++j)
+        ax[j] = double(j + 1);
+    CppAD::Independent(ax);
+    AD<double> asum = CppAD::CondExpLt(ax[0], ax[1], ax[0], ax[1]);
+    for(size_t k = 0; k < 100; ++k)
+        asum += ax[k % n] * ax[(k+1) % n];
+    ay[0] = asum;
+    CppAD::ADFun<double> f(ax, ay);
+
+    // derivative values before compression
+    CPPAD_TESTVECTOR(double) x(n), w(1), y(1), dw(n), check(n);
+    for(size_t j = 0; j < n; ++j)
+        x[j] = double(n - j);
+    w[0]  = 1.0;
+    y     = f.Forward(0, x);
+    check = f.Reverse(1, w);
+
+    // compress f
+    ok &= ! f.compressed();
+    size_t size_op_seq = f.size_op_seq();
+    f.compress();
+    ok &= f.compressed();
+    ok &= f.size_op_seq() < size_op_seq;
+    ok &= f.size_op_seq_decompressed() == size_op_seq;
+
+    // f can be used while it is compressed
+    CPPAD_TESTVECTOR(double) y_compress(1);
+    y_compress = f.Forward(0, x);
+    dw         = f.Reverse(1, w);
+    ok &= NearEqual(y_compress[0], y[0], eps99, eps99);
+    for(size_t j = 0; j < n; ++j)
+        ok &= NearEqual(dw[j], check[j], eps99, eps99);
+
+    // optimize uses random access and results in an uncompressed function
+    f.optimize();
+    ok &= ! f.compressed();
+    f.compress();
+    y_compress = f.Forward(0, x);
+    dw         = f.Reverse(1, w);
+    ok &= NearEqual(y_compress[0], y[0], eps99, eps99);
+    for(size_t j = 0; j < n; ++j)
+        ok &= NearEqual(dw[j], check[j], eps99, eps99);
+
+    // decompress f
+    size_op_seq = f.size_op_seq_decompressed();
+    f.decompress();
+    ok &= ! f.compressed();
+    ok &= f.size_op_seq() == size_op_seq;
+    dw = f.Reverse(1, w);
+    for(size_t j = 0; j < n; ++j)
+        ok &= NearEqual(dw[j], check[j], eps99, eps99);
+
+    return ok;
+}
+
+// END C++
@@ -139,6 +139,7 @@ bool fun_property(void)
     ok &= f.size_var()      == nvar;
     ok &= f.size_op()       == nop;
     ok &= f.size_op_arg()   == narg;
+    ok &= f.size_op_arg_byte() == sizeof(CPPAD_TAPE_ADDR_TYPE);
     ok &= f.size_par()      == npar;
     ok &= f.size_text()     == ntext;
     ok &= f.size_VecAD()    == nvecad;
@@ -149,7 +150,7 @@ bool fun_property(void)
     //
     size_t sum = 0;
     sum += nop        * sizeof(CPPAD_VEC_ENUM_TYPE);
-    sum += narg       * sizeof(CPPAD_TAPE_ADDR_TYPE);
+    sum += narg       * f.size_op_arg_byte();
     sum += npar       * sizeof(double);
     sum += npar       * sizeof(bool);
     sum += ndyn       * sizeof(CPPAD_VEC_ENUM_TYPE);
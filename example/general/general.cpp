@@ -102,6 +102,7 @@ extern bool ad_fun(void);
 extern bool ad_in_c(void);
 extern bool ad_input(void);
 extern bool ad_output(void);
+extern bool arena_allocator(void);
 extern bool asin(void);
 extern bool asinh(void);
 extern bool atan(void);
@@ -116,6 +117,7 @@ extern bool check_for_nan(void);
 extern bool compare_change(void);
 extern bool complex_poly(void);
 extern bool con_dyn_var(void);
+extern bool dir_tensor(void);
 extern bool eigen_array(void);
 extern bool eigen_det(void);
 extern bool erf(void);
@@ -125,32 +127,41 @@ extern bool expm1(void);
 extern bool fabs(void);
 extern bool forward_dir(void);
 extern bool forward_order(void);
+extern bool forward_reverse_out(void);
 extern bool fun_assign(void);
+extern bool fun_compress(void);
 extern bool fun_property(void);
 extern bool function_name(void);
+extern bool hes_dir(void);
+extern bool huge_page(void);
 extern bool interp_onetape(void);
 extern bool interp_retape(void);
 extern bool log(void);
 extern bool log10(void);
 extern bool log1p(void);
 extern bool lu_vec_ad_ok(void);
+extern bool memory_report(void);
 extern bool mul_level(void);
 extern bool mul_level_adolc(void);
 extern bool mul_level_adolc_ode(void);
 extern bool mul_level_ode(void);
 extern bool new_dynamic(void);
 extern bool num_limits(void);
+extern bool numa_interleave(void);
 extern bool number_skip(void);
 extern bool opt_val_hes(void);
+extern bool pack_arg(void);
 extern bool pow(void);
 extern bool pow_nan(void);
 extern bool print_for(void);
 extern bool rev_checkpoint(void);
+extern bool reverse_dir(void);
 extern bool reverse_one(void);
 extern bool reverse_three(void);
 extern bool reverse_two(void);
 extern bool sign(void);
 extern bool taylor_ode(void);
+extern bool value_and_gradient(void);
 extern bool vec_ad(void);
 // END_SORT_THIS_LINE_MINUS_1
 
@@ -219,6 +230,7 @@ int main(void)
     Run( ad_in_c,           "ad_in_c"          );
     Run( ad_input,          "ad_input"         );
     Run( ad_output,         "ad_output"        );
+    Run( arena_allocator,   "arena_allocator"  );
     Run( asin,              "asin"             );
     Run( asinh,             "asinh"            );
     Run( atan,              "atan"             );
@@ -232,6 +244,7 @@ int main(void)
     Run( compare_change,    "compare_change"   );
     Run( complex_poly,      "complex_poly"     );
     Run( con_dyn_var,       "con_dyn_var"      );
+    Run( dir_tensor,        "dir_tensor"       );
     Run( erf,               "erf"              );
     Run( erfc,              "erfc"             );
     Run( exp,               "exp"              );
@@ -239,29 +252,38 @@ int main(void)
     Run( fabs,              "fabs"             );
     Run( forward_dir,       "forward_dir"      );
     Run( forward_order,     "forward_order"    );
+    Run( forward_reverse_out, "forward_reverse_out" );
     Run( fun_assign,        "fun_assign"       );
+    Run( fun_compress,      "fun_compress"     );
     Run( fun_property,      "fun_property"     );
     Run( function_name,     "function_name"    );
+    Run( hes_dir,           "hes_dir"          );
+    Run( huge_page,         "huge_page"        );
     Run( interp_onetape,    "interp_onetape"   );
     Run( interp_retape,     "interp_retape"    );
     Run( log,               "log"              );
     Run( log10,             "log10"            );
     Run( log1p,             "log1p"            );
     Run( lu_vec_ad_ok,      "lu_vec_ad_ok"     );
+    Run( memory_report,     "memory_report"    );
     Run( mul_level,         "mul_level"        );
     Run( mul_level_ode,     "mul_level_ode"    );
     Run( new_dynamic,       "new_dynamic"      );
     Run( num_limits,        "num_limits"       );
+    Run( numa_interleave,   "numa_interleave"  );
     Run( number_skip,       "number_skip"      );
     Run( opt_val_hes,       "opt_val_hes"      );
+    Run( pack_arg,          "pack_arg"         );
     Run( pow,               "pow"              );
     Run( pow_nan,           "pow_nan"          );
     Run( rev_checkpoint,    "rev_checkpoint"   );
+    Run( reverse_dir,       "reverse_dir"      );
     Run( reverse_one,       "reverse_one"      );
     Run( reverse_three,     "reverse_three"    );
     Run( reverse_two,       "reverse_two"      );
     Run( sign,              "sign"             );
     Run( taylor_ode,        "ode_taylor"       );
+    Run( value_and_gradient, "value_and_gradient" );
     Run( vec_ad,            "vec_ad"           );
     // END_SORT_THIS_LINE_MINUS_1
 # ifndef CPPAD_DEBUG_AND_RELEASE
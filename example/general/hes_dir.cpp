@@ -0,0 +1,117 @@
+/* --------------------------------------------------------------------------
+CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-21 Bradley M. Bell
+
+CppAD is distributed under the terms of the
+             Eclipse Public License Version 2.0.
+
+This Source Code may also be made available under the following
+Secondary License when the conditions for such availability set forth
+in the Eclipse Public License, Version 2.0 are satisfied:
+      GNU General Public License, Version 2.0 or later.
+---------------------------------------------------------------------------- */
+
+/*
+$begin hes_dir.cpp$$
+$spell
+    dir
+$$
+
+$section Hessian Times Multiple Directions: Example and Test$$
+
+$srcthisfile%0%// BEGIN C++%// END C++%1%$$
+
+$end
+*/
+// BEGIN C++
+# include <cppad/cppad.hpp>
+bool hes_dir(void)
+{   bool ok = true;
+    using CppAD::AD;
+    using CppAD::NearEqual;
+    double eps99 = 99.0 * std::numeric_limits<double>::epsilon();
+
+    // domain space vector
+    size_t n = 3;
+    CPPAD_TESTVECTOR(AD<double>) ax(n);
+    for(size_t j = 0; j < n; ++j)
+        ax[j] = double(j + 1);
+
+    // declare independent variables and start recording
+    CppAD::Independent(ax);
+
+    // range space vector
+    size_t m = 2;
+    CPPAD_TESTVECTOR(AD<double>) ay(m);
+    ay[0] = ax[0] * ax[1] * ax[2];
+    ay[1] = sin( ax[0] ) + ax[1] / ax[2];
+
+    // create f : x -> y and stop recording
+    CppAD::ADFun<double> f(ax, ay);
+
+    // zero order forward mode at x
+    CPPAD_TESTVECTOR(double) x(n);
+    x[0] = 0.5;
+    x[1] = 1.5;
+    x[2] = 2.5;
+    f.Forward(0, x);
+
+    // weights for the components of f
+    CPPAD_TESTVECTOR(double) w(m);
+    w[0] = 2.0;
+    w[1] = 3.0;
+
+    // Hessian of w[0] * F_0 (x) + w[1] * F_1 (x)
+    double H[3][3];
+    H[0][0] = - w[1] * std::sin(x[0]);
+    H[0][1] = w[0] * x[2];
+    H[0][2] = w[0] * x[1];
+    H[1][1] = 0.0;
+    H[1][2] = w[0] * x[0] - w[1] / (x[2] * x[2]);
+    H[2][2] = 2.0 * w[1] * x[1] / (x[2] * x[2] * x[2]);
+    for(size_t i = 0; i < n; ++i)
+        for(size_t j = 0; j < i; ++j)
+            H[i][j] = H[j][i];
+
+    // the directions v^(ell) = e^(ell), ell = 0 , ... , r-1
+    size_t r = n;
+    CPPAD_TESTVECTOR(double) v(n * r), hv(n * r);
+    for(size_t j = 0; j < n; ++j)
+        for(size_t ell = 0; ell < r; ++ell)
+            v[j * r + ell] = double( j == ell );
+
+    // the memory used by f is reused by each call
+    for(size_t k = 0; k < 2; ++k)
+    {   // Hessian times all the directions
+        f.hes_dir(r, w, v, hv);
+
+        // hv[j * r + ell] is the j-th component of H * v^(ell)
+        for(size_t j = 0; j < n; ++j)
+        {   for(size_t ell = 0; ell < r; ++ell)
+            {   double check = 0.0;
+                for(size_t i = 0; i < n; ++i)
+                    check += H[j][i] * v[i * r + ell];
+                ok &= NearEqual(hv[j * r + ell], check, eps99, eps99);
+            }
+        }
+
+        // next set of directions
+        for(size_t j = 0; j < n; ++j)
+            for(size_t ell = 0; ell < r; ++ell)
+                v[j * r + ell] = double(j + 1) / double(ell + 2);
+    }
+
+    // same result as Forward(1, v_ell) followed by Reverse(2, w)
+    CPPAD_TESTVECTOR(double) v_ell(n), dw(2 * n);
+    f.hes_dir(r, w, v, hv);
+    for(size_t ell = 0; ell < r; ++ell)
+    {   for(size_t j = 0; j < n; ++j)
+            v_ell[j] = v[j * r + ell];
+        f.Forward(1, v_ell);
+        dw = f.Reverse(2, w);
+        for(size_t j = 0; j < n; ++j)
+            ok &= NearEqual(hv[j * r + ell], dw[j * 2 + 1], eps99, eps99);
+    }
+
+    return ok;
+}
+// END C++
@@ -0,0 +1,99 @@
+/* --------------------------------------------------------------------------
+CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-21 Bradley M. Bell
+
+CppAD is distributed under the terms of the
+             Eclipse Public License Version 2.0.
+
+This Source Code may also be made available under the following
+Secondary License when the conditions for such availability set forth
+in the Eclipse Public License, Version 2.0 are satisfied:
+      GNU General Public License, Version 2.0 or later.
+---------------------------------------------------------------------------- */
+
+/*
+$begin huge_page.cpp$$
+
+$section Huge Pages for an ADFun Object: Example and Test$$
+
+$srcthisfile%0%// BEGIN C++%// END C++%1%$$
+
+$end
+*/
+// BEGIN C++
+
+# include <cppad/cppad.hpp>
+
+bool huge_page(void)
+{   bool ok = true;
+    using CppAD::AD;
+    using CppAD::NearEqual;
+    using CppAD::thread_alloc;
+    double eps99 = 99.0 * std::numeric_limits<double>::epsilon();
+    size_t thread = thread_alloc::thread_num();
+
+    // Use huge pages for blocks that are at least 64 kilobytes
+    // (the default is two megabytes) so that this example is small.
+    size_t kilo = 1024;
+    thread_alloc::large_memory(64 * kilo, std::numeric_limits<size_t>::max());
+
+    // f(x) = sum_k x[k % n] * x[(k+1) % n]
+    size_t n = 5;
+    CPPAD_TESTVECTOR(AD<double>) ax(n), ay(1);
+    for(size_t j = 0; j < n; ++j)
+        ax[j] = double(j + 1);
+    CppAD::Independent(ax);
+    AD<double> asum = 0.0;
+    for(size_t k = 0; k < 20000; ++k)
+        asum += ax[k % n] * ax[(k+1) % n];
+    ay[0] = asum;
+    CppAD::ADFun<double> f(ax, ay);
+
+    // derivative values using the default allocation policy
+    CPPAD_TESTVECTOR(double) x(n), w(1), y(1), dw(n), check(n);
+    for(size_t j = 0; j < n; ++j)
+        x[j] = double(n - j);
+    w[0]  = 1.0;
+    y     = f.Forward(0, x);
+    check = f.Reverse(1, w);
+
+    // move the operation sequence and Taylor coefficients for f
+    // to memory that is advised to use huge pages
+    size_t huge_before = thread_alloc::huge(thread);
+    f.huge_page(true);
+
+    // on some systems, the large arrays are now advised to use huge pages
+    size_t huge_after = thread_alloc::huge(thread);
+    ok &= huge_before <= huge_after;
+    ok &= huge_after  <= thread_alloc::mapped(thread);
+
+    // results do not change
+    CPPAD_TESTVECTOR(double) y_huge(1);
+    y_huge = f.Forward(0, x);
+    dw     = f.Reverse(1, w);
+    ok &= NearEqual(y_huge[0], y[0], eps99, eps99);
+    for(size_t j = 0; j < n; ++j)
+        ok &= NearEqual(dw[j], check[j], eps99, eps99);
+
+    // the policy is kept when the Taylor coefficient capacity increases
+    // and by copies of f
+    CppAD::ADFun<double> g;
+    g = f;
+    CPPAD_TESTVECTOR(double) dx(n), dy(1);
+    for(size_t j = 0; j < n; ++j)
+        dx[j] = 0.0;
+    dx[0] = 1.0;
+    y  = g.Forward(0, x);
+    dy = g.Forward(1, dx);
+    ok &= NearEqual(y[0], y_huge[0], eps99, eps99);
+    ok &= NearEqual(dy[0], check[0], eps99, eps99);
+    ok &= thread_alloc::huge(thread) <= thread_alloc::mapped(thread);
+
+    // return thread_alloc to its default mode
+    thread_alloc::large_memory(
+        2 * kilo * kilo, std::numeric_limits<size_t>::max()
+    );
+
+    return ok;
+}
+
+// END C++
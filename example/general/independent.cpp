@@ -86,6 +86,17 @@ bool Test(void)
     ok &= NearEqual(dy[0] ,   1.,  eps99 , eps99);
     ok &= NearEqual(dy[1] , x[0],  eps99 , eps99);
 
+    // record g(x) = f(x) again using the size of f as a hint
+    CppAD::record_hint hint(f.size_op(), f.size_op_arg(), f.size_par());
+    CppAD::Independent(X, hint);
+    Y[0] = X[0] + X[1];
+    Y[1] = X[0] * X[1];
+    CppAD::ADFun<double> g(X, Y);
+    ok &= g.size_op() == f.size_op();
+    y    = g.Forward(0, x);
+    ok &= NearEqual(y[0] , 3.,  eps99 , eps99);
+    ok &= NearEqual(y[1] , 2.,  eps99 , eps99);
+
     return ok;
 }
 } // End of empty namespace -------------------------------------------
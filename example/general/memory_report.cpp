@@ -0,0 +1,106 @@
+/* --------------------------------------------------------------------------
+CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-21 Bradley M. Bell
+
+CppAD is distributed under the terms of the
+             Eclipse Public License Version 2.0.
+
+This Source Code may also be made available under the following
+Secondary License when the conditions for such availability set forth
+in the Eclipse Public License, Version 2.0 are satisfied:
+      GNU General Public License, Version 2.0 or later.
+---------------------------------------------------------------------------- */
+
+/*
+$begin memory_report.cpp$$
+$spell
+$$
+
+$section ADFun Memory Report and Registry: Example and Test$$
+
+$srcthisfile%0%// BEGIN C++%// END C++%1%$$
+
+$end
+*/
+// BEGIN C++
+
+# include <cppad/cppad.hpp>
+
+bool memory_report(void)
+{   bool ok = true;
+    using CppAD::AD;
+    using CppAD::fun_memory;
+    using CppAD::fun_registry;
+
+    // record ADFun objects constructed after this point
+    fun_registry::enable(true);
+    ok &= fun_registry::enabled();
+    ok &= fun_registry::list().size() == 0;
+
+    // f(x) = sum_j x[j] * x[j+1]
+    size_t n = 10;
+    CPPAD_TESTVECTOR(AD<double>) ax(n), ay(1);
+    for(size_t j = 0; j < n; ++j)
+        ax[j] = double(j + 1);
+    CppAD::Independent(ax);
+    ay[0] = 0.0;
+    for(size_t j = 0; j + 1 < n; ++j)
+        ay[0] += ax[j] * ax[j+1];
+    CppAD::ADFun<double> f(ax, ay);
+    f.function_name_set("f");
+
+    // the operation sequence is the only large component
+    fun_memory report = f.memory_report();
+    ok &= report.function_name == "f";
+    ok &= report.current.op_seq == f.size_op_seq();
+    ok &= report.current.dynamic == 0;
+    ok &= report.current.taylor >= f.size_var() * sizeof(double);
+    ok &= report.current.sparsity == 0;
+    size_t total = report.current.total;
+
+    // Taylor coefficients for orders zero, one, and two
+    CPPAD_TESTVECTOR(double) x(n), dx(n);
+    for(size_t j = 0; j < n; ++j)
+    {   x[j]  = double(n - j);
+        dx[j] = 0.0;
+    }
+    f.Forward(0, x);
+    f.Forward(1, dx);
+    f.Forward(2, dx);
+    report = f.memory_report();
+    ok &= report.current.taylor >= 3 * f.size_var() * sizeof(double);
+    ok &= total < report.current.total;
+
+    // free the Taylor coefficients, the high water mark remains
+    size_t taylor = report.current.taylor;
+    f.capacity_order(0);
+    report = f.memory_report();
+    ok &= report.current.taylor == 0;
+    ok &= report.high_water.taylor == taylor;
+    ok &= report.current.total < report.high_water.total;
+
+    // list the live ADFun objects
+    {   CppAD::ADFun<double> g;
+        g = f;
+        g.function_name_set("g");
+        std::vector<fun_memory> list = fun_registry::list();
+        ok &= list.size() == 2;
+        size_t n_found = 0;
+        for(size_t i = 0; i < list.size(); ++i)
+        {   if( list[i].function_name == "f" || list[i].function_name == "g" )
+            {   ++n_found;
+                ok &= list[i].current.op_seq == f.size_op_seq();
+            }
+        }
+        ok &= n_found == 2;
+    }
+    // g has been destroyed
+    ok &= fun_registry::list().size() == 1;
+
+    // disable and clear the registry
+    fun_registry::enable(false);
+    ok &= fun_registry::list().size() == 0;
+
+    return ok;
+}
+
+// END C++
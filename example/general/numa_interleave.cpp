@@ -0,0 +1,91 @@
+/* --------------------------------------------------------------------------
+CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-21 Bradley M. Bell
+
+CppAD is distributed under the terms of the
+             Eclipse Public License Version 2.0.
+
+This Source Code may also be made available under the following
+Secondary License when the conditions for such availability set forth
+in the Eclipse Public License, Version 2.0 are satisfied:
+      GNU General Public License, Version 2.0 or later.
+---------------------------------------------------------------------------- */
+
+/*
+$begin numa_interleave.cpp$$
+$spell
+    numa
+$$
+
+$section NUMA Placement of an ADFun Object: Example and Test$$
+
+$srcthisfile%0%// BEGIN C++%// END C++%1%$$
+
+$end
+*/
+// BEGIN C++
+
+# include <cppad/cppad.hpp>
+
+bool numa_interleave(void)
+{   bool ok = true;
+    using CppAD::AD;
+    using CppAD::NearEqual;
+    using CppAD::thread_alloc;
+    double eps99 = 99.0 * std::numeric_limits<double>::epsilon();
+
+    // Prefer the node for the allocating thread for blocks
+    // that are at least one page.
+    thread_alloc::numa_memory(true);
+
+    // f(x) = sum_k x[k % n] * x[(k+1) % n]
+    // (large enough so that the operation sequence is more than one page)
+    size_t n = 5;
+    CPPAD_TESTVECTOR(AD<double>) ax(n), ay(1);
+    for(size_t j = 0; j < n; ++j)
+        ax[j] = double(j + 1);
+    CppAD::Independent(ax);
+    AD<double> asum = 0.0;
+    for(size_t k = 0; k < 10000; ++k)
+        asum += ax[k % n] * ax[(k+1) % n];
+    ay[0] = asum;
+    CppAD::ADFun<double> f(ax, ay);
+
+    // derivative values before interleaving
+    CPPAD_TESTVECTOR(double) x(n), w(1), y(1), dw(n), check(n);
+    for(size_t j = 0; j < n; ++j)
+        x[j] = double(n - j);
+    w[0]  = 1.0;
+    y     = f.Forward(0, x);
+    check = f.Reverse(1, w);
+
+    // Spread the operation sequence across the NUMA nodes
+    // (num_bytes is zero if the system does not support NUMA policies).
+    size_t num_bytes = f.numa_interleave();
+    size_t thread    = thread_alloc::thread_num();
+    ok &= num_bytes <= thread_alloc::inuse(thread);
+
+    // results do not change
+    CPPAD_TESTVECTOR(double) y_interleave(1);
+    y_interleave = f.Forward(0, x);
+    dw           = f.Reverse(1, w);
+    ok &= NearEqual(y_interleave[0], y[0], eps99, eps99);
+    for(size_t j = 0; j < n; ++j)
+        ok &= NearEqual(dw[j], check[j], eps99, eps99);
+
+    // A copy of f for another thread should be made by that thread
+    // so that it is local to that thread's node.
+    CppAD::ADFun<double> g;
+    g  = f;
+    y  = g.Forward(0, x);
+    dw = g.Reverse(1, w);
+    ok &= NearEqual(y_interleave[0], y[0], eps99, eps99);
+    for(size_t j = 0; j < n; ++j)
+        ok &= NearEqual(dw[j], check[j], eps99, eps99);
+
+    // return thread_alloc to its default mode
+    thread_alloc::numa_memory(false);
+
+    return ok;
+}
+
+// END C++
@@ -0,0 +1,88 @@
+/* --------------------------------------------------------------------------
+CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-21 Bradley M. Bell
+
+CppAD is distributed under the terms of the
+             Eclipse Public License Version 2.0.
+
+This Source Code may also be made available under the following
+Secondary License when the conditions for such availability set forth
+in the Eclipse Public License, Version 2.0 are satisfied:
+      GNU General Public License, Version 2.0 or later.
+---------------------------------------------------------------------------- */
+
+/*
+$begin pack_arg.cpp$$
+
+$section Packing Operator Arguments: Example and Test$$
+
+$srcthisfile%0%// BEGIN C++%// END C++%1%$$
+
+$end
+*/
+// BEGIN C++
+
+# include <cppad/cppad.hpp>
+
+bool pack_arg(void)
+{   bool ok = true;
+    using CppAD::AD;
+    using CppAD::NearEqual;
+    double eps99 = 99.0 * std::numeric_limits<double>::epsilon();
+
+    // f(x) = sum_k x[k % n] * x[(k+1) % n]
+    size_t n = 5;
+    CPPAD_TESTVECTOR(AD<double>) ax(n), ay(1);
+    for(size_t j = 0; j < n; ++j)
+        ax[j] = double(j + 1);
+    CppAD::Independent(ax);
+    AD<double> asum = 0.0;
+    for(size_t k = 0; k < 100; ++k)
+        asum += ax[k % n] * ax[(k+1) % n];
+    ay[0] = asum;
+    CppAD::ADFun<double> f(ax, ay);
+
+    // by default, the arguments are stored using tape_addr_type
+    size_t addr_byte = sizeof(CPPAD_TAPE_ADDR_TYPE);
+    ok &= f.size_op_arg_byte() == addr_byte;
+
+    // derivative values using the default storage
+    CPPAD_TESTVECTOR(double) x(n), w(1), y(1), dw(n), check(n);
+    for(size_t j = 0; j < n; ++j)
+        x[j] = double(n - j);
+    w[0]  = 1.0;
+    y     = f.Forward(0, x);
+    check = f.Reverse(1, w);
+
+    // pack the arguments (all the indices are less than 2^16)
+    size_t size_op_seq = f.size_op_seq();
+    f.pack_arg(true);
+    size_t arg_byte = std::min(sizeof(unsigned short), addr_byte);
+    ok &= f.size_op_arg_byte() == arg_byte;
+    if( arg_byte < addr_byte )
+        ok &= f.size_op_seq() < size_op_seq;
+
+    // results do not change
+    CPPAD_TESTVECTOR(double) y_pack(1);
+    y_pack = f.Forward(0, x);
+    dw     = f.Reverse(1, w);
+    ok &= NearEqual(y_pack[0], y[0], eps99, eps99);
+    for(size_t j = 0; j < n; ++j)
+        ok &= NearEqual(dw[j], check[j], eps99, eps99);
+
+    // the policy is kept for a new operation sequence stored in f
+    f.optimize();
+    ok &= f.size_op_arg_byte() == arg_byte;
+    y_pack = f.Forward(0, x);
+    ok &= NearEqual(y_pack[0], y[0], eps99, eps99);
+
+    // undo the packing
+    f.pack_arg(false);
+    ok &= f.size_op_arg_byte() == addr_byte;
+    dw = f.Reverse(1, w);
+    for(size_t j = 0; j < n; ++j)
+        ok &= NearEqual(dw[j], check[j], eps99, eps99);
+
+    return ok;
+}
+
+// END C++
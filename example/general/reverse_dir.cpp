@@ -0,0 +1,92 @@
+/* --------------------------------------------------------------------------
+CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-21 Bradley M. Bell
+
+CppAD is distributed under the terms of the
+             Eclipse Public License Version 2.0.
+
+This Source Code may also be made available under the following
+Secondary License when the conditions for such availability set forth
+in the Eclipse Public License, Version 2.0 are satisfied:
+      GNU General Public License, Version 2.0 or later.
+---------------------------------------------------------------------------- */
+
+/*
+$begin reverse_dir.cpp$$
+$spell
+    Jacobian
+$$
+
+$section Reverse Mode With Multiple Weight Vectors: Example and Test$$
+
+$head Purpose$$
+This example computes the Jacobian of a function using one
+reverse sweep with a weight vector for each of the dependent variables.
+
+$srcthisfile%0%// BEGIN C++%// END C++%1%$$
+
+$end
+*/
+// BEGIN C++
+# include <cppad/cppad.hpp>
+bool reverse_dir(void)
+{   bool ok = true;
+    using CppAD::AD;
+    using CppAD::NearEqual;
+    double eps99 = 99.0 * std::numeric_limits<double>::epsilon();
+
+    // domain space vector
+    size_t n = 3;
+    CPPAD_TESTVECTOR(AD<double>) ax(n);
+    for(size_t j = 0; j < n; ++j)
+        ax[j] = double(j + 1);
+
+    // declare independent variables and start recording
+    CppAD::Independent(ax);
+
+    // range space vector
+    size_t m = 2;
+    CPPAD_TESTVECTOR(AD<double>) ay(m);
+    ay[0] = ax[0] * ax[1] * ax[2];
+    ay[1] = exp( ax[0] ) + ax[1] / ax[2];
+
+    // create f : x -> y and stop recording
+    CppAD::ADFun<double> f(ax, ay);
+
+    // zero order forward mode at x
+    CPPAD_TESTVECTOR(double) x(n);
+    x[0] = 0.5;
+    x[1] = 1.5;
+    x[2] = 2.5;
+    f.Forward(0, x);
+
+    // weight vectors w^(ell) = e^(ell), ell = 0 , ... , m-1
+    size_t r = m;
+    CPPAD_TESTVECTOR(double) w(m * r), dw(n * r);
+    for(size_t i = 0; i < m; ++i)
+        for(size_t ell = 0; ell < r; ++ell)
+            w[i * r + ell] = double( i == ell );
+
+    // one reverse sweep for all the weight vectors
+    dw = f.Reverse(1, r, w);
+
+    // dw[j * r + ell] is the partial of y[ell] w.r.t x[j]
+    ok &= NearEqual(dw[0 * r + 0], x[1] * x[2], eps99, eps99);
+    ok &= NearEqual(dw[1 * r + 0], x[0] * x[2], eps99, eps99);
+    ok &= NearEqual(dw[2 * r + 0], x[0] * x[1], eps99, eps99);
+    ok &= NearEqual(dw[0 * r + 1], std::exp(x[0]), eps99, eps99);
+    ok &= NearEqual(dw[1 * r + 1], 1.0 / x[2], eps99, eps99);
+    ok &= NearEqual(dw[2 * r + 1], - x[1] / (x[2] * x[2]), eps99, eps99);
+
+    // same result as one call to Reverse(1, w) for each weight vector
+    CPPAD_TESTVECTOR(double) w_one(m), dw_one(n);
+    for(size_t ell = 0; ell < r; ++ell)
+    {   for(size_t i = 0; i < m; ++i)
+            w_one[i] = w[i * r + ell];
+        dw_one = f.Reverse(1, w_one);
+        for(size_t j = 0; j < n; ++j)
+            ok &= NearEqual(dw[j * r + ell], dw_one[j], eps99, eps99);
+    }
+
+    return ok;
+}
+// END C++
@@ -0,0 +1,98 @@
+/* --------------------------------------------------------------------------
+CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-21 Bradley M. Bell
+
+CppAD is distributed under the terms of the
+             Eclipse Public License Version 2.0.
+
+This Source Code may also be made available under the following
+Secondary License when the conditions for such availability set forth
+in the Eclipse Public License, Version 2.0 are satisfied:
+      GNU General Public License, Version 2.0 or later.
+---------------------------------------------------------------------------- */
+
+/*
+$begin value_and_gradient.cpp$$
+
+$section Function Value and Gradient: Example and Test$$
+
+$srcthisfile%0%// BEGIN C++%// END C++%1%$$
+
+$end
+*/
+// BEGIN C++
+# include <cppad/cppad.hpp>
+bool value_and_gradient(void)
+{   bool ok = true;
+    using CppAD::AD;
+    using CppAD::NearEqual;
+    double eps99 = 99.0 * std::numeric_limits<double>::epsilon();
+
+    // domain space vector
+    size_t n = 3;
+    CPPAD_TESTVECTOR(AD<double>) ax(n);
+    for(size_t j = 0; j < n; ++j)
+        ax[j] = double(j + 1);
+
+    // declare independent variables and start recording
+    CppAD::Independent(ax);
+
+    // range space vector
+    size_t m = 2;
+    CPPAD_TESTVECTOR(AD<double>) ay(m);
+    ay[0] = ax[0] * ax[1] * ax[2];
+    ay[1] = exp( ax[0] ) + ax[1] / ax[2];
+
+    // create f : x -> y and stop recording
+    CppAD::ADFun<double> f(ax, ay);
+
+    // the results are returned in y and g, which must have the proper size
+    CPPAD_TESTVECTOR(double) x(n), w(m), y(m), g(n);
+    w[0] = 2.0;
+    w[1] = 3.0;
+
+    // the memory used by f is reused by each call
+    for(size_t k = 0; k < 3; ++k)
+    {   x[0] = 0.5 + double(k);
+        x[1] = 1.5;
+        x[2] = 2.5;
+        f.value_and_gradient(x, w, y, g);
+
+        // check function value
+        ok &= NearEqual(y[0], x[0] * x[1] * x[2], eps99, eps99);
+        ok &= NearEqual(y[1], std::exp(x[0]) + x[1] / x[2], eps99, eps99);
+
+        // check derivative of w[0] * F_0 (x) + w[1] * F_1 (x)
+        double check = w[0] * x[1] * x[2] + w[1] * std::exp(x[0]);
+        ok &= NearEqual(g[0], check, eps99, eps99);
+        check = w[0] * x[0] * x[2] + w[1] / x[2];
+        ok &= NearEqual(g[1], check, eps99, eps99);
+        check = w[0] * x[0] * x[1] - w[1] * x[1] / (x[2] * x[2]);
+        ok &= NearEqual(g[2], check, eps99, eps99);
+    }
+
+    // same result as Forward(0, x) followed by Reverse(1, w)
+    CPPAD_TESTVECTOR(double) y_check(m), g_check(n);
+    y_check = f.Forward(0, x);
+    g_check = f.Reverse(1, w);
+    for(size_t i = 0; i < m; ++i)
+        ok &= y[i] == y_check[i];
+    for(size_t j = 0; j < n; ++j)
+        ok &= g[j] == g_check[j];
+
+    // the zero order Taylor coefficients correspond to x
+    ok &= f.size_order() == 1;
+
+    // after using more Taylor coefficient directions
+    CPPAD_TESTVECTOR(double) x1(n * 2);
+    for(size_t j = 0; j < n * 2; ++j)
+        x1[j] = 1.0;
+    f.Forward(1, 2, x1);
+    x[0] = 0.25;
+    f.value_and_gradient(x, w, y, g);
+    ok &= NearEqual(y[0], x[0] * x[1] * x[2], eps99, eps99);
+    double check = w[0] * x[1] * x[2] + w[1] * std::exp(x[0]);
+    ok &= NearEqual(g[0], check, eps99, eps99);
+
+    return ok;
+}
+// END C++
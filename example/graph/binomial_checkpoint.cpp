@@ -0,0 +1,101 @@
+/* --------------------------------------------------------------------------
+CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-21 Bradley M. Bell
+
+CppAD is distributed under the terms of the
+             Eclipse Public License Version 2.0.
+
+This Source Code may also be made available under the following
+Secondary License when the conditions for such availability set forth
+in the Eclipse Public License, Version 2.0 are satisfied:
+      GNU General Public License, Version 2.0 or later.
+---------------------------------------------------------------------------- */
+
+/*
+$begin binomial_checkpoint.cpp$$
+$spell
+$$
+
+$section Binomial Checkpointing Reverse Mode: Example and Test$$
+
+$head Purpose$$
+This example uses a time stepping model where the state at each
+time depends on the state at the previous time.
+
+$srcthisfile%0%// BEGIN C++%// END C++%1%$$
+
+$end
+*/
+// BEGIN C++
+
+# include <cppad/cppad.hpp>
+
+bool binomial_checkpoint(void)
+{   bool ok = true;
+    using CppAD::AD;
+    using CppAD::NearEqual;
+    double eps99 = 99.0 * std::numeric_limits<double>::epsilon();
+    size_t abort_op_index = 0;
+    bool   record_compare = false;
+
+    // f(x; p) = state after n_step time steps starting at x
+    size_t n = 2, n_step = 50;
+    CPPAD_TESTVECTOR(AD<double>) ax(n), ap(1), ay(n);
+    ax[0] = 1.0;
+    ax[1] = 0.5;
+    ap[0] = 0.1;
+    CppAD::Independent(ax, abort_op_index, record_compare, ap);
+    ay = ax;
+    for(size_t k = 0; k < n_step; ++k)
+    {   AD<double> ay0 = ay[0];
+        ay[0] = ay[0] + ap[0] * ay[1];
+        ay[1] = ay[1] - ap[0] * sin( ay0 );
+    }
+    CppAD::ADFun<double> f(ax, ay);
+
+    // derivative using the entire operation sequence
+    CPPAD_TESTVECTOR(double) x(n), p(1), w(n), check(n);
+    x[0] = 0.5;
+    x[1] = 0.2;
+    p[0] = 0.05;
+    w[0] = 1.0;
+    w[1] = 2.0;
+    f.new_dynamic(p);
+    f.Forward(0, x);
+    check = f.Reverse(1, w);
+
+    // use 10 segments with 2 snapshots (not counting x)
+    size_t n_segment  = 10;
+    size_t n_snapshot = 2;
+    CppAD::binomial_checkpoint<double> rc(f, n_segment, n_snapshot);
+    ok &= rc.size_segment() == n_segment;
+    ok &= rc.max_segment_var() < f.size_var();
+
+    // derivative using binomial checkpointing
+    CPPAD_TESTVECTOR(double) dw(n);
+    rc.new_dynamic(p);
+    dw = rc.reverse(x, w);
+    for(size_t j = 0; j < n; ++j)
+        ok &= NearEqual(dw[j], check[j], eps99, eps99);
+
+    // some of the segments are recomputed
+    ok &= 2 * n_segment - 1 < rc.size_forward();
+
+    // with enough snapshots, no segment is recomputed
+    CppAD::binomial_checkpoint<double> rc_all(f, n_segment, n_segment);
+    rc_all.new_dynamic(p);
+    dw = rc_all.reverse(x, w);
+    for(size_t j = 0; j < n; ++j)
+        ok &= NearEqual(dw[j], check[j], eps99, eps99);
+    ok &= rc_all.size_forward() == 2 * n_segment - 1;
+
+    // store the segment boundary values in a file instead of memory
+    std::string file_name = "binomial_checkpoint.data";
+    dw = rc.reverse(x, w, file_name);
+    for(size_t j = 0; j < n; ++j)
+        ok &= NearEqual(dw[j], check[j], eps99, eps99);
+    ok &= rc.size_forward() == 2 * n_segment - 1;
+
+    return ok;
+}
+
+// END C++
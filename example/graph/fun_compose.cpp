@@ -0,0 +1,91 @@
+/* --------------------------------------------------------------------------
+CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-21 Bradley M. Bell
+
+CppAD is distributed under the terms of the
+             Eclipse Public License Version 2.0.
+
+This Source Code may also be made available under the following
+Secondary License when the conditions for such availability set forth
+in the Eclipse Public License, Version 2.0 are satisfied:
+      GNU General Public License, Version 2.0 or later.
+---------------------------------------------------------------------------- */
+
+/*
+$begin fun_compose.cpp$$
+$spell
+$$
+
+$section Compose Two ADFun Objects: Example and Test$$
+
+$srcthisfile%0%// BEGIN C++%// END C++%1%$$
+
+$end
+*/
+// BEGIN C++
+
+# include <cppad/cppad.hpp>
+
+bool fun_compose(void)
+{   bool ok = true;
+    using CppAD::AD;
+    using CppAD::NearEqual;
+    double eps99 = 99.0 * std::numeric_limits<double>::epsilon();
+    size_t abort_op_index = 0;
+    bool   record_compare = false;
+
+    // f(x; p) = [ p * x[0] * x[1], exp( x[1] ) + 2 ]
+    CPPAD_TESTVECTOR(AD<double>) ax(2), ap(1), au(2);
+    ax[0] = 1.0;
+    ax[1] = 2.0;
+    ap[0] = 3.0;
+    CppAD::Independent(ax, abort_op_index, record_compare, ap);
+    au[0] = ap[0] * ax[0] * ax[1];
+    au[1] = exp( ax[1] ) + 2.0;
+    CppAD::ADFun<double> f(ax, au);
+
+    // g(u; q) = [ sin( u[0] ) + q * u[1] ]
+    CPPAD_TESTVECTOR(AD<double>) aq(1), az(1);
+    aq[0] = 4.0;
+    CppAD::Independent(au, abort_op_index, record_compare, aq);
+    az[0] = sin( au[0] ) + aq[0] * au[1];
+    CppAD::ADFun<double> g(au, az);
+
+    // h(x; p, q) = g[ f(x; p); q ]
+    CppAD::ADFun<double> h;
+    h.compose(g, f);
+    ok &= h.Domain() == 2;
+    ok &= h.Range()  == 1;
+    ok &= h.size_dyn_ind() == 2;
+
+    // the dynamic parameters for f come before the ones for g
+    CPPAD_TESTVECTOR(double) x(2), pq(2), z(1);
+    x[0]  = 0.5;
+    x[1]  = 1.5;
+    pq[0] = 2.0;
+    pq[1] = 5.0;
+    h.new_dynamic(pq);
+    z = h.Forward(0, x);
+    double u0    = pq[0] * x[0] * x[1];
+    double u1    = std::exp( x[1] ) + 2.0;
+    double check = std::sin(u0) + pq[1] * u1;
+    ok &= NearEqual(z[0], check, eps99, eps99);
+
+    // derivative of h
+    CPPAD_TESTVECTOR(double) w(1), dw(2);
+    w[0] = 1.0;
+    dw   = h.Reverse(1, w);
+    check = std::cos(u0) * pq[0] * x[1];
+    ok &= NearEqual(dw[0], check, eps99, eps99);
+    check = std::cos(u0) * pq[0] * x[0] + pq[1] * std::exp( x[1] );
+    ok &= NearEqual(dw[1], check, eps99, eps99);
+
+    // optimize h and check that the value does not change
+    h.optimize();
+    z = h.Forward(0, x);
+    check = std::sin(u0) + pq[1] * u1;
+    ok &= NearEqual(z[0], check, eps99, eps99);
+
+    return ok;
+}
+
+// END C++
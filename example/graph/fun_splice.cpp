@@ -0,0 +1,116 @@
+/* --------------------------------------------------------------------------
+CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-21 Bradley M. Bell
+
+CppAD is distributed under the terms of the
+             Eclipse Public License Version 2.0.
+
+This Source Code may also be made available under the following
+Secondary License when the conditions for such availability set forth
+in the Eclipse Public License, Version 2.0 are satisfied:
+      GNU General Public License, Version 2.0 or later.
+---------------------------------------------------------------------------- */
+
+/*
+$begin fun_splice.cpp$$
+$spell
+    Vec
+$$
+
+$section Splice Blocks Into an ADFun Object: Example and Test$$
+
+$head Parallel Recording$$
+The blocks in this example are recorded sequentially.
+See $cref team_splice.cpp$$ for an example that records
+the blocks in parallel using a different thread for each block.
+
+$srcthisfile%0%// BEGIN C++%// END C++%1%$$
+
+$end
+*/
+// BEGIN C++
+
+# include <cppad/cppad.hpp>
+
+namespace {
+    // record g_k(x; p) = [ p * x[k] * x[k+1] , (k + 1) * sin( x[k] ) ]
+    // where x[k] < x[k+1]
+    void record_block(size_t k, size_t n, CppAD::ADFun<double>& g)
+    {   using CppAD::AD;
+        CPPAD_TESTVECTOR(AD<double>) ax(n), ap(1), ay(2);
+        for(size_t j = 0; j < n; ++j)
+            ax[j] = double(j);
+        ap[0] = 1.0;
+        size_t abort_op_index = 0;
+        bool   record_compare = false;
+        CppAD::Independent(ax, abort_op_index, record_compare, ap);
+        //
+        // VecAD vector v = [ x[k], x[k+1] ] with variable indices
+        CppAD::VecAD<double> av(2);
+        AD<double> azero = ax[k] - ax[k];
+        AD<double> aone  = azero + 1.0;
+        av[azero] = ax[k];
+        av[aone]  = ax[k+1];
+        ay[0] = ap[0] * av[azero] * av[aone];
+        //
+        // conditional expression that is true when x[k] < x[k+1]
+        AD<double> asin = double(k + 1) * sin( ax[k] );
+        AD<double> acos = double(k + 1) * cos( ax[k] );
+        ay[1] = CppAD::CondExpLt(ax[k], ax[k+1], asin, acos);
+        //
+        g.Dependent(ax, ay);
+        //
+        // optimize the block (its conditional skips are not spliced)
+        g.optimize();
+    }
+}
+
+bool fun_splice(void)
+{   bool ok = true;
+    using CppAD::NearEqual;
+    double eps99 = 99.0 * std::numeric_limits<double>::epsilon();
+
+    // record the blocks
+    size_t n       = 4;
+    size_t n_block = n - 1;
+    std::vector< CppAD::ADFun<double> > block(n_block);
+    for(size_t k = 0; k < n_block; ++k)
+        record_block(k, n, block[k]);
+
+    // splice the blocks into f
+    CppAD::ADFun<double> f;
+    f.splice(block);
+    ok &= f.Domain() == n;
+    ok &= f.Range()  == 2 * n_block;
+    ok &= f.size_dyn_ind() == 1;
+
+    // check zero order forward
+    CPPAD_TESTVECTOR(double) x(n), p(1), y(2 * n_block);
+    for(size_t j = 0; j < n; ++j)
+        x[j] = double(j + 2);
+    p[0] = 3.0;
+    f.new_dynamic(p);
+    y = f.Forward(0, x);
+    for(size_t k = 0; k < n_block; ++k)
+    {   double check = p[0] * x[k] * x[k+1];
+        ok &= NearEqual(y[2 * k], check, eps99, eps99);
+        check = double(k + 1) * std::sin( x[k] );
+        ok &= NearEqual(y[2 * k + 1], check, eps99, eps99);
+    }
+
+    // check the derivative of the last component
+    CPPAD_TESTVECTOR(double) w(2 * n_block), dw(n);
+    for(size_t i = 0; i < 2 * n_block; ++i)
+        w[i] = 0.0;
+    w[2 * n_block - 1] = 1.0;
+    dw = f.Reverse(1, w);
+    for(size_t j = 0; j < n; ++j)
+    {   double check = 0.0;
+        if( j == n_block - 1 )
+            check = double(n_block) * std::cos( x[j] );
+        ok &= NearEqual(dw[j], check, eps99, eps99);
+    }
+
+    return ok;
+}
+
+// END C++
@@ -30,10 +30,13 @@ in the Eclipse Public License, Version 2.0 are satisfied:
 extern bool add_op(void);
 extern bool atom_op(void);
 extern bool azmul_op(void);
+extern bool binomial_checkpoint(void);
 extern bool cexp_op(void);
 extern bool comp_op(void);
 extern bool discrete_op(void);
 extern bool div_op(void);
+extern bool fun_compose(void);
+extern bool fun_splice(void);
 extern bool mul_op(void);
 extern bool pow_op(void);
 extern bool print_graph(void);
@@ -57,10 +60,13 @@ int main(void)
     Run( add_op,               "add_op"          );
     Run( atom_op,              "atom_op"         );
     Run( azmul_op,             "azmul_op"        );
+    Run( binomial_checkpoint,  "binomial_checkpoint" );
     Run( cexp_op,              "cexp_op"         );
     Run( comp_op,              "comp_op"         );
     Run( div_op,               "div_op"          );
     Run( discrete_op,          "discrete_op"     );
+    Run( fun_compose,          "fun_compose"     );
+    Run( fun_splice,           "fun_splice"      );
     Run( mul_op,               "mul_op"          );
     Run( pow_op,               "pow_op"          );
     Run( print_graph,          "print_graph"     );
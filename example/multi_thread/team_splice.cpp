@@ -0,0 +1,159 @@
+/* --------------------------------------------------------------------------
+CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-21 Bradley M. Bell
+
+CppAD is distributed under the terms of the
+             Eclipse Public License Version 2.0.
+
+This Source Code may also be made available under the following
+Secondary License when the conditions for such availability set forth
+in the Eclipse Public License, Version 2.0 are satisfied:
+      GNU General Public License, Version 2.0 or later.
+---------------------------------------------------------------------------- */
+
+/*
+$begin team_splice.cpp$$
+$spell
+    CppAD
+$$
+
+$section Recording Blocks Using a Team of Threads: Example and Test$$
+
+$head Purpose$$
+This example records the blocks of a function in parallel,
+using a different thread for each block,
+and then uses $cref/splice/fun_splice/$$ to combine the blocks
+into one function.
+
+$head Function$$
+The function has $icode n$$ independent variables and
+$icode%n%-1%$$ blocks.
+Block $icode k$$, which is recorded by thread $icode k$$, is
+$latex \[
+    g_k (x) = ( k + 1 ) x_k x_{k+1}
+\] $$
+
+$head thread_team$$
+The following three implementations of the
+$cref team_thread.hpp$$ specifications are included:
+$table
+$rref team_openmp.cpp$$
+$rref team_bthread.cpp$$
+$rref team_pthread.cpp$$
+$tend
+
+$head Source Code$$
+$srcthisfile%0%// BEGIN C++%// END C++%1%$$
+
+$end
+------------------------------------------------------------------------------
+*/
+// BEGIN C++
+# include <cppad/cppad.hpp>
+# include "team_thread.hpp"
+# define NUMBER_THREADS  4
+
+namespace {
+    using CppAD::thread_alloc;
+
+    // number of independent variables
+    const size_t n_ = NUMBER_THREADS + 1;
+
+    // block recorded by each thread
+    // (allocated by the master thread in sequential mode)
+    CppAD::ADFun<double>* block_ = nullptr;
+
+    // false if an error occurs in a thread, true otherwise
+    bool ok_all_[NUMBER_THREADS];
+    // --------------------------------------------------------------------
+    // function that records the block for one thread
+    void worker(void)
+    {   using CppAD::AD;
+        size_t k = thread_alloc::thread_num();
+
+        // CppAD::vector uses the CppAD fast multi-threading allocator
+        CppAD::vector< AD<double> > ax(n_), ay(1);
+        for(size_t j = 0; j < n_; ++j)
+            ax[j] = double(j);
+        Independent(ax);
+        ay[0] = double(k + 1) * ax[k] * ax[k+1];
+        block_[k].Dependent(ax, ay);
+
+        // this thread is done
+        ok_all_[k] = block_[k].Range() == 1;
+    }
+}
+
+// This test routine is only called by the master thread (thread_num = 0).
+bool team_splice(void)
+{   bool ok = true;
+    using CppAD::NearEqual;
+    double eps99 = 99.0 * std::numeric_limits<double>::epsilon();
+
+    size_t num_threads = NUMBER_THREADS;
+
+    // Check that no memory is in use or avialable at start
+    // (using thread_alloc in sequential mode)
+    size_t thread_num;
+    for(thread_num = 0; thread_num < num_threads; thread_num++)
+    {   ok &= thread_alloc::inuse(thread_num) == 0;
+        ok &= thread_alloc::available(thread_num) == 0;
+        ok_all_[thread_num] = false;
+    }
+
+    // all the memory used by f and the blocks is freed at end of this scope
+    {
+        // record the blocks in parallel
+        CppAD::vector< CppAD::ADFun<double> > block(num_threads);
+        block_ = block.data();
+        ok &= team_create(num_threads);
+        ok &= team_work(worker);
+        ok &= team_destroy();
+        for(thread_num = 0; thread_num < num_threads; thread_num++)
+            ok &= ok_all_[thread_num];
+
+        // splice the blocks into f
+        CppAD::ADFun<double> f;
+        f.splice(block);
+        ok &= f.Domain() == n_;
+        ok &= f.Range()  == num_threads;
+
+        // the blocks are no longer needed
+        block.clear();
+        block_ = nullptr;
+
+        // check zero order forward
+        CppAD::vector<double> x(n_), y(num_threads);
+        for(size_t j = 0; j < n_; ++j)
+            x[j] = double(j + 2);
+        y = f.Forward(0, x);
+        for(size_t k = 0; k < num_threads; ++k)
+        {   double check = double(k + 1) * x[k] * x[k+1];
+            ok &= NearEqual(y[k], check, eps99, eps99);
+        }
+
+        // check the derivative of the sum of the blocks
+        CppAD::vector<double> w(num_threads), dw(n_);
+        for(size_t k = 0; k < num_threads; ++k)
+            w[k] = 1.0;
+        dw = f.Reverse(1, w);
+        for(size_t j = 0; j < n_; ++j)
+        {   double check = 0.0;
+            if( j < num_threads )
+                check += double(j + 1) * x[j+1];
+            if( 0 < j )
+                check += double(j) * x[j-1];
+            ok &= NearEqual(dw[j], check, eps99, eps99);
+        }
+    }
+
+    // go down so that free memrory for other threads before memory for master
+    thread_num = num_threads;
+    while(thread_num--)
+    {   // check that there is no longer any memory inuse by this thread
+        ok &= thread_alloc::inuse(thread_num) == 0;
+        // return all memory being held for future use by this thread
+        thread_alloc::free_available(thread_num);
+    }
+    return ok;
+}
+// END C++
@@ -0,0 +1,184 @@
+/* --------------------------------------------------------------------------
+CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-21 Bradley M. Bell
+
+CppAD is distributed under the terms of the
+             Eclipse Public License Version 2.0.
+
+This Source Code may also be made available under the following
+Secondary License when the conditions for such availability set forth
+in the Eclipse Public License, Version 2.0 are satisfied:
+      GNU General Public License, Version 2.0 or later.
+---------------------------------------------------------------------------- */
+
+/*
+$begin team_subgraph_jac.cpp$$
+$spell
+    CppAD
+    jac
+    Jacobian
+$$
+
+$section Subgraph Jacobian Using a Team of Threads: Example and Test$$
+
+$head Purpose$$
+This example divides the rows of a sparse Jacobian between threads using
+the $cref/parallel mode/subgraph_jac_rev/Parallel Mode/$$ syntax
+for $code subgraph_jac_rev$$.
+The result is compared with the sequential syntax.
+
+$head Function$$
+The function has $icode m$$ components and $icode%n% = %m%+1%$$
+independent variables where
+$latex \[
+    f_i (x) = ( i + 1 ) x_i x_{i+1}
+\] $$
+The subset of the Jacobian that is computed includes the non-zero
+elements and the structurally zero element in column $icode%i%+2%$$
+of row $icode i$$ (when $icode%i%+2 < %n%$$).
+
+$head thread_team$$
+The following three implementations of the
+$cref team_thread.hpp$$ specifications are included:
+$table
+$rref team_openmp.cpp$$
+$rref team_bthread.cpp$$
+$rref team_pthread.cpp$$
+$tend
+
+$head Source Code$$
+$srcthisfile%0%// BEGIN C++%// END C++%1%$$
+
+$end
+------------------------------------------------------------------------------
+*/
+// BEGIN C++
+# include <cppad/cppad.hpp>
+# include "team_thread.hpp"
+# define NUMBER_THREADS  4
+
+namespace {
+    using CppAD::thread_alloc;
+    typedef CppAD::vector<size_t>                        s_vector;
+    typedef CppAD::vector<double>                        d_vector;
+    typedef CppAD::sparse_rcv<s_vector, d_vector>        sparse_matrix;
+
+    // function object (recorded by the master thread in sequential mode)
+    CppAD::ADFun<double>* f_      = nullptr;
+
+    // subset of Jacobian that is computed by the threads
+    sparse_matrix*        subset_ = nullptr;
+
+    // false if an error occurs in a thread, true otherwise
+    bool ok_all_[NUMBER_THREADS];
+    // --------------------------------------------------------------------
+    // function that computes this thread's rows of the Jacobian
+    void worker(void)
+    {   size_t thread_num = thread_alloc::thread_num();
+
+        // work space for this thread
+        CppAD::subgraph_work<double> work;
+        f_->subgraph_jac_rev(*subset_, work);
+
+        // this thread is done
+        ok_all_[thread_num] = true;
+    }
+}
+
+// This test routine is only called by the master thread (thread_num = 0).
+bool team_subgraph_jac(void)
+{   bool ok = true;
+    using CppAD::AD;
+    using CppAD::NearEqual;
+    double eps99 = 99.0 * std::numeric_limits<double>::epsilon();
+
+    size_t num_threads = NUMBER_THREADS;
+
+    // Check that no memory is in use or avialable at start
+    // (using thread_alloc in sequential mode)
+    size_t thread_num;
+    for(thread_num = 0; thread_num < num_threads; thread_num++)
+    {   ok &= thread_alloc::inuse(thread_num) == 0;
+        ok &= thread_alloc::available(thread_num) == 0;
+        ok_all_[thread_num] = false;
+    }
+
+    // setup for using CppAD in parallel mode
+    ok &= team_create(num_threads);
+
+    // all the memory used by f and subset is freed at end of this scope
+    {
+        // record f
+        size_t m = 2 * num_threads + 1;
+        size_t n = m + 1;
+        CppAD::vector< AD<double> > ax(n), ay(m);
+        for(size_t j = 0; j < n; ++j)
+            ax[j] = double(j);
+        Independent(ax);
+        for(size_t i = 0; i < m; ++i)
+            ay[i] = double(i + 1) * ax[i] * ax[i+1];
+        CppAD::ADFun<double> f(ax, ay);
+
+        // subset of the Jacobian
+        size_t nnz = 3 * m - 1;
+        CppAD::sparse_rc<s_vector> pattern(m, n, nnz);
+        size_t k = 0;
+        for(size_t i = 0; i < m; ++i)
+        {   for(size_t j = i; j < i + 3 && j < n; ++j)
+                pattern.set(k++, i, j);
+        }
+        ok &= k == nnz;
+        sparse_matrix subset(pattern), check(pattern);
+
+        // sequential calculation
+        d_vector x(n);
+        for(size_t j = 0; j < n; ++j)
+            x[j] = double(j + 2);
+        f.subgraph_jac_rev(x, check);
+
+        // setup that must be done in sequential mode
+        CppAD::vector<bool> select_domain(n);
+        for(size_t j = 0; j < n; ++j)
+            select_domain[j] = true;
+        f.Forward(0, x);
+        f.subgraph_reverse(select_domain);
+
+        // compute the rows of the Jacobian in parallel
+        f_      = &f;
+        subset_ = &subset;
+        ok &= team_work(worker);
+        for(thread_num = 0; thread_num < num_threads; thread_num++)
+            ok &= ok_all_[thread_num];
+        f_      = nullptr;
+        subset_ = nullptr;
+
+        // check the result
+        const s_vector& row( subset.row() );
+        const s_vector& col( subset.col() );
+        const d_vector& val( subset.val() );
+        for(k = 0; k < nnz; ++k)
+        {   size_t i = row[k];
+            size_t j = col[k];
+            double value = 0.0;
+            if( j == i )
+                value = double(i + 1) * x[i+1];
+            if( j == i + 1 )
+                value = double(i + 1) * x[i];
+            ok &= NearEqual(val[k], value, eps99, eps99);
+            ok &= NearEqual(val[k], check.val()[k], eps99, eps99);
+        }
+    }
+
+    // done using CppAD in parallel mode
+    ok &= team_destroy();
+
+    // go down so that free memrory for other threads before memory for master
+    thread_num = num_threads;
+    while(thread_num--)
+    {   // check that there is no longer any memory inuse by this thread
+        ok &= thread_alloc::inuse(thread_num) == 0;
+        // return all memory being held for future use by this thread
+        thread_alloc::free_available(thread_num);
+    }
+    return ok;
+}
+// END C++
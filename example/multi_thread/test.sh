@@ -95,5 +95,9 @@ do
         echo
         echo_eval ./$program team_example
         echo
+        echo_eval ./$program team_splice
+        echo
+        echo_eval ./$program team_subgraph_jac
+        echo
     fi
 done
@@ -22,6 +22,7 @@ $spell
     openmp
     bthread
     chkpoint
+    jac
 $$
 
 
@@ -62,6 +63,8 @@ $codei%.
 ./%program% a11c
 ./%program% simple_ad
 ./%program% team_example
+./%program% team_splice
+./%program% team_subgraph_jac
 ./%program% harmonic     %test_time% %max_threads% %mega_sum%
 ./%program% atomic_two   %test_time% %max_threads% %num_solve%
 ./%program% atomic_three %test_time% %max_threads% %num_solve%
@@ -83,6 +86,8 @@ $children%
     example/multi_thread/pthread/simple_ad_pthread.cpp%
 
     example/multi_thread/team_example.cpp%
+    example/multi_thread/team_splice.cpp%
+    example/multi_thread/team_subgraph_jac.cpp%
     example/multi_thread/harmonic.omh%
     example/multi_thread/multi_atomic_three.omh%
     example/multi_thread/multi_chkpoint_two.omh%
@@ -116,6 +121,18 @@ $cref team_example.cpp$$ example.
 This case demonstrates simple multi-threading with algorithmic differentiation
 and using a $cref/team of threads/team_thread.hpp/$$.
 
+$head team_splice$$
+The $icode test_case$$ $code team_splice$$ runs the
+$cref team_splice.cpp$$ example.
+This case records the blocks of a function using a team of threads
+and then splices the blocks into one function.
+
+$head team_subgraph_jac$$
+The $icode test_case$$ $code team_subgraph_jac$$ runs the
+$cref team_subgraph_jac.cpp$$ example.
+This case divides the rows of a sparse Jacobian between
+a team of threads.
+
 $head test_time$$
 All of the other cases include the $icode test_time$$ argument.
 This is the minimum amount of wall clock time that the test should take.
@@ -223,6 +240,8 @@ $end
 # include <ctime>
 # include "team_thread.hpp"
 # include "team_example.hpp"
+# include "team_splice.hpp"
+# include "team_subgraph_jac.hpp"
 # include "harmonic.hpp"
 # include "multi_atomic_two.hpp"
 # include "multi_atomic_three.hpp"
@@ -269,6 +288,8 @@ int main(int argc, char *argv[])
     "./<program> a11c\n"
     "./<program> simple_ad\n"
     "./<program> team_example\n"
+    "./<program> team_splice\n"
+    "./<program> team_subgraph_jac\n"
     "./<program> harmonic     test_time max_threads mega_sum\n"
     "./<program> atomic_two   test_time max_threads num_solve\n"
     "./<program> atomic_three test_time max_threads num_solve\n"
@@ -312,13 +333,18 @@ int main(int argc, char *argv[])
     bool run_a11c         = std::strcmp(test_name, "a11c")             == 0;
     bool run_simple_ad    = std::strcmp(test_name, "simple_ad")        == 0;
     bool run_team_example = std::strcmp(test_name, "team_example")     == 0;
+    bool run_team_splice  = std::strcmp(test_name, "team_splice")      == 0;
+    bool run_team_subgraph_jac =
+        std::strcmp(test_name, "team_subgraph_jac") == 0;
     bool run_harmonic     = std::strcmp(test_name, "harmonic")         == 0;
     bool run_atomic_two   = std::strcmp(test_name, "atomic_two")       == 0;
     bool run_atomic_three = std::strcmp(test_name, "atomic_three")     == 0;
     bool run_chkpoint_one = std::strcmp(test_name, "chkpoint_one")     == 0;
     bool run_chkpoint_two = std::strcmp(test_name, "chkpoint_two")     == 0;
     bool run_multi_newton = std::strcmp(test_name, "multi_newton")     == 0;
-    if( run_a11c || run_simple_ad || run_team_example )
+    bool run_no_arg = run_a11c || run_simple_ad || run_team_example;
+    run_no_arg     |= run_team_splice || run_team_subgraph_jac;
+    if( run_no_arg )
         ok = (argc == 2);
     else if( run_harmonic
     || run_atomic_two
@@ -334,13 +360,17 @@ int main(int argc, char *argv[])
         std::cerr << usage << endl;
         exit(1);
     }
-    if( run_a11c || run_simple_ad || run_team_example )
+    if( run_no_arg )
     {   if( run_a11c )
             ok        = a11c();
         else if( run_simple_ad )
             ok        = simple_ad();
-        else
+        else if( run_team_example )
             ok        = team_example();
+        else if( run_team_splice )
+            ok        = team_splice();
+        else
+            ok        = team_subgraph_jac();
         if( thread_alloc::free_all() )
             cout << "free_all      = true;"  << endl;
         else
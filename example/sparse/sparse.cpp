@@ -49,6 +49,7 @@ extern bool sparse_jac_for(void);
 extern bool sparse_jac_rev(void);
 extern bool sparse_jacobian(void);
 extern bool sparse_sub_hes(void);
+extern bool sparse_ter(void);
 extern bool sparsity_sub(void);
 extern bool sub_sparse_hes(void);
 extern bool subgraph_hes2jac(void);
@@ -84,6 +85,7 @@ int main(void)
     Run( sparse_jac_rev,            "sparse_jac_rev" );
     Run( sparse_jacobian,           "sparse_jacobian" );
     Run( sparse_sub_hes,            "sparse_sub_hes" );
+    Run( sparse_ter,                "sparse_ter" );
     Run( sparsity_sub,              "sparsity_sub" );
     Run( sub_sparse_hes,            "sub_sparse_hes" );
     Run( subgraph_hes2jac,          "subgraph_hes2jac" );
@@ -0,0 +1,142 @@
+/* --------------------------------------------------------------------------
+CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-21 Bradley M. Bell
+
+CppAD is distributed under the terms of the
+             Eclipse Public License Version 2.0.
+
+This Source Code may also be made available under the following
+Secondary License when the conditions for such availability set forth
+in the Eclipse Public License, Version 2.0 are satisfied:
+      GNU General Public License, Version 2.0 or later.
+---------------------------------------------------------------------------- */
+
+/*
+$begin sparse_ter.cpp$$
+$spell
+    Cpp
+    ter
+$$
+
+$section Computing Sparse Third Order Tensor: Example and Test$$
+
+
+$srcthisfile%0%// BEGIN C++%// END C++%1%$$
+
+$end
+*/
+// BEGIN C++
+# include <cppad/cppad.hpp>
+bool sparse_ter(void)
+{   bool ok = true;
+    using CppAD::AD;
+    using CppAD::NearEqual;
+    double eps99 = 99.0 * std::numeric_limits<double>::epsilon();
+    //
+    typedef CPPAD_TESTVECTOR(AD<double>)               a_vector;
+    typedef CPPAD_TESTVECTOR(double)                   d_vector;
+    typedef CPPAD_TESTVECTOR(size_t)                   s_vector;
+    typedef CPPAD_TESTVECTOR(bool)                     b_vector;
+    //
+    // domain space vector
+    size_t n = 10;
+    a_vector a_x(n);
+    for(size_t j = 0; j < n; j++)
+        a_x[j] = AD<double> (0);
+    //
+    // declare independent variables and starting recording
+    CppAD::Independent(a_x);
+    //
+    // range space vector
+    size_t m = 1;
+    a_vector a_y(m);
+    a_y[0] = 0.0;
+    for(size_t j = 0; j < n; j++)
+    {   a_y[0] += exp( a_x[j] );
+        if( j + 1 < n )
+            a_y[0] += a_x[j] * a_x[j] * a_x[j+1];
+    }
+    //
+    // create f: x -> y and stop tape recording
+    CppAD::ADFun<double> f(a_x, a_y);
+    //
+    // value of the tensor T_{i,j,k}, stored as T[ i * n * n + j * n + k ]
+    d_vector x(n), w(m), check(n * n * n);
+    for(size_t j = 0; j < n; j++)
+        x[j] = double(j + 1) / double(n);
+    w[0] = 1.0;
+    for(size_t ijk = 0; ijk < n * n * n; ijk++)
+        check[ijk] = 0.0;
+    for(size_t j = 0; j < n; j++)
+    {   check[ j * n * n + j * n + j ] = std::exp( x[j] );
+        if( j + 1 < n )
+        {   check[ j * n * n + j * n + j+1 ] = 2.0;
+            check[ j * n * n + (j+1) * n + j ] = 2.0;
+            check[ (j+1) * n * n + j * n + j ] = 2.0;
+        }
+    }
+    //
+    // compute the third order sparsity pattern
+    b_vector select_range(m);
+    select_range[0]    = true;
+    bool internal_bool = false;
+    CppAD::sparse_rc<s_vector> pattern;
+    f.for_ter_sparsity(x, select_range, internal_bool, pattern);
+    //
+    // check the pattern
+    size_t nnz = pattern.nnz();
+    ok &= pattern.nr() == n;
+    ok &= pattern.nc() == n * n;
+    ok &= nnz == n + 3 * (n - 1);
+    for(size_t k = 0; k < nnz; k++)
+    {   size_t ijk = pattern.row()[k] * n * n + pattern.col()[k];
+        ok &= check[ijk] != 0.0;
+    }
+    //
+    // compute the elements with i <= j <= k
+    size_t K = 0;
+    for(size_t k = 0; k < nnz; k++)
+    {   size_t i = pattern.row()[k];
+        size_t j = pattern.col()[k] / n;
+        size_t ell = pattern.col()[k] % n;
+        if( i <= j && j <= ell )
+            ++K;
+    }
+    CppAD::sparse_rc<s_vector> lower(n, n * n, K);
+    K = 0;
+    for(size_t k = 0; k < nnz; k++)
+    {   size_t i = pattern.row()[k];
+        size_t j = pattern.col()[k] / n;
+        size_t ell = pattern.col()[k] % n;
+        if( i <= j && j <= ell )
+            lower.set(K++, i, pattern.col()[k]);
+    }
+    CppAD::sparse_rcv<s_vector, d_vector> subset( lower );
+    CppAD::sparse_ter_work work;
+    size_t n_sweep = f.sparse_ter(x, w, subset, pattern, work);
+    //
+    // check result
+    const d_vector& val( subset.val() );
+    for(size_t k = 0; k < K; k++)
+    {   size_t ijk = subset.row()[k] * n * n + subset.col()[k];
+        ok &= NearEqual(val[k], check[ijk], eps99, eps99);
+    }
+    //
+    // The indices j-1, j, j+1 must have different colors, so there
+    // are three colors and all six color pairs are used.
+    ok &= n_sweep == 6;
+    //
+    // use work to compute the tensor at a different point
+    for(size_t j = 0; j < n; j++)
+    {   x[j] = double(n - j) / double(n);
+        check[ j * n * n + j * n + j ] = std::exp( x[j] );
+    }
+    n_sweep = f.sparse_ter(x, w, subset, pattern, work);
+    for(size_t k = 0; k < K; k++)
+    {   size_t ijk = subset.row()[k] * n * n + subset.col()[k];
+        ok &= NearEqual(val[k], check[ijk], eps99, eps99);
+    }
+    ok &= n_sweep == 6;
+    //
+    return ok;
+}
+// END C++
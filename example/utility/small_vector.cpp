@@ -0,0 +1,87 @@
+/* --------------------------------------------------------------------------
+CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-21 Bradley M. Bell
+
+CppAD is distributed under the terms of the
+             Eclipse Public License Version 2.0.
+
+This Source Code may also be made available under the following
+Secondary License when the conditions for such availability set forth
+in the Eclipse Public License, Version 2.0 are satisfied:
+      GNU General Public License, Version 2.0 or later.
+---------------------------------------------------------------------------- */
+
+/*
+$begin small_vector.cpp$$
+
+$section small_vector Template Class: Example and Test$$
+
+$srcthisfile%0%// BEGIN C++%// END C++%1%$$
+
+$end
+*/
+// BEGIN C++
+
+# include <cppad/utility/small_vector.hpp>
+# include <cppad/utility/check_simple_vector.hpp>
+# include <cppad/utility/thread_alloc.hpp>
+# include <cstdint>
+# include <sstream>
+# include <string>
+
+bool small_vector(void)
+{   bool ok = true;
+    using CppAD::small_vector;
+    using CppAD::thread_alloc;
+    typedef small_vector<double, 3> vector3;
+
+    // check that small_vector is a SimpleVector class with double elements
+    CppAD::CheckSimpleVector< double, vector3 >();
+
+    // memory currently in use by this thread
+    size_t thread = thread_alloc::thread_num();
+    size_t inuse  = thread_alloc::inuse(thread);
+
+    // vectors with three or fewer elements do not allocate memory
+    vector3 x(3), y;
+    for(size_t i = 0; i < x.size(); ++i)
+        x[i] = double(i);
+    y = x;
+    y.push_back(3.0);        // y now has four elements
+    ok &= x.is_inline();
+    ok &= ! y.is_inline();
+    ok &= thread_alloc::inuse(thread) > inuse;
+
+    // the heap memory is aligned to 64 bytes
+    std::uintptr_t address = reinterpret_cast<std::uintptr_t>( y.data() );
+    ok &= address % 64 == 0;
+
+    // the first elements are not changed by push_back
+    for(size_t i = 0; i < y.size(); ++i)
+        ok &= y[i] == double(i);
+
+    // decreasing the size does not return the memory
+    y.resize(2);
+    ok &= ! y.is_inline();
+    ok &= y.capacity() >= 4;
+
+    // moving y to z does not copy the elements
+    const double* ptr = y.data();
+    vector3 z( std::move(y) );
+    ok &= z.data() == ptr;
+    ok &= z.size() == 2;
+    ok &= y.size() == 0 && y.is_inline();
+
+    // output operator
+    std::stringstream stream;
+    stream << z;
+    ok &= stream.str() == "{ 0, 1 }";
+
+    // clear returns the memory to thread_alloc
+    z.clear();
+    ok &= z.is_inline();
+    ok &= thread_alloc::inuse(thread) == inuse;
+
+    return ok;
+}
+
+// END C++
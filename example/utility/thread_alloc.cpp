@@ -1,5 +1,5 @@
 /* --------------------------------------------------------------------------
-CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-20 Bradley M. Bell
+CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-21 Bradley M. Bell
 
 CppAD is distributed under the terms of the
              Eclipse Public License Version 2.0.
@@ -157,6 +157,174 @@ bool type_allocate(void)
     return ok;
 }
 
+bool aligned_allocate(void)
+{   bool ok = true;
+    using CppAD::thread_alloc;
+    size_t thread = thread_alloc::thread_num();
+
+    // check that no memory is initilaly inuse
+    ok &= thread_alloc::free_all();
+
+    // Use aligned mode with large blocks starting at one megabyte and
+    // hold at most two megabytes of large blocks as available.
+    size_t mega = 1024 * 1024;
+    thread_alloc::aligned_memory(true);
+    thread_alloc::large_memory(mega, 2 * mega);
+
+    // allocate some small blocks
+    size_t request[] = { 1, 65, 1000, 1100, 5000 };
+    size_t n_request = sizeof(request) / sizeof(request[0]);
+    std::vector<void*> v_ptr(n_request);
+    size_t sum_request = 0;
+    size_t sum_cap     = 0;
+    for(size_t k = 0; k < n_request; k++)
+    {   size_t cap_bytes = 0; // set here to avoid MSC warning
+        v_ptr[k] = thread_alloc::get_memory(request[k], cap_bytes);
+        //
+        // memory is aligned for SIMD instructions
+        ok &= reinterpret_cast<size_t>(v_ptr[k]) % 64 == 0;
+        //
+        // waste is less than 64 bytes or 25 percent
+        ok &= request[k] <= cap_bytes;
+        ok &= cap_bytes < request[k] + 64 || 4 * cap_bytes <= 5 * request[k];
+        //
+        sum_request += request[k];
+        sum_cap     += cap_bytes;
+    }
+    ok &= thread_alloc::inuse(thread)     == sum_cap;
+    ok &= thread_alloc::requested(thread) == sum_request;
+
+    // allocate two large blocks
+    size_t cap_one, cap_two;
+    void* v_one = thread_alloc::get_memory(3 * mega / 2, cap_one);
+    void* v_two = thread_alloc::get_memory(3 * mega, cap_two);
+    ok &= reinterpret_cast<size_t>(v_one) % 64 == 0;
+    ok &= reinterpret_cast<size_t>(v_two) % 64 == 0;
+    //
+    // check that the large blocks can be used
+    unsigned char* c_one = reinterpret_cast<unsigned char*>(v_one);
+    unsigned char* c_two = reinterpret_cast<unsigned char*>(v_two);
+    for(size_t i = 0; i < cap_one; i++)
+        c_one[i] = static_cast<unsigned char>(i);
+    for(size_t i = 0; i < cap_two; i++)
+        c_two[i] = static_cast<unsigned char>(i);
+    ok &= c_one[cap_one - 1] == static_cast<unsigned char>(cap_one - 1);
+    ok &= c_two[cap_two - 1] == static_cast<unsigned char>(cap_two - 1);
+    //
+    // large blocks are obtained using mmap on some systems
+    size_t mapped = thread_alloc::mapped(thread);
+    ok &= mapped == 0 || cap_one + cap_two <= mapped;
+
+    // return the large blocks; the second one is above the watermark
+    thread_alloc::return_memory(v_one);
+    thread_alloc::return_memory(v_two);
+    ok &= thread_alloc::mapped(thread) <= 2 * mega;
+
+    // return the small blocks
+    for(size_t k = 0; k < n_request; k++)
+        thread_alloc::return_memory(v_ptr[k]);
+    ok &= thread_alloc::inuse(thread)     == 0;
+    ok &= thread_alloc::requested(thread) == 0;
+
+    // return to the default mode and free the available memory
+    thread_alloc::aligned_memory(false);
+    thread_alloc::large_memory(2 * mega, std::numeric_limits<size_t>::max());
+    ok &= thread_alloc::free_all();
+    ok &= thread_alloc::mapped(thread) == 0;
+
+    return ok;
+}
+
+bool huge_allocate(void)
+{   bool ok = true;
+    using CppAD::thread_alloc;
+    size_t thread = thread_alloc::thread_num();
+
+    // check that no memory is initilaly inuse
+    ok &= thread_alloc::free_all();
+
+    // get one large block in aligned mode without changing the mode
+    size_t mega = 1024 * 1024;
+    size_t cap_bytes;
+    void* v_ptr = thread_alloc::get_huge_memory(5 * mega, cap_bytes);
+    ok &= 5 * mega <= cap_bytes;
+    ok &= reinterpret_cast<size_t>(v_ptr) % 64 == 0;
+    //
+    // on some systems, the block is advised to use huge pages
+    size_t huge = thread_alloc::huge(thread);
+    ok &= huge == 0 || cap_bytes <= huge;
+    ok &= huge <= thread_alloc::mapped(thread);
+
+    // return the block and free the available memory
+    thread_alloc::return_memory(v_ptr);
+    ok &= thread_alloc::free_all();
+    ok &= thread_alloc::huge(thread) == 0;
+
+    return ok;
+}
+
+bool trim_allocate(void)
+{   bool ok = true;
+    using CppAD::thread_alloc;
+    size_t thread = thread_alloc::thread_num();
+
+    // check that no memory is initilaly inuse
+    ok &= thread_alloc::free_all();
+
+    // get and return blocks with three different capacities
+    size_t cap_small, cap_medium, cap_large;
+    void* v_small  = thread_alloc::get_memory(100, cap_small);
+    void* v_medium = thread_alloc::get_memory(1000, cap_medium);
+    void* v_large  = thread_alloc::get_memory(10000, cap_large);
+    thread_alloc::return_memory(v_small);
+    thread_alloc::return_memory(v_large);
+    thread_alloc::return_memory(v_medium);
+    size_t available = cap_small + cap_medium + cap_large;
+    ok &= thread_alloc::available(thread) == available;
+
+    // the least recently used capacity is returned to the system first
+    size_t num_bytes = thread_alloc::trim(cap_medium + cap_large);
+    ok &= num_bytes == cap_small;
+    ok &= thread_alloc::available(thread) == cap_medium + cap_large;
+
+    // bound the available memory; returning a block trims the large and
+    // then the medium capacity (they were used before the small one)
+    thread_alloc::max_available(cap_medium);
+    v_small = thread_alloc::get_memory(100, cap_small);
+    thread_alloc::return_memory(v_small);
+    ok &= thread_alloc::available(thread) == cap_small;
+
+    // statistics for the small and large capacities
+    // (the aligned mode capacities, which have larger indices, are not used)
+    bool found_small = false;
+    bool found_large = false;
+    for(size_t index = 0; index < thread_alloc::num_capacity(); ++index)
+    {   thread_alloc::capacity_stat_t stat =
+            thread_alloc::capacity_stat(thread, index);
+        if( stat.capacity == cap_small && ! found_small )
+        {   found_small = true;
+            ok &= stat.num_inuse     == 0;
+            ok &= stat.num_available == 1;
+            ok &= stat.num_new       == 2;
+            ok &= stat.num_reuse     == 0;
+            ok &= stat.num_trim      == 1;
+        }
+        if( stat.capacity == cap_large && ! found_large )
+        {   found_large = true;
+            ok &= stat.num_available == 0;
+            ok &= stat.num_new       == 1;
+            ok &= stat.num_trim      == 1;
+        }
+    }
+    ok &= found_small && found_large;
+
+    // return to the default bound and free the available memory
+    thread_alloc::max_available( std::numeric_limits<size_t>::max() );
+    ok &= thread_alloc::free_all();
+
+    return ok;
+}
+
 } // End empty namespace
 
 bool check_alignment(void)
@@ -226,6 +394,15 @@ bool thread_alloc(void)
     // run typed allocation tests
     ok &= type_allocate();
 
+    // run aligned mode allocation tests
+    ok &= aligned_allocate();
+
+    // run huge page allocation tests
+    ok &= huge_allocate();
+
+    // run trimming tests
+    ok &= trim_allocate();
+
     // check alignment
     ok &= check_alignment();
 
@@ -46,6 +46,7 @@ extern bool rosen_34(void);
 extern bool runge_45(void);
 extern bool runge_45_1(void);
 extern bool set_union(void);
+extern bool small_vector(void);
 extern bool sparse_rc(void);
 extern bool sparse_rcv(void);
 extern bool thread_alloc(void);
@@ -85,6 +86,7 @@ int main(void)
     Run( runge_45,               "runge_45" );
     Run( runge_45_1,             "runge_45_1" );
     Run( set_union,              "set_union" );
+    Run( small_vector,           "small_vector" );
     Run( sparse_rc,              "sparse_rc" );
     Run( sparse_rcv,             "sparse_rcv" );
     Run( thread_alloc,           "thread_alloc" );
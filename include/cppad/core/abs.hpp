@@ -98,7 +98,7 @@ AD<Base> AD<Base>::abs_me (void) const
         result.taddr_   = tape->Rec_.put_dyn_par(
             result.value_, local::abs_dyn, taddr_
         );
-        result.tape_id_  = tape_id_;
+        result.set_tape_id(tape_id_);
         result.ad_type_  = dynamic_enum;
     }
     else
@@ -113,7 +113,7 @@ AD<Base> AD<Base>::abs_me (void) const
         result.taddr_    = tape->Rec_.PutOp(local::AbsOp);
 
         // make result a variable
-        result.tape_id_  = tape_id_;
+        result.set_tape_id(tape_id_);
         result.ad_type_  = variable_enum;
     }
     return result;
@@ -40,16 +40,25 @@ private :
     // Base type value for this object
     Base value_;
     //
+# if CPPAD_COMPACT_AD
     // tape for this object
-    tape_id_t tape_id_;
+    tape_id_t tape_id_ : CPPAD_TAPE_ID_BITS;
     //
-    // tape address for this object
+    // sub-type for this object
     // (when tape_id is current tape for AD<Base>)
-    addr_t taddr_;
+    ad_type_enum ad_type_ : 2;
+# else
+    // tape for this object
+    tape_id_t tape_id_;
     //
     // sub-type for this object
     // (when tape_id is current tape for AD<Base>)
     ad_type_enum ad_type_;
+# endif
+    //
+    // tape address for this object
+    // (when tape_id is current tape for AD<Base>)
+    addr_t taddr_;
     // -----------------------------------------------------------------------
 
     // enable use of AD<Base> in parallel mode
@@ -59,10 +68,11 @@ private :
     // template friend functions where template parameter is not bound
     template <class ADVector>
     friend void Independent(
-        ADVector&  x              ,
-        size_t     abort_op_index ,
-        bool       record_compare ,
-        ADVector&  dynamic
+        ADVector&          x              ,
+        size_t             abort_op_index ,
+        bool               record_compare ,
+        ADVector&          dynamic        ,
+        const record_hint& hint
     );
 
     // one argument functions
@@ -275,13 +285,24 @@ public:
     );
 
 private:
+    // -----------------------------------------------------------------
+    // Set the tape identifier for this object
+    void set_tape_id(tape_id_t tape_id)
+    {
+# if CPPAD_COMPACT_AD
+        // tape_manage checks that tape identifiers fit in the bit field
+        tape_id_ = tape_id & ( ( tape_id_t(1) << CPPAD_TAPE_ID_BITS ) - 1 );
+# else
+        tape_id_ = tape_id;
+# endif
+    }
     // -----------------------------------------------------------------
     // Make this parameter a new variable
     void make_variable(tape_id_t id,  addr_t taddr)
     {   CPPAD_ASSERT_UNKNOWN( Parameter(*this) ); // currently a par
         CPPAD_ASSERT_UNKNOWN( taddr > 0 );        // sure valid taddr
 
-        tape_id_ = id;
+        set_tape_id(id);
         taddr_   = taddr;
         ad_type_ = variable_enum;
     }
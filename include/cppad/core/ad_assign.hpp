@@ -75,7 +75,7 @@ because they may be optimized better than the code below:
 template <class Base>
 AD<Base>& AD<Base>::operator=(const AD<Base> &right)
 {   value_    = right.value_;
-    tape_id_  = right.tape_id_;
+    set_tape_id(right.tape_id_);
     taddr_    = right.taddr_;
     ad_type_  = right.ad_type_;
 
@@ -98,7 +98,7 @@ so this object is initially a parameter.
 template <class Base>
 AD<Base>& AD<Base>::operator=(const Base &b)
 {   value_   = b;
-    tape_id_ = 0;
+    set_tape_id(0);
     //
     CPPAD_ASSERT_UNKNOWN( ! ( Variable(*this) | Dynamic(*this) ) );
     return *this;
@@ -107,8 +107,8 @@ template <class Base>
 AD<Base>::AD(void)
 : value_()
 , tape_id_(0)
-, taddr_(0)
 , ad_type_(constant_enum)
+, taddr_(0)
 { }
 
 // --------------------------------------------------------------------------
@@ -128,8 +128,8 @@ template <class Base>
 AD<Base>::AD(const double &d)
 : value_( Base(d) )
 , tape_id_(0)
-, taddr_(0)
 , ad_type_(constant_enum)
+, taddr_(0)
 {   // check that this is a parameter
     CPPAD_ASSERT_UNKNOWN( Parameter(*this) );
 }
@@ -154,8 +154,8 @@ template <class Base>
 AD<Base>::AD(const Base &b)
 : value_(b)
 , tape_id_(0)
-, taddr_(0)
 , ad_type_(constant_enum)
+, taddr_(0)
 {   // check that this is a parameter
     CPPAD_ASSERT_UNKNOWN( Parameter(*this) );
 }
@@ -191,8 +191,8 @@ template <class T>
 AD<Base>::AD(const T &t)
 : value_( Base( double(t) ) )
 , tape_id_(0)
-, taddr_(0)
 , ad_type_(constant_enum)
+, taddr_(0)
 { }
 
 } // END_CPPAD_NAMESPACE
@@ -42,7 +42,15 @@ $childtable%
     include/cppad/core/ad_fun.omh%
     include/cppad/core/optimize.hpp%
     include/cppad/core/fun_check.hpp%
-    include/cppad/core/check_for_nan.hpp
+    include/cppad/core/check_for_nan.hpp%
+    include/cppad/core/fun_compress.hpp%
+    include/cppad/core/numa_interleave.hpp%
+    include/cppad/core/huge_page.hpp%
+    include/cppad/core/pack_arg.hpp%
+    include/cppad/core/memory_report.hpp%
+    include/cppad/core/fun_registry.hpp%
+    include/cppad/core/fun_splice.hpp%
+    include/cppad/core/fun_compose.hpp
 %$$
 
 $end
@@ -50,6 +58,7 @@ $end
 # include <cppad/core/graph/cpp_graph.hpp>
 # include <cppad/local/subgraph/info.hpp>
 # include <cppad/local/graph/cpp_graph_op.hpp>
+# include <cppad/core/fun_registry.hpp>
 
 namespace CppAD { // BEGIN_CPPAD_NAMESPACE
 /*!
@@ -138,6 +147,14 @@ private:
     /// Not in subgraph_info_ because it depends on Base.
     local::pod_vector_maybe<Base> subgraph_partial_;
 
+    /// used for hes_dir calculations.
+    /// Declared here to avoid reallocation for each call.
+    local::pod_vector_maybe<Base> hes_dir_taylor_;
+
+    /// used for the partials in Reverse, value_and_gradient and hes_dir.
+    /// Declared here to avoid reallocation for each call.
+    local::pod_vector_maybe<Base> reverse_partial_;
+
     /// the operation sequence corresponding to this object
     local::player<Base> play_;
 
@@ -153,11 +170,23 @@ private:
     /// for_jac_sparse_set_.n_set() != 0  implies for_sparse_pack_ is empty.
     local::sparse::list_setvec for_jac_sparse_set_;
 
+    /// maximum memory used by each component of this object
+    /// (see memory_report)
+    fun_memory_size memory_high_water_;
 
     // ------------------------------------------------------------
     // Private member functions
     // ------------------------------------------------------------
 
+    /// number of bytes currently used by each component of this object
+    fun_memory_size memory_size(void) const;
+
+    /// include the current memory in memory_high_water_
+    void memory_high_water(void);
+
+    /// memory report for the ADFun object at the specified address
+    static fun_memory memory_report_void(const void* fun);
+
     /// change the operation sequence corresponding to this object
     template <class ADvector>
     void Dependent(local::ADTape<Base> *tape, const ADvector &y);
@@ -339,6 +368,37 @@ public:
     /// get check_for_nan
     bool check_for_nan(void) const;
 
+    /// compress the operation sequence
+    void compress(void);
+
+    /// undo compress
+    void decompress(void);
+
+    /// is the operation sequence compressed
+    bool compressed(void) const;
+
+    /// size_op_seq after the operation sequence is decompressed
+    size_t size_op_seq_decompressed(void) const;
+
+    /// interleave the operation sequence across the NUMA nodes
+    size_t numa_interleave(void);
+
+    /// use huge pages for the operation sequence and Taylor coefficients
+    void huge_page(bool value);
+
+    /// store the operator arguments using the smallest sufficient type
+    void pack_arg(bool value);
+
+    /// memory used by each component of this object
+    fun_memory memory_report(void) const;
+
+    /// splice separately recorded blocks into this function
+    template <class FunVector>
+    void splice(const FunVector& block);
+
+    /// set this function to the composition g[ f(x) ]
+    void compose(ADFun& g, ADFun& f);
+
     /// assign a new operation sequence
     template <class ADvector>
     void Dependent(const ADvector &x, const ADvector &y);
@@ -357,10 +417,27 @@ public:
         size_t q, const BaseVector& xq, std::ostream& s = std::cout
     );
 
+    /// forward mode user API, multiple orders one direction, result
+    /// returned in an argument so that it can be re-used
+    template <class BaseVector>
+    void Forward(
+        size_t q, const BaseVector& xq, BaseVector& yq,
+        std::ostream& s = std::cout
+    );
+
     /// reverse mode sweep
     template <class BaseVector>
     BaseVector Reverse(size_t p, const BaseVector &v);
 
+    /// reverse mode sweep, result returned in an argument so that it
+    /// can be re-used
+    template <class BaseVector>
+    void Reverse(size_t p, const BaseVector &v, BaseVector& dw);
+
+    /// reverse mode first order sweep with multiple weight vectors
+    template <class BaseVector>
+    BaseVector Reverse(size_t q, size_t r, const BaseVector& w);
+
     // forward Jacobian sparsity pattern
     // (doxygen in cppad/core/for_sparse_jac.hpp)
     template <class SetVector>
@@ -388,20 +465,34 @@ public:
     // (doxygen in cppad/core/subgraph_reverse.hpp)
     template <class Addr, class BaseVector, class SizeVector>
     void subgraph_reverse_helper(
+        size_t                               q             ,
+        size_t                               ell           ,
+        SizeVector&                          col           ,
+        BaseVector&                          dw            ,
+        local::pod_vector<addr_t>&           in_subgraph   ,
+        local::pod_vector<bool>&             process_range ,
+        local::pod_vector_maybe<Base>&       partial
+    );
+
+    // subgraph_reverse: compute derivative
+    // (doxygen in cppad/core/subgraph_reverse.hpp)
+    template <class BaseVector, class SizeVector>
+    void subgraph_reverse(
         size_t                               q         ,
         size_t                               ell       ,
         SizeVector&                          col       ,
         BaseVector&                          dw
     );
 
-    // subgraph_reverse: compute derivative
+    // subgraph_reverse: compute derivative using a separate workspace
     // (doxygen in cppad/core/subgraph_reverse.hpp)
     template <class BaseVector, class SizeVector>
     void subgraph_reverse(
         size_t                               q         ,
         size_t                               ell       ,
         SizeVector&                          col       ,
-        BaseVector&                          dw
+        BaseVector&                          dw        ,
+        subgraph_work<Base>&                 work
     );
 
     // subgraph_jac_rev: compute Jacobian
@@ -412,6 +503,14 @@ public:
         sparse_rcv<SizeVector, BaseVector>&  subset
     );
 
+    // subgraph_jac_rev: compute this thread's rows of Jacobian
+    // (doxygen in cppad/core/subgraph_jac_rev.hpp)
+    template <class SizeVector, class BaseVector>
+    void subgraph_jac_rev(
+        sparse_rcv<SizeVector, BaseVector>&  subset    ,
+        subgraph_work<Base>&                 work
+    );
+
     // subgraph_jac_rev: compute Jacobian
     // (doxygen missing in cppad/core/subgraph_jac_rev.hpp)
     template <class BoolVector, class SizeVector, class BaseVector>
@@ -458,6 +557,17 @@ public:
         sparse_hes_work&                     work
     );
 
+    // compute sparse third order tensor
+    // (doxygen in cppad/core/sparse_ter.hpp)
+    template <class SizeVector, class BaseVector>
+    size_t sparse_ter(
+        const BaseVector&                    x        ,
+        const BaseVector&                    w        ,
+        sparse_rcv<SizeVector, BaseVector>&  subset   ,
+        const sparse_rc<SizeVector>&         pattern  ,
+        sparse_ter_work&                     work
+    );
+
     // compute sparsity pattern using subgraphs
     // (doxygen in cppad/core/subgraph_sparsity.hpp)
     template <class BoolVector, class SizeVector>
@@ -511,6 +621,16 @@ public:
         sparse_rc<SizeVector>&       pattern_out
     );
 
+    // forward mode third order sparsity pattern
+    // (doxygen in cppad/core/for_ter_sparsity.hpp)
+    template <class BaseVector, class BoolVector, class SizeVector>
+    void for_ter_sparsity(
+        const BaseVector&            x                ,
+        const BoolVector&            select_range     ,
+        bool                         internal_bool    ,
+        sparse_rc<SizeVector>&       pattern_out
+    );
+
     // forward mode Hessian sparsity pattern
     // (see doxygen in cppad/core/for_sparse_hes.hpp)
     template <class SetVector>
@@ -603,6 +723,10 @@ public:
     size_t size_op_arg(void) const
     {   return play_.num_op_arg_rec(); }
 
+    /// number of bytes used to store each operator argument
+    size_t size_op_arg_byte(void) const
+    {   return play_.size_op_arg_byte(); }
+
     /// amount of memory required for the operation sequence
     size_t size_op_seq(void) const
     {   return play_.size_op_seq(); }
@@ -725,6 +849,31 @@ public:
         const BaseVector   &x ,
         size_t              i );
 
+    /// function value and first order reverse mode in one call
+    template <class BaseVector>
+    void value_and_gradient(
+        const BaseVector&  x ,
+        const BaseVector&  w ,
+        BaseVector&        y ,
+        BaseVector&        g );
+
+    /// Hessian times multiple directions using one forward and reverse sweep
+    template <class BaseVector>
+    void hes_dir(
+        size_t             r  ,
+        const BaseVector&  w  ,
+        const BaseVector&  v  ,
+        BaseVector&        hv );
+
+    /// partials of order one through p in a subspace of directions
+    template <class BaseVector, class SizeVector>
+    void dir_tensor(
+        size_t             p     ,
+        const BaseVector&  x     ,
+        const BaseVector&  s     ,
+        SizeVector&        index ,
+        BaseVector&        dy    );
+
     /// forward mode calculation of a subset of second order partials
     template <class BaseVector, class SizeVector_t>
     BaseVector ForTwo(
@@ -856,6 +1005,8 @@ public:
 # include <cppad/local/sweep/forward1.hpp>
 # include <cppad/local/sweep/forward2.hpp>
 # include <cppad/local/sweep/reverse.hpp>
+# include <cppad/local/sweep/reverse_dir.hpp>
+# include <cppad/local/sweep/reverse_hes_dir.hpp>
 # include <cppad/local/sweep/for_jac.hpp>
 # include <cppad/local/sweep/rev_jac.hpp>
 # include <cppad/local/sweep/rev_hes.hpp>
@@ -875,6 +1026,14 @@ public:
 # include <cppad/core/fun_check.hpp>
 # include <cppad/core/omp_max_thread.hpp>
 # include <cppad/core/optimize.hpp>
+# include <cppad/core/fun_compress.hpp>
+# include <cppad/core/numa_interleave.hpp>
+# include <cppad/core/huge_page.hpp>
+# include <cppad/core/pack_arg.hpp>
+# include <cppad/core/memory_report.hpp>
+# include <cppad/core/fun_splice.hpp>
+# include <cppad/core/fun_compose.hpp>
+# include <cppad/core/binomial_checkpoint.hpp>
 # include <cppad/core/abs_normal_fun.hpp>
 # include <cppad/core/graph/from_json.hpp>
 # include <cppad/core/graph/to_json.hpp>
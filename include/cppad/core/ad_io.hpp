@@ -175,7 +175,7 @@ template <class Base>
 CPPAD_INLINE_FRIEND_TEMPLATE_FUNCTION
 std::istream& operator >> (std::istream& is, AD<Base>& x)
 {   // like assignment to a base type value
-    x.tape_id_ = 0;
+    x.set_tape_id(0);
     CPPAD_ASSERT_UNKNOWN( Parameter(x) );
     return (is >> x.value_);
 }
@@ -58,7 +58,7 @@ AD<Base> operator + (const AD<Base> &left , const AD<Base> &right)
             // put operator in the tape
             result.taddr_ = tape->Rec_.PutOp(local::AddvvOp);
             // make result a variable
-            result.tape_id_ = tape_id;
+            result.set_tape_id(tape_id);
             result.ad_type_ = variable_enum;
         }
         else if( (! dyn_right) & IdenticalZero(right.value_) )
@@ -79,7 +79,7 @@ AD<Base> operator + (const AD<Base> &left , const AD<Base> &right)
             // put operator in the tape
             result.taddr_ = tape->Rec_.PutOp(local::AddpvOp);
             // make result a variable
-            result.tape_id_ = tape_id;
+            result.set_tape_id(tape_id);
             result.ad_type_ = variable_enum;
         }
     }
@@ -101,7 +101,7 @@ AD<Base> operator + (const AD<Base> &left , const AD<Base> &right)
             // put operator in the tape
             result.taddr_ = tape->Rec_.PutOp(local::AddpvOp);
             // make result a variable
-            result.tape_id_ = tape_id;
+            result.set_tape_id(tape_id);
             result.ad_type_ = variable_enum;
         }
     }
@@ -117,7 +117,7 @@ AD<Base> operator + (const AD<Base> &left , const AD<Base> &right)
         result.taddr_   = tape->Rec_.put_dyn_par(
             result.value_, local::add_dyn,   arg0, arg1
         );
-        result.tape_id_ = tape_id;
+        result.set_tape_id(tape_id);
         result.ad_type_ = dynamic_enum;
     }
     return result;
@@ -99,7 +99,7 @@ AD<Base>& AD<Base>::operator += (const AD<Base> &right)
             taddr_ = tape->Rec_.PutOp(local::AddpvOp);
 
             // make this a variable
-            tape_id_ = tape_id;
+            set_tape_id(tape_id);
             ad_type_ = variable_enum;
         }
     }
@@ -115,7 +115,7 @@ AD<Base>& AD<Base>::operator += (const AD<Base> &right)
         taddr_ = tape->Rec_.put_dyn_par(
                 value_, local::add_dyn, arg0, arg1
         );
-        tape_id_ = tape_id;
+        set_tape_id(tape_id);
         ad_type_ = dynamic_enum;
     }
     return *this;
@@ -0,0 +1,319 @@
+# ifndef CPPAD_CORE_ARENA_ALLOCATOR_HPP
+# define CPPAD_CORE_ARENA_ALLOCATOR_HPP
+/* --------------------------------------------------------------------------
+CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-21 Bradley M. Bell
+
+CppAD is distributed under the terms of the
+             Eclipse Public License Version 2.0.
+
+This Source Code may also be made available under the following
+Secondary License when the conditions for such availability set forth
+in the Eclipse Public License, Version 2.0 are satisfied:
+      GNU General Public License, Version 2.0 or later.
+---------------------------------------------------------------------------- */
+/*
+$begin arena_allocator$$
+$spell
+    const
+    std
+    vec
+    thread_alloc
+    inuse
+$$
+
+$section Recording Scope Memory for Containers of AD Objects$$
+
+$head Syntax$$
+$codei%CppAD::arena_allocator<%Type%> %alloc%
+%$$
+$codei%CppAD::arena_vector<%Type%> %vec%
+%$$
+$icode%bytes% = CppAD::arena_allocator<%Type%>::chunk_bytes()
+%$$
+
+$head Purpose$$
+Recording an operation sequence often creates and destroys a large number
+of containers that hold intermediate $codei%AD<%Base%>%$$ values.
+During a recording, the memory for a container that uses $code arena_allocator$$
+is obtained by advancing a pointer in a large block of memory (a chunk).
+Deallocating this memory only decrements a counter.
+The chunks are released in bulk when the recording has finished
+and all of the memory obtained from them has been deallocated.
+This makes allocation and deallocation during a recording very fast
+and keeps the AD objects close together in memory.
+
+$head Recording$$
+A recording for the current thread starts with a call to
+$cref Independent$$ and ends with the corresponding call to
+$cref Dependent$$ (or the $cref FunConstruct$$ that calls $code Dependent$$),
+or $cref abort_recording$$.
+If there are simultaneous recordings for different $icode Base$$ types
+on the same thread, the arena is used until the last one ends.
+Memory that is allocated when there is no recording for the current thread,
+or that is large compared to a chunk,
+is obtained directly from $cref thread_alloc$$.
+
+$head Lifetime$$
+It is not necessary for the containers to be destroyed before the recording
+ends; e.g., an $code arena_vector$$ of independent variables can be used
+after the corresponding $code Dependent$$ call.
+The chunks for a recording are returned to $code thread_alloc$$ when the
+recording has ended and the last block of memory obtained from them is
+deallocated.
+
+$head arena_allocator$$
+The class $codei%arena_allocator<%Type%>%$$ satisfies the C++11
+$code Allocator$$ requirements and can be used with any
+standard library container; e.g.,
+$codei%
+    std::list< AD<double> , CppAD::arena_allocator< AD<double> > >
+%$$
+All $code arena_allocator$$ objects compare equal; i.e.,
+memory allocated by one can be deallocated by any other.
+
+$head arena_vector$$
+The type $codei%arena_vector<%Type%>%$$ is
+$codei%
+    std::vector< %Type% , CppAD::arena_allocator<%Type%> >
+%$$
+It is a $cref SimpleVector$$ and can be used for the arguments to
+$code Independent$$, $code Dependent$$, and most other CppAD routines.
+
+$head CppAD::vector$$
+The $cref/CppAD::vector/CppAD_vector/$$ class obtains its memory from
+$code thread_alloc$$, which already keeps the memory returned by each thread
+available for that thread (when $cref/hold_memory/ta_hold_memory/$$ is true).
+It does not have an allocator template parameter and so cannot use the arena.
+
+$head chunk_bytes$$
+The return value $icode bytes$$ has prototype
+$codei%
+    size_t %bytes%
+%$$
+It is the minimum number of bytes in each chunk.
+Requests for more than a quarter of this number of bytes
+are not satisfied by a chunk.
+
+$head Parallel Mode$$
+Each thread has its own arena.
+Memory may be deallocated by a different thread than the one that
+allocated it, but it is more efficient if the same thread is used.
+
+$head Example$$
+$children%
+    example/general/arena_allocator.cpp
+%$$
+The file $cref arena_allocator.cpp$$
+contains an example and test of this allocator.
+
+$end
+------------------------------------------------------------------------------
+*/
+# include <atomic>
+# include <vector>
+# include <cstdint>
+# include <cppad/local/define.hpp>
+# include <cppad/core/cppad_assert.hpp>
+# include <cppad/utility/thread_alloc.hpp>
+
+/// number of bytes before each block of memory obtained from the arena
+# define CPPAD_ARENA_HEADER_BYTES 16
+
+/// minimum number of bytes in an arena chunk
+# define CPPAD_ARENA_CHUNK_BYTES 65536
+
+namespace CppAD { namespace local { // BEGIN_CPPAD_LOCAL_NAMESPACE
+/*!
+\file arena_allocator.hpp
+Recording scope memory for containers of AD objects.
+*/
+
+/*!
+The arena for one recording on one thread.
+
+Each chunk is memory obtained from thread_alloc. Its first word is a pointer
+to the previous chunk (nullptr for the first chunk).
+*/
+class arena_generation {
+private:
+    /// number of blocks that are in use plus one while recording
+    std::atomic<size_t> live_;
+    /// most recent chunk (nullptr if there are no chunks)
+    void*               chunk_;
+    /// next available byte in the most recent chunk
+    char*               next_;
+    /// one past the last byte in the most recent chunk
+    char*               end_;
+    // -----------------------------------------------------------------------
+    /// round up to a multiple of the header size
+    static size_t round_up(size_t bytes)
+    {   size_t align = CPPAD_ARENA_HEADER_BYTES;
+        return (bytes + align - 1) & ~ (align - 1);
+    }
+    /// add a chunk that can hold at least bytes
+    void new_chunk(size_t bytes)
+    {   size_t min_bytes = CPPAD_ARENA_CHUNK_BYTES;
+        if( min_bytes < bytes + 2 * CPPAD_ARENA_HEADER_BYTES )
+            min_bytes = bytes + 2 * CPPAD_ARENA_HEADER_BYTES;
+        size_t cap_bytes;
+        void*  raw = thread_alloc::get_memory(min_bytes, cap_bytes);
+        *reinterpret_cast<void**>(raw) = chunk_;
+        chunk_ = raw;
+        //
+        std::uintptr_t address = reinterpret_cast<std::uintptr_t>(raw);
+        address  = round_up( size_t(address + sizeof(void*)) );
+        next_    = reinterpret_cast<char*>(address);
+        end_     = reinterpret_cast<char*>(raw) + cap_bytes;
+    }
+public:
+    /// constructor (the recording holds one reference)
+    arena_generation(void)
+    : live_(1), chunk_(nullptr), next_(nullptr), end_(nullptr)
+    { }
+    /// destructor returns all the chunks to thread_alloc
+    ~arena_generation(void)
+    {   while( chunk_ != nullptr )
+        {   void* previous = *reinterpret_cast<void**>(chunk_);
+            thread_alloc::return_memory(chunk_);
+            chunk_ = previous;
+        }
+    }
+    /*!
+    Get memory from this arena (only called by the thread for this arena
+    during its recording).
+
+    \param bytes
+    is the number of bytes requested.
+
+    \return
+    is the start of the block which is preceded by CPPAD_ARENA_HEADER_BYTES
+    that contain a pointer to this arena.
+    */
+    void* allocate(size_t bytes)
+    {   bytes = round_up(bytes) + CPPAD_ARENA_HEADER_BYTES;
+        if( next_ == nullptr || size_t(end_ - next_) < bytes )
+            new_chunk(bytes);
+        char* header = next_;
+        next_       += bytes;
+        live_.fetch_add(1, std::memory_order_relaxed);
+        //
+        *reinterpret_cast<arena_generation**>(header) = this;
+        return header + CPPAD_ARENA_HEADER_BYTES;
+    }
+    /// release one reference to this arena, delete it if there are none left
+    void release(void)
+    {   if( live_.fetch_sub(1, std::memory_order_acq_rel) == 1 )
+            delete this;
+    }
+};
+
+/// manages the arena for the current recording on each thread
+class recording_arena {
+private:
+    /// number of recordings in progress for a thread
+    static size_t* depth_ptr(size_t thread)
+    {   static size_t depth_table[CPPAD_MAX_NUM_THREADS];
+        return depth_table + thread;
+    }
+    /// arena for the recordings in progress for a thread
+    static arena_generation** generation_handle(size_t thread)
+    {   static arena_generation* generation_table[CPPAD_MAX_NUM_THREADS];
+        return generation_table + thread;
+    }
+public:
+    /// a recording is starting on the current thread
+    static void begin(void)
+    {   size_t thread  = thread_alloc::thread_num();
+        size_t* depth  = depth_ptr(thread);
+        if( *depth == 0 )
+        {   CPPAD_ASSERT_UNKNOWN( *generation_handle(thread) == nullptr );
+            *generation_handle(thread) = new arena_generation();
+        }
+        ++(*depth);
+    }
+    /// a recording is ending on the current thread
+    static void end(void)
+    {   size_t thread  = thread_alloc::thread_num();
+        size_t* depth  = depth_ptr(thread);
+        CPPAD_ASSERT_UNKNOWN( *depth > 0 );
+        --(*depth);
+        if( *depth == 0 )
+        {   arena_generation** handle = generation_handle(thread);
+            arena_generation*  gen    = *handle;
+            *handle                   = nullptr;
+            gen->release();
+        }
+    }
+    /// get memory from the arena, or thread_alloc when not recording
+    static void* allocate(size_t bytes)
+    {   size_t thread         = thread_alloc::thread_num();
+        arena_generation* gen = *generation_handle(thread);
+        if( gen != nullptr && 4 * bytes <= CPPAD_ARENA_CHUNK_BYTES )
+            return gen->allocate(bytes);
+        //
+        size_t min_bytes = bytes + CPPAD_ARENA_HEADER_BYTES;
+        size_t cap_bytes;
+        char*  header = reinterpret_cast<char*>(
+            thread_alloc::get_memory(min_bytes, cap_bytes)
+        );
+        *reinterpret_cast<arena_generation**>(header) = nullptr;
+        return header + CPPAD_ARENA_HEADER_BYTES;
+    }
+    /// return memory obtained using allocate
+    static void deallocate(void* ptr)
+    {   char* header = reinterpret_cast<char*>(ptr) - CPPAD_ARENA_HEADER_BYTES;
+        arena_generation* gen = *reinterpret_cast<arena_generation**>(header);
+        if( gen == nullptr )
+            thread_alloc::return_memory(header);
+        else
+            gen->release();
+    }
+};
+
+} } // END_CPPAD_LOCAL_NAMESPACE
+
+namespace CppAD { // BEGIN_CPPAD_NAMESPACE
+
+/// allocator that uses the arena for the current recording
+template <class Type> class arena_allocator {
+public:
+    /// type of the objects allocated
+    typedef Type value_type;
+    /// default constructor
+    arena_allocator(void)
+    { }
+    /// conversion from an allocator for another type
+    template <class Other>
+    arena_allocator(const arena_allocator<Other>&)
+    { }
+    /// minimum number of bytes in a chunk
+    static size_t chunk_bytes(void)
+    {   return CPPAD_ARENA_CHUNK_BYTES; }
+    /// memory for n objects of this type
+    Type* allocate(size_t n)
+    {   return reinterpret_cast<Type*>(
+            local::recording_arena::allocate( n * sizeof(Type) )
+        );
+    }
+    /// return memory obtained using allocate
+    void deallocate(Type* ptr, size_t)
+    {   local::recording_arena::deallocate(ptr); }
+};
+/// all arena allocators are equivalent
+template <class Left, class Right>
+bool operator==(const arena_allocator<Left>&, const arena_allocator<Right>&)
+{   return true; }
+/// all arena allocators are equivalent
+template <class Left, class Right>
+bool operator!=(const arena_allocator<Left>&, const arena_allocator<Right>&)
+{   return false; }
+
+/// std::vector that uses the arena for the current recording
+template <class Type>
+using arena_vector = std::vector< Type, arena_allocator<Type> >;
+
+} // END_CPPAD_NAMESPACE
+
+# undef CPPAD_ARENA_HEADER_BYTES
+# undef CPPAD_ARENA_CHUNK_BYTES
+# endif
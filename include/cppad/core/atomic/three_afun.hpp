@@ -197,7 +197,7 @@ void atomic_three<Base>::operator()(
         ay[i].value_ = taylor_y[i];
 
         // initialize entire vector as constants
-        ay[i].tape_id_ = 0;
+        ay[i].set_tape_id(0);
         ay[i].taddr_   = 0;
 
         // we need to record this operation if
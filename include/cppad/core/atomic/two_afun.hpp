@@ -173,7 +173,7 @@ void atomic_base<Base>::operator()(
         ay[i].value_ = ty[i];
 
         // initialize entire vector parameters (not in tape)
-        ay[i].tape_id_ = 0;
+        ay[i].set_tape_id(0);
         ay[i].taddr_   = 0;
 
         // we need to record this operation if
@@ -230,7 +230,7 @@ void atomic_base<Base>::operator()(
         for(i = 0; i < m; i++)
         {   if( vy[i] )
             {   ay[i].taddr_    = tape->Rec_.PutOp(local::FunrvOp);
-                ay[i].tape_id_  = tape_id;
+                ay[i].set_tape_id(tape_id);
                 ay[i].ad_type_  = variable_enum;
             }
             else
@@ -133,7 +133,7 @@ azmul(const AD<Base>& x, const AD<Base>& y)
             result.taddr_ = tape->Rec_.PutOp(local::ZmulvvOp);
 
             // make result a variable
-            result.tape_id_ = tape_id;
+            result.set_tape_id(tape_id);
             result.ad_type_ = variable_enum;
         }
         else if( ( ! dyn_y ) & IdenticalZero( y.value_ ) )
@@ -158,7 +158,7 @@ azmul(const AD<Base>& x, const AD<Base>& y)
             result.taddr_ = tape->Rec_.PutOp(local::ZmulvpOp);
 
             // make result a variable
-            result.tape_id_ = tape_id;
+            result.set_tape_id(tape_id);
             result.ad_type_ = variable_enum;
         }
     }
@@ -185,7 +185,7 @@ azmul(const AD<Base>& x, const AD<Base>& y)
             result.taddr_ = tape->Rec_.PutOp(local::ZmulpvOp);
 
             // make result a variable
-            result.tape_id_ = tape_id;
+            result.set_tape_id(tape_id);
             result.ad_type_ = variable_enum;
         }
     }
@@ -201,7 +201,7 @@ azmul(const AD<Base>& x, const AD<Base>& y)
         result.taddr_   = tape->Rec_.put_dyn_par(
             result.value_, local::zmul_dyn,   arg0, arg1
         );
-        result.tape_id_ = tape_id;
+        result.set_tape_id(tape_id);
         result.ad_type_ = dynamic_enum;
     }
     return result;
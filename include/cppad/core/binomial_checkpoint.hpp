@@ -0,0 +1,603 @@
+# ifndef CPPAD_CORE_BINOMIAL_CHECKPOINT_HPP
+# define CPPAD_CORE_BINOMIAL_CHECKPOINT_HPP
+/* --------------------------------------------------------------------------
+CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-21 Bradley M. Bell
+
+CppAD is distributed under the terms of the
+             Eclipse Public License Version 2.0.
+
+This Source Code may also be made available under the following
+Secondary License when the conditions for such availability set forth
+in the Eclipse Public License, Version 2.0 are satisfied:
+      GNU General Public License, Version 2.0 or later.
+---------------------------------------------------------------------------- */
+# include <cstdio>
+# include <fstream>
+# include <cppad/local/graph/append_op.hpp>
+/*
+$begin binomial_checkpoint$$
+$spell
+    const
+    dw
+    Taylor
+    Griewank
+    Walther
+    Vec
+    num
+    var
+$$
+
+$section Memory Bounded Reverse Mode Using Binomial Checkpointing$$
+
+$head Syntax$$
+$codei%binomial_checkpoint<%Base%> %rc%(%f%, %n_segment%, %n_snapshot%)
+%$$
+$icode%rc%.new_dynamic(%dynamic%)
+%$$
+$icode%dw% = %rc%.reverse(%x%, %w%)
+%$$
+$icode%dw% = %rc%.reverse(%x%, %w%, %file_name%)
+%$$
+$icode%num_segment% = %rc%.size_segment()
+%$$
+$icode%num_forward% = %rc%.size_forward()
+%$$
+$icode%num_var% = %rc%.max_segment_var()
+%$$
+
+$head Purpose$$
+We use $latex F : \B{R}^n \rightarrow \B{R}^m$$ to denote the
+$cref/AD function/glossary/AD Function/$$ corresponding to $icode f$$.
+This computes the same derivative as the sequence of calls
+$codei%
+    %f%.Forward(0, %x%)
+    %dw% = %f%.Reverse(1, %w%)
+%$$
+The difference is the amount of memory used to hold Taylor coefficients.
+The operation sequence for $icode f$$ is split into segments that are
+executed one after the other.
+Reverse mode is done one segment at a time,
+in reverse order, and only the values at a limited number of the
+segment boundaries (snapshots) are stored.
+The forward mode values inside a segment are recomputed,
+starting at the closest snapshot, when they are needed.
+The snapshot locations are chosen using the binomial schedule
+described in
+Griewank, A. and Walther, A.,
+$italic Algorithm 799: Revolve$$,
+ACM Transactions on Mathematical Software, 26(1), 2000.
+This minimizes the maximum number of times that a segment is recomputed.
+
+$head Memory$$
+The Taylor coefficients for at most one segment are stored at a time.
+In addition, the values of the variables that are live at
+$icode%n_snapshot%+1%$$ segment boundaries are stored.
+Thus choosing a larger value for $icode n_segment$$ reduces the
+Taylor coefficient memory and choosing a larger value for
+$icode n_snapshot$$ reduces the number of times
+the zero order forward mode is recomputed.
+
+$head rc$$
+The object $icode rc$$ holds the operation sequence for each of the segments.
+It does not depend on $icode f$$ after its constructor.
+
+$head f$$
+This object has prototype
+$codei%
+    ADFun<%Base%>& %f%
+%$$
+It is not const because its $cref/to_graph/to_graph/$$ member function
+is used.
+
+$head n_segment$$
+This argument has prototype
+$codei%
+    size_t %n_segment%
+%$$
+It is the requested number of segments and must be greater than zero.
+Each segment is chosen to have about the same number of
+operator results.
+The actual number of segments is less than $icode n_segment$$
+when there are fewer operators in $icode f$$.
+
+$head n_snapshot$$
+This argument has prototype
+$codei%
+    size_t %n_snapshot%
+%$$
+It is the maximum number of segment boundary values,
+in addition to the boundary value at $icode x$$,
+that are stored at the same time.
+If $icode n_snapshot$$ is zero, the forward mode values are recomputed
+starting at $icode x$$ for each segment.
+If $icode%n_snapshot% + 2%$$ is greater than or equal the
+number of segments $icode num_segment$$,
+the number of segment forward sweeps is $codei%2*%num_segment%-1%$$
+(the same as the number of forward sweeps without checkpointing).
+
+$head dynamic$$
+If $icode f$$ has $cref/dynamic parameters/Independent/dynamic/$$,
+$code new_dynamic$$ must be called before the first call to
+$code reverse$$; see $cref new_dynamic$$.
+The argument $icode dynamic$$ has prototype
+$codei%
+    const %Vector%& %dynamic%
+%$$
+and its size is $icode%f%.size_dyn_ind()%$$.
+It specifies the value of the independent dynamic parameters.
+
+$head x$$
+This argument has prototype
+$codei%
+    const %Vector%& %x%
+%$$
+and its size is $latex n$$.
+It specifies the argument value at which the derivative is computed.
+
+$head w$$
+This argument has prototype
+$codei%
+    const %Vector%& %w%
+%$$
+and its size is $latex m$$.
+It specifies the weighting for the components of $latex F$$.
+
+$head dw$$
+The result has prototype
+$codei%
+    %Vector% %dw%
+%$$
+and its size is $latex n$$.
+It is equal to the derivative
+$latex \[
+    dw = w_0 * F_0^{(1)} ( x ) + \cdots + w_{m-1} * F_{m-1}^{(1)} (x)
+\] $$
+
+$head file_name$$
+If this argument is present, it has prototype
+$codei%
+    const std::string& %file_name%
+%$$
+In this case the segment boundary values are stored in the file
+with this name instead of in memory and $icode n_snapshot$$ is not used.
+One forward pass over the segments writes the boundary values
+to the file sequentially.
+The reverse pass over the segments reads them back in reverse order
+and each segment is only recomputed once.
+Thus the memory used is the Taylor coefficients for one segment
+plus the values of the variables that are live at one segment boundary,
+and the number of segment forward sweeps is $codei%2*%num_segment%-1%$$.
+The file is created (or truncated) at the start of the call to
+$code reverse$$ and it is removed before $code reverse$$ returns.
+The values are written using their binary representation,
+so $icode Base$$ must be a type like $code float$$ or $code double$$
+that can be copied byte by byte.
+
+$head num_segment$$
+The return value $icode num_segment$$ has type $code size_t$$
+and is the actual number of segments.
+
+$head num_forward$$
+The return value $icode num_forward$$ has type $code size_t$$
+and is the number of segment zero order forward sweeps
+during the previous call to $code reverse$$
+(zero if there was no previous call).
+
+$head num_var$$
+The return value $icode num_var$$ has type $code size_t$$
+and is the maximum, with respect to the segments,
+of the number of variables in the operation sequence for a segment;
+see $cref/size_var/fun_property/size_var/$$.
+The Taylor coefficient memory used by $icode rc$$ is proportional
+to this value.
+
+$head Vector$$
+The type $icode Vector$$ must be a $cref SimpleVector$$ class with
+$cref/elements of type/SimpleVector/Elements of Specified Type/$$
+$icode Base$$.
+
+$head Restrictions$$
+The segments are created using the
+$cref/C++ AD graph/cpp_ad_graph/$$ representation of $icode f$$.
+Thus $icode f$$ cannot contain operators that are
+$cref/missing/graph_op_enum/Missing Operators/$$ from that representation;
+e.g., $cref VecAD$$ operations.
+Print operations in $icode f$$ are executed each time the corresponding
+segment is recomputed.
+
+$head Example$$
+$children%
+    example/graph/binomial_checkpoint.cpp
+%$$
+The file $cref binomial_checkpoint.cpp$$
+contains an example and test of this operation.
+
+$end
+*/
+
+namespace CppAD { // BEGIN_CPPAD_NAMESPACE
+
+template <class Base>
+class binomial_checkpoint {
+private:
+    /// operation sequence for each segment; the independent variables for
+    /// segment k are the dependent variables for segment k-1.
+    vector< ADFun<Base> > seg_;
+    //
+    /// number of segment zero order forward sweeps during last reverse
+    size_t n_forward_;
+    //
+    /// number of snapshots (not counting x)
+    const size_t n_snapshot_;
+    // ------------------------------------------------------------------------
+    /// binomial coefficient (n choose k)
+    static size_t binomial(size_t n, size_t k)
+    {   size_t result = 1;
+        for(size_t i = 1; i <= k; ++i)
+            result = result * (n - k + i) / i;
+        return result;
+    }
+    // ------------------------------------------------------------------------
+    /// Number of segments to the left of the first checkpoint when there
+    /// are n_seg segments to reverse and n_snap snapshots available.
+    static size_t split(size_t n_seg, size_t n_snap)
+    {   CPPAD_ASSERT_UNKNOWN( n_seg > 1 && n_snap > 0 );
+        //
+        // minimum number of repetitions for n_snap+1 storage locations
+        size_t n_rep = 1;
+        while( binomial(n_snap + 1 + n_rep, n_rep) < n_seg )
+            ++n_rep;
+        //
+        // maximum number of segments to the right of the checkpoint
+        size_t right = binomial(n_snap + n_rep, n_rep);
+        if( right >= n_seg )
+            return 1;
+        return n_seg - right;
+    }
+    // ------------------------------------------------------------------------
+    /// zero order forward for segment k, the Taylor coefficients are freed
+    void advance(size_t k, vector<Base>& state)
+    {   state = seg_[k].Forward(0, state);
+        seg_[k].capacity_order(0);
+        ++n_forward_;
+    }
+    // ------------------------------------------------------------------------
+    /// reverse mode for segment k, ps is partials w.r.t. the state at start
+    void step(size_t k, const vector<Base>& state, vector<Base>& ps)
+    {   seg_[k].Forward(0, state);
+        ++n_forward_;
+        vector<Base> pe(ps);
+        ps = seg_[k].Reverse(1, pe);
+        seg_[k].capacity_order(0);
+    }
+    // ------------------------------------------------------------------------
+    /// report an error reading or writing the file for the boundary values
+    static void file_error(const std::string& file_name, const char* exp)
+    {   std::string msg = "rc.reverse(x, w, file_name): error reading or ";
+        msg += "writing the file " + file_name;
+        //
+        // use this source code as point of detection
+        bool known       = true;
+        int  line        = __LINE__;
+        const char* file = __FILE__;
+        //
+        // CppAD error handler
+        ErrorHandler::Call( known, line, file, exp, msg.c_str() );
+    }
+    // ------------------------------------------------------------------------
+    /// On input ps is partials w.r.t. the state at the end of segment e-1,
+    /// upon return it is partials w.r.t. the state at the start of segment s.
+    void revolve(
+        size_t              s       ,
+        size_t              e       ,
+        const vector<Base>& state_s ,
+        size_t              n_snap  ,
+        vector<Base>&       ps      )
+    {   CPPAD_ASSERT_UNKNOWN( s < e );
+        size_t n_seg = e - s;
+        if( n_seg == 1 )
+        {   step(s, state_s, ps);
+            return;
+        }
+        vector<Base> state;
+        if( n_snap == 0 )
+        {   for(size_t k = e; k > s; --k)
+            {   state = state_s;
+                for(size_t i = s; i < k - 1; ++i)
+                    advance(i, state);
+                step(k - 1, state, ps);
+            }
+            return;
+        }
+        // checkpoint at the start of segment m
+        size_t m = s + split(n_seg, n_snap);
+        state    = state_s;
+        for(size_t i = s; i < m; ++i)
+            advance(i, state);
+        //
+        // segments to the right of the checkpoint
+        revolve(m, e, state, n_snap - 1, ps);
+        state.clear();
+        //
+        // segments to the left of the checkpoint
+        revolve(s, m, state_s, n_snap, ps);
+        return;
+    }
+public:
+    // ------------------------------------------------------------------------
+    /// constructor
+    binomial_checkpoint(ADFun<Base>& f, size_t n_segment, size_t n_snapshot)
+    : n_forward_(0), n_snapshot_(n_snapshot)
+    {   CPPAD_ASSERT_KNOWN(
+            n_segment > 0,
+            "binomial_checkpoint: n_segment is zero"
+        );
+        cpp_graph graph_obj;
+        f.to_graph(graph_obj);
+        //
+        size_t n_dyn  = graph_obj.n_dynamic_ind_get();
+        size_t n_var  = graph_obj.n_variable_ind_get();
+        size_t n_con  = graph_obj.constant_vec_size();
+        size_t n_op   = graph_obj.operator_vec_size();
+        size_t n_dep  = graph_obj.dependent_vec_size();
+        size_t start_result = 1 + n_dyn + n_var + n_con;
+        //
+        // n_result_op, n_result_total
+        vector<size_t> n_result_op(n_op);
+        size_t n_result_total = 0;
+        cpp_graph::const_iterator itr;
+        for(size_t op_index = 0; op_index < n_op; ++op_index)
+        {   if( op_index == 0 )
+                itr = graph_obj.begin();
+            else
+                ++itr;
+            cpp_graph::const_iterator::value_type itr_value = *itr;
+            n_result_op[op_index] = itr_value.n_result;
+            n_result_total       += itr_value.n_result;
+        }
+        size_t n_node = start_result + n_result_total;
+        //
+        // seg_op: segment that each operator is in
+        size_t n_per_seg = (n_result_total + n_segment - 1) / n_segment;
+        if( n_per_seg == 0 )
+            n_per_seg = 1;
+        vector<size_t> seg_op(n_op);
+        size_t n_seg         = 1;
+        size_t n_result_seg  = 0;
+        for(size_t op_index = 0; op_index < n_op; ++op_index)
+        {   size_t n_result = n_result_op[op_index];
+            if( n_result_seg >= n_per_seg && n_result > 0 )
+            {   ++n_seg;
+                n_result_seg = 0;
+            }
+            seg_op[op_index] = n_seg - 1;
+            n_result_seg    += n_result;
+        }
+        //
+        // seg_node: segment that defines each node (n_seg if not a result)
+        // last_use: last segment that uses each node (n_seg if a dependent)
+        vector<size_t> seg_node(n_node), last_use(n_node);
+        for(size_t i = 0; i < n_node; ++i)
+        {   seg_node[i] = n_seg;
+            last_use[i] = 0;
+        }
+        size_t node_index = start_result;
+        for(size_t op_index = 0; op_index < n_op; ++op_index)
+        {   if( op_index == 0 )
+                itr = graph_obj.begin();
+            else
+                ++itr;
+            cpp_graph::const_iterator::value_type itr_value = *itr;
+            const vector<size_t>& arg( *itr_value.arg_node_ptr );
+            size_t k = seg_op[op_index];
+            for(size_t i = 0; i < arg.size(); ++i)
+                last_use[ arg[i] ] = k;
+            for(size_t i = 0; i < itr_value.n_result; ++i)
+                seg_node[node_index++] = k;
+        }
+        for(size_t i = 0; i < n_dep; ++i)
+            last_use[ graph_obj.dependent_vec_get(i) ] = n_seg;
+        //
+        // seg_
+        seg_.resize(n_seg);
+        //
+        // node_map: dynamic parameters map to themselves
+        vector<size_t> node_map(start_result);
+        node_map[0] = 0;
+        for(size_t i = 1; i <= n_dyn; ++i)
+            node_map[i] = i;
+        //
+        // live: independent variables for the current segment
+        vector<size_t> live(n_var);
+        for(size_t j = 0; j < n_var; ++j)
+            live[j] = 1 + n_dyn + j;
+        //
+        size_t op_index = 0;
+        for(size_t k = 0; k < n_seg; ++k)
+        {   size_t n_live = live.size();
+            //
+            // graph for this segment
+            cpp_graph seg_graph;
+            seg_graph.n_dynamic_ind_set(n_dyn);
+            seg_graph.n_variable_ind_set(n_live);
+            for(size_t i = 0; i < n_con; ++i)
+                seg_graph.constant_vec_push_back(
+                    graph_obj.constant_vec_get(i)
+                );
+            for(size_t j = 0; j < n_live; ++j)
+                node_map[ live[j] ] = n_dyn + j + 1;
+            for(size_t i = 0; i < n_con; ++i)
+                node_map[1 + n_dyn + n_var + i] = 1 + n_dyn + n_live + i;
+            size_t n_seg_node = n_dyn + n_live + n_con;
+            //
+            // operators in this segment
+            while( op_index < n_op && seg_op[op_index] == k )
+            {   if( op_index == 0 )
+                    itr = graph_obj.begin();
+                else
+                    ++itr;
+                cpp_graph::const_iterator::value_type itr_value = *itr;
+                local::graph::append_one_op(
+                    seg_graph, graph_obj, itr_value, node_map, n_seg_node
+                );
+                ++op_index;
+            }
+            //
+            // live: independent variables for the next segment
+            live.resize(0);
+            if( k + 1 < n_seg )
+            {   for(size_t node = 1 + n_dyn; node < n_node; ++node)
+                {   // independent variables and operator results
+                    // (not constants) can be independent variables
+                    bool candidate = node < 1 + n_dyn + n_var;
+                    candidate     |= start_result <= node;
+                    candidate     &= k < last_use[node];
+                    candidate     &= seg_node[node] <= k
+                                  || seg_node[node] == n_seg;
+                    if( candidate )
+                        live.push_back(node);
+                }
+                for(size_t j = 0; j < live.size(); ++j)
+                    seg_graph.dependent_vec_push_back( node_map[ live[j] ] );
+            }
+            else
+            {   for(size_t i = 0; i < n_dep; ++i)
+                    seg_graph.dependent_vec_push_back(
+                        node_map[ graph_obj.dependent_vec_get(i) ]
+                    );
+            }
+            seg_[k].from_graph(seg_graph);
+        }
+        CPPAD_ASSERT_UNKNOWN( op_index == n_op );
+    }
+    // ------------------------------------------------------------------------
+    /// number of segments
+    size_t size_segment(void) const
+    {   return seg_.size(); }
+    // ------------------------------------------------------------------------
+    /// number of segment zero order forward sweeps during last reverse
+    size_t size_forward(void) const
+    {   return n_forward_; }
+    // ------------------------------------------------------------------------
+    /// maximum number of variables in a segment
+    size_t max_segment_var(void) const
+    {   size_t result = 0;
+        for(size_t k = 0; k < seg_.size(); ++k)
+            result = std::max(result, seg_[k].size_var());
+        return result;
+    }
+    // ------------------------------------------------------------------------
+    /// set the value of the independent dynamic parameters
+    template <class Vector>
+    void new_dynamic(const Vector& dynamic)
+    {   for(size_t k = 0; k < seg_.size(); ++k)
+            seg_[k].new_dynamic(dynamic);
+    }
+    // ------------------------------------------------------------------------
+    /// first order reverse mode using binomial checkpointing
+    template <class Vector>
+    Vector reverse(const Vector& x, const Vector& w)
+    {   CheckSimpleVector<Base, Vector>();
+        size_t n_seg = seg_.size();
+        size_t n     = seg_[0].Domain();
+        size_t m     = seg_[n_seg - 1].Range();
+        CPPAD_ASSERT_KNOWN(
+            size_t( x.size() ) == n,
+            "rc.reverse(x, w): size of x not equal domain dimension for f"
+        );
+        CPPAD_ASSERT_KNOWN(
+            size_t( w.size() ) == m,
+            "rc.reverse(x, w): size of w not equal range dimension for f"
+        );
+        n_forward_ = 0;
+        //
+        vector<Base> state(n), ps(m);
+        for(size_t j = 0; j < n; ++j)
+            state[j] = x[j];
+        for(size_t i = 0; i < m; ++i)
+            ps[i] = w[i];
+        revolve(0, n_seg, state, n_snapshot_, ps);
+        //
+        Vector dw(n);
+        for(size_t j = 0; j < n; ++j)
+            dw[j] = ps[j];
+        return dw;
+    }
+    // ------------------------------------------------------------------------
+    /// first order reverse mode with segment boundary values in a file
+    template <class Vector>
+    Vector reverse(
+        const Vector&      x         ,
+        const Vector&      w         ,
+        const std::string& file_name )
+    {   CheckSimpleVector<Base, Vector>();
+        size_t n_seg = seg_.size();
+        size_t n     = seg_[0].Domain();
+        size_t m     = seg_[n_seg - 1].Range();
+        CPPAD_ASSERT_KNOWN(
+            size_t( x.size() ) == n,
+            "rc.reverse(x, w, file_name): size of x not equal domain "
+            "dimension for f"
+        );
+        CPPAD_ASSERT_KNOWN(
+            size_t( w.size() ) == m,
+            "rc.reverse(x, w, file_name): size of w not equal range "
+            "dimension for f"
+        );
+        n_forward_ = 0;
+        //
+        std::fstream file_io( file_name.c_str(),
+            std::ios::in | std::ios::out | std::ios::binary | std::ios::trunc
+        );
+        if( ! file_io )
+            file_error(file_name, "file_io.is_open()");
+        //
+        // forward pass, write the state at the start of segments 1, ...
+        vector<std::streamoff> offset(n_seg);
+        vector<Base> state(n);
+        for(size_t j = 0; j < n; ++j)
+            state[j] = x[j];
+        for(size_t k = 0; k + 1 < n_seg; ++k)
+        {   advance(k, state);
+            offset[k + 1] = std::streamoff( file_io.tellp() );
+            std::streamsize char_size =
+                std::streamsize( sizeof(Base) * state.size() );
+            file_io.write(
+                reinterpret_cast<const char*>( state.data() ), char_size
+            );
+            if( ! file_io )
+                file_error(file_name, "file_io.write(...)");
+        }
+        //
+        // reverse pass, read the states in reverse order
+        vector<Base> ps(m);
+        for(size_t i = 0; i < m; ++i)
+            ps[i] = w[i];
+        for(size_t k = n_seg - 1; k > 0; --k)
+        {   state.resize( seg_[k].Domain() );
+            std::streamsize char_size =
+                std::streamsize( sizeof(Base) * state.size() );
+            file_io.seekg( offset[k] );
+            file_io.read( reinterpret_cast<char*>( state.data() ), char_size);
+            if( ! file_io )
+                file_error(file_name, "file_io.read(...)");
+            step(k, state, ps);
+        }
+        file_io.close();
+        std::remove( file_name.c_str() );
+        //
+        state.resize(n);
+        for(size_t j = 0; j < n; ++j)
+            state[j] = x[j];
+        step(0, state, ps);
+        //
+        Vector dw(n);
+        for(size_t j = 0; j < n; ++j)
+            dw[j] = ps[j];
+        return dw;
+    }
+};
+
+} // END_CPPAD_NAMESPACE
+
+# endif
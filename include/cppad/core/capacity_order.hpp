@@ -158,6 +158,9 @@ void ADFun<Base,RecBase>::capacity_order(size_t c, size_t r)
     if( (c == cap_order_taylor_) & (r == num_direction_taylor_) )
         return;
 
+    // include the current Taylor coefficient memory in the high water mark
+    memory_high_water();
+
     if( c == 0 )
     {   CPPAD_ASSERT_UNKNOWN( r == 0 );
         taylor_.clear();
@@ -169,8 +172,11 @@ void ADFun<Base,RecBase>::capacity_order(size_t c, size_t r)
     CPPAD_ASSERT_UNKNOWN(r==num_direction_taylor_ || num_order_taylor_<=1);
 
     // Allocate new taylor with requested number of orders and directions
+    // (using the same allocation policy as the current taylor_)
     size_t new_len   = ( (c-1)*r + 1 ) * num_var_tape_;
-    local::pod_vector_maybe<Base> new_taylor(new_len);
+    local::pod_vector_maybe<Base> new_taylor;
+    new_taylor.huge_page( taylor_.huge_page() );
+    new_taylor.extend(new_len);
 
     // number of orders to copy
     size_t p = std::min(num_order_taylor_, c);
@@ -207,6 +213,7 @@ void ADFun<Base,RecBase>::capacity_order(size_t c, size_t r)
     num_direction_taylor_ = r;
 
     // note that the destructor for new_taylor will free the old taylor memory
+    memory_high_water();
     return;
 }
 
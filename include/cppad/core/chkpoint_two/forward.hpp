@@ -65,7 +65,7 @@ bool chkpoint_two<Base>::forward(
     }
 # endif
     // compute forward mode results for all values and orders
-    taylor_y = g_ptr->Forward(order_up, taylor_x);
+    g_ptr->Forward(order_up, taylor_x, taylor_y);
     //
     return true;
 }
@@ -121,7 +121,7 @@ bool chkpoint_two<Base>::forward(
     }
 # endif
     // compute forward mode results for all values and orders
-    ataylor_y = ag_ptr->Forward(order_up, ataylor_x);
+    ag_ptr->Forward(order_up, ataylor_x, ataylor_y);
     //
     return true;
 }
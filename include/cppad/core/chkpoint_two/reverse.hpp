@@ -75,7 +75,7 @@ bool chkpoint_two<Base>::reverse(
         CPPAD_ASSERT_UNKNOWN( taylor_y[i] == check[i] );
 # endif
     // now can run reverse mode
-    partial_x = g_ptr->Reverse(order_up+1, partial_y);
+    g_ptr->Reverse(order_up+1, partial_y, partial_x);
     //
     return true;
 }
@@ -130,7 +130,7 @@ bool chkpoint_two<Base>::reverse(
         CPPAD_ASSERT_UNKNOWN( ataylor_y[i] == acheck[i] );
 # endif
     // now can run reverse mode
-    apartial_x = ag_ptr->Reverse(order_up+1, apartial_y);
+    ag_ptr->Reverse(order_up+1, apartial_y, apartial_x);
     //
     return true;
 }
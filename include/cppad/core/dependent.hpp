@@ -292,6 +292,7 @@ void ADFun<Base,RecBase>::Dependent(local::ADTape<Base> *tape, const ADvector &y
     // Now that each dependent variable has a place in the tape,
     // and there is a EndOp at the end of the tape, we can transfer the
     // recording to the player and and erase the recording; i.e. ERASE Rec_.
+    tape->Rec_.set_previous_size();
     play_.get_recording(tape->Rec_, n);
 
     // ind_taddr_
@@ -327,6 +328,8 @@ void ADFun<Base,RecBase>::Dependent(local::ADTape<Base> *tape, const ADvector &y
     // used to determine if there is an operation sequence in *this
     CPPAD_ASSERT_UNKNOWN( num_var_tape_  > 0 );
 
+    // memory used by the new operation sequence
+    memory_high_water();
 }
 
 } // END CppAD namespace
@@ -0,0 +1,430 @@
+# ifndef CPPAD_CORE_DIR_TENSOR_HPP
+# define CPPAD_CORE_DIR_TENSOR_HPP
+/* --------------------------------------------------------------------------
+CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-21 Bradley M. Bell
+
+CppAD is distributed under the terms of the
+             Eclipse Public License Version 2.0.
+
+This Source Code may also be made available under the following
+Secondary License when the conditions for such availability set forth
+in the Eclipse Public License, Version 2.0 are satisfied:
+      GNU General Public License, Version 2.0 or later.
+---------------------------------------------------------------------------- */
+
+/*
+$begin dir_tensor$$
+$spell
+    const
+    dir
+    dy
+    Griewank
+    Utke
+    Walther
+    Taylor
+$$
+
+$section Higher Order Partials in a Subspace of Directions$$
+
+$head Syntax$$
+$icode%f%.dir_tensor(%p%, %x%, %s%, %index%, %dy%)%$$
+
+$head Prototype$$
+$srcthisfile%
+    0%// BEGIN_DIR_TENSOR%// END_DIR_TENSOR%1
+%$$
+
+$head Purpose$$
+We use $latex F : \B{R}^n \rightarrow \B{R}^m$$ to denote the
+$cref/AD function/glossary/AD Function/$$ corresponding to $icode f$$.
+Given $icode r$$ directions $latex S \in \B{R}^{n \times r}$$,
+we define $latex G : \B{R}^r \rightarrow \B{R}^m$$ by
+$latex \[
+    G(z) = F( x + S z )
+\] $$
+This routine computes all the partial derivatives of $latex G$$,
+at $latex z = 0$$, with order greater than zero and less than or
+equal $icode p$$.
+For example, if $latex S$$ is the $latex n \times n$$ identity matrix,
+and $icode p$$ is three, these are all the first, second,
+and third order partials of $latex F$$ at $icode x$$.
+
+$head Method$$
+The univariate Taylor coefficients of $latex G$$
+are computed for the directions $latex i \in \B{Z}_+^r$$ with
+$latex | i | = p$$
+using one $cref/multiple direction/forward_dir/$$ forward sweep
+for each order.
+The partials are then computed from these coefficients using the
+interpolation formula of
+Griewank, A., Utke, J., and Walther, A.,
+$italic Evaluating higher derivative tensors by forward propagation
+of univariate Taylor series$$,
+Mathematics of Computation, 69, 2000.
+The number of directions is
+$latex \[
+    R = \left( \begin{array}{c} r + p - 1 \\ p \end{array} \right)
+\] $$
+which is the number of distinct partials of order $icode p$$.
+The partials of order less than $icode p$$ are computed using the
+same directions.
+
+$head f$$
+The object $icode f$$ has prototype
+$codei%
+    ADFun<%Base%> %f%
+%$$
+Note that the $cref ADFun$$ object $icode f$$ is not $code const$$
+(see $cref/Taylor Coefficients/dir_tensor/Taylor Coefficients/$$ below).
+
+$head p$$
+This is the highest order partial computed and must be greater than zero.
+
+$head x$$
+The size of $icode x$$ is $icode n$$, the dimension of the
+$cref/domain/fun_property/Domain/$$ space for $icode f$$.
+It specifies the point at which the partials are evaluated.
+
+$head s$$
+The size of $icode s$$ is $icode%n%*%r%$$ where $icode r$$
+is the number of directions and must be greater than zero.
+For $latex j = 0 , \ldots , n-1$$ and $latex \ell = 0 , \ldots , r-1$$,
+$latex \[
+    S_{j,\ell} = s [ j * r + \ell ]
+\] $$
+This is the same layout as is used for $icode xq$$ in
+$cref/Forward(q, r, xq)/forward_dir/$$.
+
+$head index$$
+The input size and value of the elements of $icode index$$ does not matter.
+Upon return, its size is $icode%K%*%r%$$ where $icode K$$ is the
+number of multi-indices $latex k \in \B{Z}_+^r$$ with
+$latex 1 \leq | k | \leq p$$.
+For $latex k = 0 , \ldots , K-1$$,
+the multi-index for the $th k$$ partial is
+$codei%
+    %index%[ %k% * %r% + 0 ] , %...% , %index%[ %k% * %r% + %r%-1 ]
+%$$
+The multi-indices are in order of increasing $latex | k |$$.
+
+$head dy$$
+The input size and value of the elements of $icode dy$$ does not matter.
+Upon return, its size is $icode%m%*%K%$$ and
+for $latex i = 0 , \ldots , m-1$$ and $latex k = 0 , \ldots , K-1$$,
+$latex \[
+    dy [ i * K + k ] = \frac{
+        \partial^{|k|} G_i
+    }{
+        \partial z_0^{k_0} \cdots \partial z_{r-1}^{k_{r-1}}
+    } (0)
+\] $$
+where $latex k_\ell$$ is $icode%index%[%k%*%r%+%ell%]%$$.
+
+$head BaseVector$$
+The type $icode BaseVector$$ must be a $cref SimpleVector$$ class with
+$cref/elements of type/SimpleVector/Elements of Specified Type/$$
+$icode Base$$.
+
+$head SizeVector$$
+The type $icode SizeVector$$ must be a $cref SimpleVector$$ class with
+$cref/elements of type/SimpleVector/Elements of Specified Type/$$
+$code size_t$$.
+
+$head Taylor Coefficients$$
+After this call,
+$icode%f%.size_order()%$$ is $icode%p%+1%$$ and
+$icode%f%.size_direction()%$$ is $latex R$$.
+
+$head Example$$
+$children%
+    example/general/dir_tensor.cpp
+%$$
+The file
+$cref dir_tensor.cpp$$
+contains an example and test of this operation.
+
+$end
+-----------------------------------------------------------------------------
+*/
+
+//  BEGIN CppAD namespace
+namespace CppAD {
+
+/*!
+\file dir_tensor.hpp
+Partial derivatives of order one through p in a subspace of directions.
+*/
+
+/*!
+Compute all the partials of F(x + S z) with respect to z of order one
+through p.
+
+\tparam Base
+base type for the operator; i.e., this operation sequence was recorded
+using AD< Base > and computations by this routine are done using type
+ Base.
+
+\tparam BaseVector
+is a Simple Vector class with elements of type Base.
+
+\tparam SizeVector
+is a Simple Vector class with elements of type size_t.
+
+\param p
+is the highest order partial computed.
+
+\param x
+is the argument value at which the partials are evaluated.
+
+\param s
+is the matrix of directions S in row major order.
+
+\param index
+is the vector of multi-indices (size K * r) for the partials.
+
+\param dy
+is the vector of partials (size m * K).
+*/
+// BEGIN_DIR_TENSOR
+template <class Base, class RecBase>
+template <class BaseVector, class SizeVector>
+void ADFun<Base,RecBase>::dir_tensor(
+    size_t            p     ,
+    const BaseVector& x     ,
+    const BaseVector& s     ,
+    SizeVector&       index ,
+    BaseVector&       dy    )
+// END_DIR_TENSOR
+{   // number of independent variables
+    size_t n = ind_taddr_.size();
+
+    // number of dependent variables
+    size_t m = dep_taddr_.size();
+
+    // number of directions in the subspace
+    size_t r = size_t(s.size()) / n;
+
+    // check BaseVector is Simple Vector class with Base type elements
+    CheckSimpleVector<Base, BaseVector>();
+
+    // check SizeVector is Simple Vector class with size_t elements
+    CheckSimpleVector<size_t, SizeVector>();
+
+    CPPAD_ASSERT_KNOWN(
+        p > 0,
+        "f.dir_tensor(p, x, s, index, dy): p is zero"
+    );
+    CPPAD_ASSERT_KNOWN(
+        size_t(x.size()) == n,
+        "f.dir_tensor(p, x, s, index, dy): x.size() is not equal n"
+    );
+    CPPAD_ASSERT_KNOWN(
+        r > 0 && size_t(s.size()) == n * r,
+        "f.dir_tensor(p, x, s, index, dy): s.size() is not n * r, r > 0"
+    );
+
+    // multi-indices with order one through p, in order of increasing order
+    // and within each order the exponent of the first direction decreasing
+    local::pod_vector<size_t> multi_index, order_start(p + 2);
+    {   local::pod_vector<size_t> k(r);
+        order_start[0] = 0;
+        order_start[1] = 0;
+        for(size_t d = 1; d <= p; ++d)
+        {   // first multi-index with order d
+            k[0] = d;
+            for(size_t ell = 1; ell < r; ++ell)
+                k[ell] = 0;
+            bool more = true;
+            while( more )
+            {   for(size_t ell = 0; ell < r; ++ell)
+                    multi_index.push_back( k[ell] );
+                // next multi-index with order d
+                size_t ell = r - 1;
+                while( ell > 0 && k[ell - 1] == 0 )
+                    --ell;
+                more = ell > 0;
+                if( more )
+                {   // move one from k[ell-1] to k[ell] and the rest of
+                    // the tail back to k[ell]
+                    size_t tail = k[r - 1];
+                    k[r - 1]    = 0;
+                    --k[ell - 1];
+                    k[ell] += tail + 1;
+                }
+            }
+            order_start[d + 1] = multi_index.size() / r;
+        }
+    }
+    size_t K = order_start[p + 1];
+
+    // the interpolation directions are the multi-indices with order p
+    size_t R = K - order_start[p];
+    const size_t* direction = multi_index.data() + order_start[p] * r;
+
+    // zero order forward mode
+    Forward(0, x);
+
+    // first order Taylor coefficients for independent variables: S * i
+    BaseVector xq(n * R);
+    for(size_t j = 0; j < n * R; ++j)
+        xq[j] = Base(0.0);
+    for(size_t ell = 0; ell < R; ++ell)
+    {   for(size_t k = 0; k < r; ++k) if( direction[ell * r + k] > 0 )
+        {   Base i_k( double( direction[ell * r + k] ) );
+            for(size_t j = 0; j < n; ++j)
+                xq[j * R + ell] += s[j * r + k] * i_k;
+        }
+    }
+
+    // Taylor coefficients of order one through p for each direction
+    // yq[ (d-1) * m * R + i * R + ell ]
+    local::pod_vector_maybe<Base> yq(p * m * R);
+    for(size_t d = 1; d <= p; ++d)
+    {   BaseVector yd = Forward(d, R, xq);
+        for(size_t i = 0; i < m * R; ++i)
+            yq[ (d-1) * m * R + i ] = yd[i];
+        if( d == 1 )
+        {   for(size_t j = 0; j < n * R; ++j)
+                xq[j] = Base(0.0);
+        }
+    }
+
+    // return values
+    index.resize(K * r);
+    for(size_t k = 0; k < K * r; ++k)
+        index[k] = multi_index[k];
+    dy.resize(m * K);
+    for(size_t i = 0; i < m * K; ++i)
+        dy[i] = Base(0.0);
+
+    // count[u * r + parts] = (u + parts) choose parts for u < p, parts < r
+    // (the number of multi-indices with parts + 1 components and order u)
+    local::pod_vector<size_t> count(p * r);
+    for(size_t parts = 0; parts < r; ++parts)
+    {   count[parts] = 1;
+        for(size_t u = 1; u < p; ++u)
+            count[u * r + parts] = count[(u-1) * r + parts] * (u + parts) / u;
+    }
+
+    // The interpolation coefficient gamma(i, j) is zero unless the support
+    // of the direction i is a subset of the support of the multi-index j.
+    // For each j, loop over the directions with support in the support of j
+    // and compute the partial as the sum of gamma(i, j) * y_d(i) where
+    // gamma(i, j) = sum_{0 < k <= j} (-1)^{|j| - |k|} binomial(j, k)
+    //               * binomial(p * k / |k|, i) * ( |k| / p )^{|j|}
+    local::pod_vector<size_t> support, k, c, sub_direction, sub_rank;
+    local::pod_vector<double> gamma;
+    for(size_t d = 1; d <= p; ++d)
+    {   const Base* y_d = yq.data() + (d-1) * m * R;
+        for(size_t jj = order_start[d]; jj < order_start[d + 1]; ++jj)
+        {   const size_t* j = multi_index.data() + jj * r;
+            //
+            // support of j
+            support.resize(0);
+            for(size_t ell = 0; ell < r; ++ell) if( j[ell] > 0 )
+                support.push_back(ell);
+            size_t n_supp = support.size();
+            //
+            // directions c with support in the support of j and their rank
+            // in the list of all directions
+            c.resize(n_supp);
+            c[0] = p;
+            for(size_t t = 1; t < n_supp; ++t)
+                c[t] = 0;
+            sub_direction.resize(0);
+            sub_rank.resize(0);
+            bool more = true;
+            while( more )
+            {   size_t rank = 0, rem = p, t = 0;
+                for(size_t ell = 0; ell + 1 < r && rem > 0; ++ell)
+                {   size_t i_ell = 0;
+                    if( t < n_supp && support[t] == ell )
+                        i_ell = c[t++];
+                    if( rem > i_ell )
+                        rank += count[ (rem - i_ell - 1) * r + (r - ell - 1) ];
+                    rem -= i_ell;
+                }
+                CPPAD_ASSERT_UNKNOWN( rank < R );
+                for(t = 0; t < n_supp; ++t)
+                {   sub_direction.push_back( c[t] );
+                    CPPAD_ASSERT_UNKNOWN(
+                        direction[rank * r + support[t]] == c[t]
+                    );
+                }
+                sub_rank.push_back(rank);
+                //
+                // next c
+                t = n_supp - 1;
+                while( t > 0 && c[t - 1] == 0 )
+                    --t;
+                more = t > 0;
+                if( more )
+                {   size_t tail = c[n_supp - 1];
+                    c[n_supp - 1] = 0;
+                    --c[t - 1];
+                    c[t] += tail + 1;
+                }
+            }
+            size_t n_sub = sub_rank.size();
+            gamma.resize(n_sub);
+            for(size_t i_sub = 0; i_sub < n_sub; ++i_sub)
+                gamma[i_sub] = 0.0;
+            //
+            // loop over 0 < k <= j using components in the support of j
+            k.resize(n_supp);
+            for(size_t t = 0; t < n_supp; ++t)
+                k[t] = 0;
+            more = true;
+            while( more )
+            {   size_t t = 0;
+                while( t < n_supp && k[t] == j[ support[t] ] )
+                    k[t++] = 0;
+                more = t < n_supp;
+                if( more )
+                {   ++k[t];
+                    //
+                    // (-1)^{|j| - |k|} binomial(j, k) ( |k| / p )^{|j|}
+                    size_t order_k = 0;
+                    double scale   = 1.0;
+                    for(t = 0; t < n_supp; ++t)
+                    {   size_t j_t = j[ support[t] ];
+                        order_k   += k[t];
+                        for(size_t u = 0; u < k[t]; ++u)
+                            scale *= double(j_t - u) / double(u + 1);
+                    }
+                    for(size_t u = 0; u < d; ++u)
+                        scale *= double(order_k) / double(p);
+                    if( (d - order_k) % 2 == 1 )
+                        scale = - scale;
+                    //
+                    // binomial(p * k / |k|, i)
+                    for(size_t i_sub = 0; i_sub < n_sub; ++i_sub)
+                    {   const size_t* i = sub_direction.data() + i_sub * n_supp;
+                        double term = scale;
+                        for(t = 0; t < n_supp; ++t)
+                        {   double a = double(p * k[t]) / double(order_k);
+                            for(size_t u = 0; u < i[t]; ++u)
+                                term *= (a - double(u)) / double(u + 1);
+                        }
+                        gamma[i_sub] += term;
+                    }
+                }
+            }
+            //
+            // partials for multi-index j
+            for(size_t i = 0; i < m; ++i)
+            {   Base sum(0.0);
+                for(size_t i_sub = 0; i_sub < n_sub; ++i_sub)
+                {   Base g( gamma[i_sub] );
+                    sum += g * y_d[i * R + sub_rank[i_sub] ];
+                }
+                dy[i * K + jj] = sum;
+            }
+        }
+    }
+    return;
+}
+
+} // END CppAD namespace
+
+# endif
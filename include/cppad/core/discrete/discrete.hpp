@@ -240,11 +240,11 @@ $end
             ay.taddr_   = tape->Rec_.put_dyn_par(
                 ay.value_, local::dis_dyn, addr_t(index_), ax.taddr_
             );
-            ay.tape_id_  = ax.tape_id_;
+            ay.set_tape_id(ax.tape_id_);
             ay.ad_type_  = dynamic_enum;
 
             // make result a dynamic parameter
-            ay.tape_id_    = tape->id_;
+            ay.set_tape_id(tape->id_);
             ay.ad_type_    = dynamic_enum;
 
             CPPAD_ASSERT_UNKNOWN( Dynamic(ay) );
@@ -263,7 +263,7 @@ $end
             // put operator in the tape
             ay.taddr_ = tape->Rec_.PutOp(local::DisOp);
             // make result a variable
-            ay.tape_id_    = tape->id_;
+            ay.set_tape_id(tape->id_);
             ay.ad_type_    = variable_enum;
 
             CPPAD_ASSERT_UNKNOWN( Variable(ay) );
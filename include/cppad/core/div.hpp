@@ -58,7 +58,7 @@ AD<Base> operator / (const AD<Base> &left , const AD<Base> &right)
             // put operator in the tape
             result.taddr_ = tape->Rec_.PutOp(local::DivvvOp);
             // make result a variable
-            result.tape_id_ = tape_id;
+            result.set_tape_id(tape_id);
             result.ad_type_ = variable_enum;
         }
         else if( (! dyn_right) & IdenticalOne(right.value_) )
@@ -78,7 +78,7 @@ AD<Base> operator / (const AD<Base> &left , const AD<Base> &right)
             // put operator in the tape
             result.taddr_ = tape->Rec_.PutOp(local::DivvpOp);
             // make result a variable
-            result.tape_id_ = tape_id;
+            result.set_tape_id(tape_id);
             result.ad_type_ = variable_enum;
         }
     }
@@ -99,7 +99,7 @@ AD<Base> operator / (const AD<Base> &left , const AD<Base> &right)
             // put operator in the tape
             result.taddr_ = tape->Rec_.PutOp(local::DivpvOp);
             // make result a variable
-            result.tape_id_ = tape_id;
+            result.set_tape_id(tape_id);
             result.ad_type_ = variable_enum;
         }
     }
@@ -115,7 +115,7 @@ AD<Base> operator / (const AD<Base> &left , const AD<Base> &right)
         result.taddr_   = tape->Rec_.put_dyn_par(
             result.value_, local::div_dyn,   arg0, arg1
         );
-        result.tape_id_ = tape_id;
+        result.set_tape_id(tape_id);
         result.ad_type_ = dynamic_enum;
     }
     return result;
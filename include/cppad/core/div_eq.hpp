@@ -100,7 +100,7 @@ AD<Base>& AD<Base>::operator /= (const AD<Base> &right)
             taddr_ = tape->Rec_.PutOp(local::DivpvOp);
 
             // make this a variable
-            tape_id_ = tape_id;
+            set_tape_id(tape_id);
             ad_type_ = variable_enum;
         }
     }
@@ -116,7 +116,7 @@ AD<Base>& AD<Base>::operator /= (const AD<Base> &right)
         taddr_ = tape->Rec_.put_dyn_par(
                 value_, local::div_dyn, arg0, arg1
         );
-        tape_id_ = tape_id;
+        set_tape_id(tape_id);
         ad_type_ = dynamic_enum;
     }
     return *this;
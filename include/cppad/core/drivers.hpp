@@ -16,7 +16,10 @@ in the Eclipse Public License, Version 2.0 are satisfied:
 # include <cppad/core/hessian.hpp>
 # include <cppad/core/for_one.hpp>
 # include <cppad/core/rev_one.hpp>
+# include <cppad/core/value_and_gradient.hpp>
 # include <cppad/core/for_two.hpp>
 # include <cppad/core/rev_two.hpp>
+# include <cppad/core/hes_dir.hpp>
+# include <cppad/core/dir_tensor.hpp>
 
 # endif
@@ -297,6 +297,7 @@ void ADFun<Base,RecBase>::for_jac_sparsity(
             transpose, dep_taddr_, for_jac_sparse_set_, pattern_out
         );
     }
+    memory_high_water();
     return;
 }
 
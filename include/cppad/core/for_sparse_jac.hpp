@@ -344,6 +344,7 @@ void ADFun<Base,RecBase>::ForSparseJacCase(
             j = *(++itr);
         }
     }
+    memory_high_water();
 }
 // ---------------------------------------------------------------------------
 /*!
@@ -493,6 +494,7 @@ void ADFun<Base,RecBase>::ForSparseJacCase(
             j = *(++itr_2);
         }
     }
+    memory_high_water();
 }
 // ---------------------------------------------------------------------------
 
@@ -757,6 +759,7 @@ void ADFun<Base,RecBase>::ForSparseJacCheckpoint(
     for(size_t i = 0; i < s.n_set(); ++i)
         s.process_post(i);
 
+    memory_high_water();
 }
 
 
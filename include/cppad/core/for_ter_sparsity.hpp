@@ -0,0 +1,297 @@
+# ifndef CPPAD_CORE_FOR_TER_SPARSITY_HPP
+# define CPPAD_CORE_FOR_TER_SPARSITY_HPP
+/* --------------------------------------------------------------------------
+CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-21 Bradley M. Bell
+
+CppAD is distributed under the terms of the
+             Eclipse Public License Version 2.0.
+
+This Source Code may also be made available under the following
+Secondary License when the conditions for such availability set forth
+in the Eclipse Public License, Version 2.0 are satisfied:
+      GNU General Public License, Version 2.0 or later.
+---------------------------------------------------------------------------- */
+/*
+$begin for_ter_sparsity$$
+$spell
+    Jacobian
+    Hessian
+    jac
+    hes
+    ter
+    bool
+    const
+    rc
+    cpp
+    nr
+    nc
+    nan
+$$
+
+$section Third Order Sparsity Patterns$$
+
+$head Syntax$$
+$icode%f%.for_ter_sparsity(
+    %x%, %select_range%, %internal_bool%, %pattern_out%
+)%$$
+
+$head Purpose$$
+We use $latex F : \B{R}^n \rightarrow \B{R}^m$$ to denote the
+$cref/AD function/glossary/AD Function/$$ corresponding to
+the operation sequence stored in $icode f$$.
+Fix a vector $latex s \in \B{R}^m$$ and define the third order tensor
+$latex \[
+    T_{i,j,k} (x) = \frac{ \partial^3 }
+    { \partial x_i \partial x_j \partial x_k } s^\R{T} F (x)
+\] $$
+Given the sparsity for $latex s$$,
+$code for_ter_sparsity$$ computes a sparsity pattern for $latex T(x)$$.
+
+$head Method$$
+The Hessian sparsity pattern for $latex s^\R{T} F(x)$$ is computed using
+$cref for_hes_sparsity$$.
+The possibly non-zero elements of the Hessian, on and below the diagonal,
+are recorded as a function of $latex x$$ using $cref base2ad$$.
+The forward mode Jacobian sparsity pattern for this function,
+see $cref for_jac_sparsity$$,
+determines which third partials are possibly non-zero.
+
+$head Tensor Storage$$
+A third order tensor $latex T \in \B{R}^{n \times n \times n}$$
+is stored as a matrix with $icode n$$ rows and $icode%n%*%n%$$ columns;
+i.e., the element $latex T_{i,j,k}$$ corresponds to
+row $icode i$$ and column $icode%j%*%n%+%k%$$.
+
+$head f$$
+The object $icode f$$ has prototype
+$codei%
+    ADFun<%Base%> %f%
+%$$
+The $cref/Taylor coefficients/glossary/Taylor Coefficient/$$
+stored in $icode f$$ are not affected by this operation.
+
+$head x$$
+This argument has prototype
+$codei%
+    const %BaseVector%& %x%
+%$$
+and its size is $icode n$$.
+The sparsity pattern corresponds to the operation sequence stored in
+$icode f$$ and does not depend on $icode x$$.
+The Hessian function mentioned under $cref/method/for_ter_sparsity/Method/$$
+is recorded at this point,
+so the values of $latex F(x)$$ and its derivatives must not be $code nan$$.
+
+$head select_range$$
+The argument $icode select_range$$ has prototype
+$codei%
+    const %BoolVector%& %select_range%
+%$$
+It has size $latex m$$ and specifies which components of the vector
+$latex s$$ are non-zero; i.e., $icode%select_range%[%i%]%$$ is true
+if and only if $latex s_i$$ is possibly non-zero.
+
+$head internal_bool$$
+If this is true, calculations are done with sets represented by a vector
+of boolean values. Otherwise, a vector of sets of integers is used.
+
+$head pattern_out$$
+This argument has prototype
+$codei%
+    sparse_rc<%SizeVector%>& %pattern_out%
+%$$
+This input value of $icode pattern_out$$ does not matter.
+Upon return $icode pattern_out$$ is a sparsity pattern for $latex T(x)$$
+using the $cref/tensor storage/for_ter_sparsity/Tensor Storage/$$ above;
+i.e., $icode%pattern_out%.nr() == %n%$$ and
+$icode%pattern_out%.nc() == %n%*%n%$$.
+The pattern is symmetric; i.e.,
+if $latex T_{i,j,k}$$ is in the pattern, so are all the permutations of
+the indices $latex (i, j, k)$$.
+
+$head Recording$$
+This routine records an $codei%AD<%Base%>%$$ operation sequence.
+It must not be called while such a recording is in progress.
+
+$head BaseVector$$
+The type $icode BaseVector$$ is a $cref SimpleVector$$ class with
+$cref/elements of type/SimpleVector/Elements of Specified Type/$$
+$icode Base$$.
+
+$head BoolVector$$
+The type $icode BoolVector$$ is a $cref SimpleVector$$ class with
+$cref/elements of type/SimpleVector/Elements of Specified Type/$$
+$code bool$$.
+
+$head SizeVector$$
+The type $icode SizeVector$$ is a $cref SimpleVector$$ class with
+$cref/elements of type/SimpleVector/Elements of Specified Type/$$
+$code size_t$$.
+
+$head Example$$
+The file $cref sparse_ter.cpp$$ contains an example and test
+of this operation.
+
+$end
+-----------------------------------------------------------------------------
+*/
+# include <cppad/core/ad_fun.hpp>
+# include <cppad/local/sparse/internal.hpp>
+
+namespace CppAD { // BEGIN_CPPAD_NAMESPACE
+
+/*!
+Forward mode third order sparsity pattern.
+
+\tparam Base
+is the base type for this recording.
+
+\tparam BaseVector
+is the simple vector with elements of type Base.
+
+\tparam BoolVector
+is the simple vector with elements of type bool.
+
+\tparam SizeVector
+is the simple vector with elements of type size_t.
+
+\param x
+is the point used to record the Hessian as a function of x.
+
+\param select_range
+is a sparsity pattern for for s.
+
+\param internal_bool
+If this is true, calculations are done with sets represented by a vector
+of boolean values. Otherwise, a vector of standard sets is used.
+
+\param pattern_out
+The return value is a sparsity pattern for T(x) where
+\f[
+    T_{i,j,k} (x) = \partial_i \partial_j \partial_k s^T F(x)
+\f]
+and T_{i,j,k} corresponds to row i and column j * n + k.
+*/
+template <class Base, class RecBase>
+template <class BaseVector, class BoolVector, class SizeVector>
+void ADFun<Base,RecBase>::for_ter_sparsity(
+    const BaseVector&            x                ,
+    const BoolVector&            select_range     ,
+    bool                         internal_bool    ,
+    sparse_rc<SizeVector>&       pattern_out      )
+{   size_t n  = Domain();
+    size_t m  = Range();
+    //
+    CPPAD_ASSERT_KNOWN(
+        size_t( x.size() ) == n,
+        "for_ter_sparsity: size of x is not equal to "
+        "number of independent variables"
+    );
+    CPPAD_ASSERT_KNOWN(
+        size_t( select_range.size() ) == m,
+        "for_ter_sparsity: size of select_range is not equal to "
+        "number of dependent variables"
+    );
+    //
+    // Hessian sparsity pattern for s^T F(x)
+    vector<bool> select_domain(n);
+    for(size_t j = 0; j < n; ++j)
+        select_domain[j] = true;
+    sparse_rc<SizeVector> hes_pattern;
+    for_hes_sparsity(select_domain, select_range, internal_bool, hes_pattern);
+    const SizeVector& hes_row( hes_pattern.row() );
+    const SizeVector& hes_col( hes_pattern.col() );
+    SizeVector        hes_col_major = hes_pattern.col_major();
+    size_t            hes_nnz       = hes_pattern.nnz();
+    //
+    // number of Hessian elements on or below the diagonal
+    size_t n_lower = 0;
+    for(size_t k = 0; k < hes_nnz; ++k)
+        if( hes_col[k] <= hes_row[k] )
+            ++n_lower;
+    if( n_lower == 0 )
+    {   pattern_out.resize(n, n * n, 0);
+        return;
+    }
+    //
+    // af: version of f that records on the AD<Base> tape
+    ADFun< AD<Base>, RecBase > af = base2ad();
+    //
+    // weights corresponding to s
+    vector< AD<Base> > aw(m);
+    for(size_t i = 0; i < m; ++i)
+        aw[i] = Base( select_range[i] ? 1.0 : 0.0 );
+    //
+    // record h(x), the lower triangle of the Hessian of s^T F(x)
+    vector< AD<Base> > ax(n), adx(n), adw(2 * n), ah(n_lower);
+    vector<size_t> h_row(n_lower), h_col(n_lower);
+    for(size_t j = 0; j < n; ++j)
+    {   ax[j]  = x[j];
+        adx[j] = Base(0.0);
+    }
+    Independent(ax);
+    af.Forward(0, ax);
+    size_t ell = 0;
+    size_t e   = 0;
+    while( ell < hes_nnz )
+    {   // column of the Hessian for this group of elements
+        size_t k = hes_col[ hes_col_major[ell] ];
+        adx[k]   = Base(1.0);
+        af.Forward(1, adx);
+        adw      = af.Reverse(2, aw);
+        adx[k]   = Base(0.0);
+        while( ell < hes_nnz && hes_col[ hes_col_major[ell] ] == k )
+        {   size_t i = hes_row[ hes_col_major[ell] ];
+            if( k <= i )
+            {   ah[e]    = adw[i * 2 + 1];
+                h_row[e] = i;
+                h_col[e] = k;
+                ++e;
+            }
+            ++ell;
+        }
+    }
+    CPPAD_ASSERT_UNKNOWN( e == n_lower );
+    ADFun<Base, RecBase> h(ax, ah);
+    //
+    // Jacobian sparsity pattern for h(x)
+    sparse_rc<SizeVector> identity(n, n, n);
+    for(size_t j = 0; j < n; ++j)
+        identity.set(j, j, j);
+    bool transpose  = false;
+    bool dependency = false;
+    sparse_rc<SizeVector> jac_pattern;
+    h.for_jac_sparsity(
+        identity, transpose, dependency, internal_bool, jac_pattern
+    );
+    //
+    // element (e, ell) of the Jacobian corresponds to T_{i,k,ell} and all
+    // its permutations where i = h_row[e] and k = h_col[e]
+    local::sparse::list_setvec internal_ter;
+    internal_ter.resize(n, n * n);
+    const SizeVector& jac_row( jac_pattern.row() );
+    const SizeVector& jac_col( jac_pattern.col() );
+    for(size_t k = 0; k < jac_pattern.nnz(); ++k)
+    {   size_t index[3];
+        index[0] = h_row[ jac_row[k] ];
+        index[1] = h_col[ jac_row[k] ];
+        index[2] = jac_col[k];
+        for(size_t p = 0; p < 3; ++p)
+        {   size_t q = (p + 1) % 3;
+            size_t r = (p + 2) % 3;
+            internal_ter.add_element(index[p], index[q] * n + index[r]);
+            internal_ter.add_element(index[p], index[r] * n + index[q]);
+        }
+    }
+    //
+    // convert internal_ter to pattern_out
+    local::pod_vector<size_t> internal_index(n);
+    for(size_t i = 0; i < n; ++i)
+        internal_index[i] = i;
+    local::sparse::get_internal_pattern(
+        transpose, internal_index, internal_ter, pattern_out
+    );
+    return;
+}
+} // END_CPPAD_NAMESPACE
+# endif
@@ -36,11 +36,16 @@ $section Multiple orders, one direction, forward mode Taylor coefficients$$
 $head Syntax$$
 $icode%yq% = %f%.Forward(%q%, %xq%, %s% )
 %$$
+$icode%f%.Forward(%q%, %xq%, %yq%, %s% )
+%$$
 
 $head Prototype$$
 $srcthisfile%
     0%// BEGIN_FORWARD_ORDER%// END_FORWARD_ORDER%1
 %$$
+$srcthisfile%
+    0%// BEGIN_FORWARD_ORDER_OUT%// END_FORWARD_ORDER_OUT%1
+%$$
 
 $head Base$$
 The type used during the forward mode computations; i.e., the corresponding
@@ -68,8 +73,9 @@ Is the stream where output corresponding to PriOp operations will written.
 
 $head yq$$
 contains Taylor coefficients for the dependent variables.
-The size of the return value $icode yq$$
+The return value (or argument) $icode yq$$
 has size $icode m*(q+1-p)$$.
+(In the argument case, $icode yq$$ is resized to this size.)
 For $icode i = 0, ... , m-1$$,
 $icode k = p, ..., q$$,
 $icode yq[(q+1-p)*i + (k-p)]$$
@@ -99,6 +105,19 @@ BaseVector ADFun<Base,RecBase>::Forward(
     const BaseVector&   xq        ,
           std::ostream& s         )
 // END_FORWARD_ORDER
+{   BaseVector yq;
+    Forward(q, xq, yq, s);
+    return yq;
+}
+// BEGIN_FORWARD_ORDER_OUT
+template <class Base, class RecBase>
+template <class BaseVector>
+void ADFun<Base,RecBase>::Forward(
+    size_t              q         ,
+    const BaseVector&   xq        ,
+          BaseVector&   yq        ,
+          std::ostream& s         )
+// END_FORWARD_ORDER_OUT
 {
     // used to identify the RecBase type in calls to sweeps
     RecBase not_used_rec_base(0.0);
@@ -207,7 +226,7 @@ BaseVector ADFun<Base,RecBase>::Forward(
     }
 
     // return Taylor coefficients for dependent variables
-    BaseVector yq;
+    // (resize does not allocate memory if yq already has this size)
     if( p == q )
     {   yq.resize(m);
         for(i = 0; i < m; i++)
@@ -288,7 +307,7 @@ BaseVector ADFun<Base,RecBase>::Forward(
     // now we have q + 1  taylor_ coefficient orders per variable
     num_order_taylor_ = q + 1;
 
-    return yq;
+    return;
 }
 /*
 --------------------------------------- ---------------------------------------
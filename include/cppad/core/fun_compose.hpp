@@ -0,0 +1,173 @@
+# ifndef CPPAD_CORE_FUN_COMPOSE_HPP
+# define CPPAD_CORE_FUN_COMPOSE_HPP
+/* --------------------------------------------------------------------------
+CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-21 Bradley M. Bell
+
+CppAD is distributed under the terms of the
+             Eclipse Public License Version 2.0.
+
+This Source Code may also be made available under the following
+Secondary License when the conditions for such availability set forth
+in the Eclipse Public License, Version 2.0 are satisfied:
+      GNU General Public License, Version 2.0 or later.
+---------------------------------------------------------------------------- */
+# include <cppad/local/graph/append_op.hpp>
+/*
+$begin fun_compose$$
+$spell
+    const
+    dyn
+    ind
+    Vec
+    chkpoint
+$$
+
+$section Compose Two ADFun Objects Without Re-Recording$$
+
+$head Syntax$$
+$icode%h%.compose(%g%, %f%)%$$
+
+$head Purpose$$
+Given the operation sequences for $latex f : \B{R}^n \rightarrow \B{R}^m$$
+and $latex g : \B{R}^m \rightarrow \B{R}^\ell$$,
+this creates the operation sequence for
+$latex \[
+    h(x) = g[ f(x) ]
+\] $$
+The operations in $icode f$$ and $icode g$$ are copied directly to $icode h$$.
+This avoids evaluating $icode f$$ and $icode g$$ using $codei%AD<%Base%>%$$
+to record $icode h$$
+and it avoids the overhead of using $icode f$$ or $icode g$$
+as an atomic function; e.g., $cref chkpoint_two$$.
+
+$head h$$
+The object $icode h$$ has prototype
+$codei%
+    ADFun<%Base%> %h%
+%$$
+The previous operation sequence in $icode h$$ is lost.
+
+$head g$$
+The object $icode g$$ has prototype
+$codei%
+    ADFun<%Base%>& %g%
+%$$
+Its $cref/domain/fun_property/Domain/$$ size must be equal to the
+$cref/range/fun_property/Range/$$ size for $icode f$$.
+
+$head f$$
+The object $icode f$$ has prototype
+$codei%
+    ADFun<%Base%>& %f%
+%$$
+The objects $icode f$$ and $icode g$$ are not const because their
+$cref/to_graph/to_graph/$$ member function is used.
+
+$head Dynamic Parameters$$
+Let $icode nf$$ ($icode ng$$) be the number of
+$cref/independent dynamic parameters/fun_property/size_dyn_ind/$$
+in $icode f$$ ($icode g$$).
+The independent dynamic parameters in $icode h$$ are
+the ones for $icode f$$ followed by the ones for $icode g$$; i.e.,
+$codei%
+    %h%.size_dyn_ind() == %nf% + %ng%
+%$$
+The constant parameters in $icode f$$ and $icode g$$ are included in $icode h$$.
+
+$head Optimize$$
+Operations in $icode f$$ that do not affect the value of $icode h$$ are
+included in $icode h$$.
+These can be removed by calling $icode%h%.optimize()%$$; see $cref optimize$$.
+
+$head Restrictions$$
+The operation sequences are combined using the
+$cref/C++ AD graph/cpp_ad_graph/$$ representation of
+$icode f$$ and $icode g$$.
+Thus they cannot contain operators that are
+$cref/missing/graph_op_enum/Missing Operators/$$ from that representation;
+e.g., $cref VecAD$$ operations.
+
+$head Example$$
+$children%
+    example/graph/fun_compose.cpp
+%$$
+The file $cref fun_compose.cpp$$
+contains an example and test of this operation.
+
+$end
+*/
+
+namespace CppAD { // BEGIN_CPPAD_NAMESPACE
+
+/// set this function to g[ f(x) ]; see fun_compose
+template <class Base, class RecBase>
+void ADFun<Base,RecBase>::compose(ADFun& g, ADFun& f)
+{   CPPAD_ASSERT_KNOWN(
+        g.Domain() == f.Range(),
+        "h.compose(g, f): g.Domain() is not equal to f.Range()"
+    );
+    cpp_graph f_graph, g_graph;
+    f.to_graph(f_graph);
+    g.to_graph(g_graph);
+    //
+    size_t nf_dyn = f_graph.n_dynamic_ind_get();
+    size_t ng_dyn = g_graph.n_dynamic_ind_get();
+    size_t n_dyn  = nf_dyn + ng_dyn;
+    size_t n_var  = f_graph.n_variable_ind_get();
+    size_t m_var  = g_graph.n_variable_ind_get();
+    size_t nf_con = f_graph.constant_vec_size();
+    size_t ng_con = g_graph.constant_vec_size();
+    //
+    // graph for the result
+    cpp_graph graph_obj;
+    graph_obj.n_dynamic_ind_set(n_dyn);
+    graph_obj.n_variable_ind_set(n_var);
+    //
+    // constants for f and g come before any of the operators
+    for(size_t i = 0; i < nf_con; ++i)
+        graph_obj.constant_vec_push_back( f_graph.constant_vec_get(i) );
+    for(size_t i = 0; i < ng_con; ++i)
+        graph_obj.constant_vec_push_back( g_graph.constant_vec_get(i) );
+    size_t n_node = n_dyn + n_var + nf_con + ng_con;
+    //
+    // operators in f
+    vector<size_t> node_map(1 + nf_dyn + n_var + nf_con);
+    node_map[0] = 0;
+    for(size_t i = 1; i <= nf_dyn; ++i)
+        node_map[i] = i;
+    for(size_t j = 1; j <= n_var; ++j)
+        node_map[nf_dyn + j] = n_dyn + j;
+    for(size_t i = 0; i < nf_con; ++i)
+        node_map[1 + nf_dyn + n_var + i] = 1 + n_dyn + n_var + i;
+    local::graph::append_op(graph_obj, f_graph, node_map, n_node);
+    //
+    // nodes in h corresponding to the dependents in f
+    vector<size_t> f_dep(m_var);
+    for(size_t i = 0; i < m_var; ++i)
+        f_dep[i] = node_map[ f_graph.dependent_vec_get(i) ];
+    //
+    // operators in g
+    node_map.resize(1 + ng_dyn + m_var + ng_con);
+    node_map[0] = 0;
+    for(size_t i = 1; i <= ng_dyn; ++i)
+        node_map[i] = nf_dyn + i;
+    for(size_t j = 1; j <= m_var; ++j)
+        node_map[ng_dyn + j] = f_dep[j - 1];
+    for(size_t i = 0; i < ng_con; ++i)
+        node_map[1 + ng_dyn + m_var + i] = 1 + n_dyn + n_var + nf_con + i;
+    local::graph::append_op(graph_obj, g_graph, node_map, n_node);
+    //
+    // dependents in g
+    size_t n_dep = g_graph.dependent_vec_size();
+    for(size_t i = 0; i < n_dep; ++i)
+        graph_obj.dependent_vec_push_back(
+            node_map[ g_graph.dependent_vec_get(i) ]
+        );
+    //
+    from_graph(graph_obj);
+    return;
+}
+
+} // END_CPPAD_NAMESPACE
+
+# endif
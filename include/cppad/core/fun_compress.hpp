@@ -0,0 +1,132 @@
+# ifndef CPPAD_CORE_FUN_COMPRESS_HPP
+# define CPPAD_CORE_FUN_COMPRESS_HPP
+/* --------------------------------------------------------------------------
+CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-21 Bradley M. Bell
+
+CppAD is distributed under the terms of the
+             Eclipse Public License Version 2.0.
+
+This Source Code may also be made available under the following
+Secondary License when the conditions for such availability set forth
+in the Eclipse Public License, Version 2.0 are satisfied:
+      GNU General Public License, Version 2.0 or later.
+---------------------------------------------------------------------------- */
+/*
+$begin fun_compress$$
+$spell
+    const
+    bool
+    op
+    seq
+    decompressed
+    subgraph
+    alloc
+$$
+
+$section Compress the Operation Sequence of an ADFun Object$$
+
+$head Syntax$$
+$icode%f%.compress()
+%$$
+$icode%f%.decompress()
+%$$
+$icode%b% = %f%.compressed()
+%$$
+$icode%s% = %f%.size_op_seq_decompressed()
+%$$
+
+$head Purpose$$
+An application may keep a large number of $code ADFun$$ objects
+where only a few of them are being used at any one time.
+The $code compress$$ operation reduces the memory used to store
+the operation sequence for the functions that are not being used.
+
+$head f$$
+The object $icode f$$ has prototype
+$codei%
+    ADFun<%Base%> %f%
+%$$
+It is $code const$$ for the $code compressed$$ and
+$code size_op_seq_decompressed$$ syntax.
+
+$head compress$$
+This encodes the arguments for each operator in the operation sequence
+using a variable length code.
+Arguments that are variables are coded relative to the
+operator that uses them, so most arguments only require one byte.
+The operators already use one byte each and the parameters
+are not changed by this operation.
+If $icode f$$ is already compressed, this operation has no effect.
+
+$head Using a Compressed Function$$
+All of the $code ADFun$$ operations can be used when $icode f$$ is
+compressed and they give the same results.
+The $cref/forward/Forward/$$, $cref/reverse/Reverse/$$,
+and sparsity pattern calculations decode the arguments as they go,
+so they take longer but do not use any extra memory.
+Operations that require random access to the operation sequence,
+e.g., $cref optimize$$ and $cref subgraph_reverse$$,
+create a temporary uncompressed copy of the arguments that is included in
+$cref/size_random/fun_property/size_random/$$.
+
+$head decompress$$
+This undoes the $code compress$$ operation so that the arguments
+are no longer decoded during each use of $icode f$$.
+If $icode f$$ is not compressed, this operation has no effect.
+
+$head compressed$$
+The return value $icode b$$ has prototype
+$codei%
+    bool %b%
+%$$
+It is true (false) if $icode f$$ is (is not) currently compressed.
+
+$head size_op_seq_decompressed$$
+The return value $icode s$$ has prototype
+$codei%
+    size_t %s%
+%$$
+It is the value that $cref/size_op_seq/fun_property/size_op_seq/$$
+will have after $icode f$$ is decompressed.
+If $icode f$$ is compressed, $icode%f%.size_op_seq()%$$
+is the number of bytes currently used to store the operation sequence.
+
+$head Memory$$
+The memory freed by $code compress$$ is returned to $cref thread_alloc$$.
+Use $cref/free_available/ta_free_available/$$ to return it to the system.
+
+$head Example$$
+$children%
+    example/general/fun_compress.cpp
+%$$
+The file $cref fun_compress.cpp$$
+contains an example and test of these operations.
+
+$end
+*/
+
+namespace CppAD { // BEGIN_CPPAD_NAMESPACE
+
+/// compress the operator arguments; see player::compress
+template <class Base, class RecBase>
+void ADFun<Base,RecBase>::compress(void)
+{   play_.compress(); }
+
+/// undo compress; see player::decompress
+template <class Base, class RecBase>
+void ADFun<Base,RecBase>::decompress(void)
+{   play_.decompress(); }
+
+/// are the operator arguments compressed
+template <class Base, class RecBase>
+bool ADFun<Base,RecBase>::compressed(void) const
+{   return play_.compressed(); }
+
+/// size_op_seq after the operator arguments are decompressed
+template <class Base, class RecBase>
+size_t ADFun<Base,RecBase>::size_op_seq_decompressed(void) const
+{   return play_.size_op_seq_decompressed(); }
+
+} // END_CPPAD_NAMESPACE
+
+# endif
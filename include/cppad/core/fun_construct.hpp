@@ -265,18 +265,20 @@ num_order_taylor_(0),
 cap_order_taylor_(0),
 num_direction_taylor_(0),
 num_var_tape_(0)
-{ }
+{   fun_registry::insert(this, memory_report_void); }
 //
 // move semantics version of constructor
 // (none of the defualt constructor values matter to the destructor)
 template <class Base, class RecBase>
 ADFun<Base,RecBase>::ADFun(ADFun&& f)
-{   swap(f); }
+{   fun_registry::insert(this, memory_report_void);
+    swap(f);
+}
 //
 // destructor
 template <class Base, class RecBase>
 ADFun<Base,RecBase>::~ADFun(void)
-{ }
+{   fun_registry::erase(this); }
 /*!
 ADFun assignment operator
 
@@ -328,6 +330,8 @@ void ADFun<Base,RecBase>::operator=(const ADFun& f)
     // pod_vector_maybe_vectors
     taylor_                    = f.taylor_;
     subgraph_partial_          = f.subgraph_partial_;
+    hes_dir_taylor_            = f.hes_dir_taylor_;
+    reverse_partial_           = f.reverse_partial_;
     //
     // player
     play_                      = f.play_;
@@ -340,6 +344,9 @@ void ADFun<Base,RecBase>::operator=(const ADFun& f)
     //
     // sparse_list
     for_jac_sparse_set_        = f.for_jac_sparse_set_;
+    //
+    // memory high water mark
+    memory_high_water_         = f.memory_high_water_;
 }
 /// swap
 template <class Base, class RecBase>
@@ -370,6 +377,11 @@ void ADFun<Base,RecBase>::swap(ADFun& f)
     cskip_op_.swap(       f.cskip_op_);
     load_op2var_.swap(    f.load_op2var_);
     //
+    // work space
+    subgraph_partial_.swap( f.subgraph_partial_);
+    hes_dir_taylor_.swap(   f.hes_dir_taylor_);
+    reverse_partial_.swap(  f.reverse_partial_);
+    //
     // player
     play_.swap(f.play_);
     //
@@ -381,6 +393,9 @@ void ADFun<Base,RecBase>::swap(ADFun& f)
     //
     // sparse_list
     for_jac_sparse_set_.swap( f.for_jac_sparse_set_);
+    //
+    // memory high water mark
+    std::swap( memory_high_water_, f.memory_high_water_);
 }
 /// Move semantics version of constructor and assignment
 template <class Base, class RecBase>
@@ -536,6 +551,9 @@ ADFun<Base,RecBase>::ADFun(const ADVector &x, const ADVector &y)
         );
     }
 # endif
+    //
+    // record this object in the registry (if it is enabled)
+    fun_registry::insert(this, memory_report_void);
 }
 
 } // END_CPPAD_NAMESPACE
@@ -0,0 +1,226 @@
+# ifndef CPPAD_CORE_FUN_REGISTRY_HPP
+# define CPPAD_CORE_FUN_REGISTRY_HPP
+/* --------------------------------------------------------------------------
+CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-21 Bradley M. Bell
+
+CppAD is distributed under the terms of the
+             Eclipse Public License Version 2.0.
+
+This Source Code may also be made available under the following
+Secondary License when the conditions for such availability set forth
+in the Eclipse Public License, Version 2.0 are satisfied:
+      GNU General Public License, Version 2.0 or later.
+---------------------------------------------------------------------------- */
+/*
+$begin fun_registry$$
+$spell
+    const
+    bool
+    std
+$$
+
+$section Registry of Live ADFun Objects$$
+
+$head Syntax$$
+$codei%fun_registry::enable(%value%)
+%$$
+$icode%b% = fun_registry::enabled()
+%$$
+$icode%list% = fun_registry::list()
+%$$
+
+$head Purpose$$
+The $cref memory_report$$ for one $code ADFun$$ object does not
+say how much memory all of the functions in a program are using.
+When the registry is enabled, every $code ADFun$$ object that is
+constructed is recorded in the registry until it is destroyed.
+This includes the $code ADFun$$ objects inside of checkpoint functions.
+
+$head enable$$
+The argument $icode value$$ has prototype
+$codei%
+    bool %value%
+%$$
+If it is true, $code ADFun$$ objects constructed after this call
+are recorded in the registry.
+If it is false, the registry is cleared and no $code ADFun$$ objects
+are recorded.
+By default (when $code enable$$ has not been called)
+the registry is not enabled.
+This routine cannot be called in
+$cref/parallel/ta_in_parallel/$$ execution mode.
+
+$head enabled$$
+The return value $icode b$$ has prototype
+$codei%
+    bool %b%
+%$$
+It is true (false) if the registry is (is not) enabled.
+
+$head list$$
+The return value has prototype
+$codei%
+    std::vector<fun_memory> %list%
+%$$
+Its size is the number of $code ADFun$$ objects in the registry.
+Each element is the $cref memory_report$$ for one of these objects
+(the order of the elements is not specified).
+None of the functions in the registry can be in use by another
+thread during this call.
+
+$head Thread Safety$$
+$code ADFun$$ objects can be constructed and destroyed by different
+threads at the same time;
+i.e., the registry uses a lock when an object is added or removed.
+
+$head Example$$
+$cref memory_report.cpp$$
+
+$end
+*/
+# include <map>
+# include <mutex>
+# include <string>
+# include <vector>
+# include <algorithm>
+# include <cppad/core/cppad_assert.hpp>
+# include <cppad/local/define.hpp>
+# include <cppad/utility/thread_alloc.hpp>
+
+namespace CppAD { // BEGIN_CPPAD_NAMESPACE
+
+/// number of bytes used by each component of an ADFun object;
+/// see memory_report
+class fun_memory_size {
+public:
+    /// operation sequence (not including dynamic parameter information)
+    size_t op_seq;
+    /// dynamic parameter information in the operation sequence
+    size_t dynamic;
+    /// random access information for the operation sequence
+    size_t random;
+    /// Taylor coefficients
+    size_t taylor;
+    /// forward mode Jacobian sparsity patterns
+    size_t sparsity;
+    /// subgraph information
+    size_t subgraph;
+    /// other work space
+    size_t work;
+    /// sum of the components above
+    size_t total;
+    /// ctor
+    fun_memory_size(void)
+    : op_seq(0), dynamic(0), random(0), taylor(0),
+      sparsity(0), subgraph(0), work(0), total(0)
+    { }
+    /// set each component to the maximum of its value and the other value
+    void max(const fun_memory_size& other)
+    {   op_seq   = std::max(op_seq,   other.op_seq);
+        dynamic  = std::max(dynamic,  other.dynamic);
+        random   = std::max(random,   other.random);
+        taylor   = std::max(taylor,   other.taylor);
+        sparsity = std::max(sparsity, other.sparsity);
+        subgraph = std::max(subgraph, other.subgraph);
+        work     = std::max(work,     other.work);
+        total    = std::max(total,    other.total);
+    }
+};
+
+/// memory report for an ADFun object; see memory_report
+class fun_memory {
+public:
+    /// name of the function
+    std::string     function_name;
+    /// current number of bytes for each component
+    fun_memory_size current;
+    /// maximum number of bytes for each component
+    fun_memory_size high_water;
+};
+
+/// registry of the live ADFun objects; see fun_registry
+class fun_registry {
+public:
+    /// function that computes the memory report for an ADFun object
+    typedef fun_memory (*report_fn)(const void* fun);
+private:
+    /// Set and get the enabled flag
+    static bool set_get_enabled(bool set, bool new_value = false)
+    {   static bool value = false;
+        if( set )
+            value = new_value;
+        return value;
+    }
+    /// lock used when changing the registry
+    static std::mutex& lock(void)
+    {   static std::mutex mutex;
+        return mutex;
+    }
+    /// map from the address of each ADFun object to its report function
+    static std::map<const void*, report_fn>& registry(void)
+    {   static std::map<const void*, report_fn> map;
+        return map;
+    }
+public:
+    /*!
+    Enable or disable the registry.
+
+    \param value [in]
+    if true (false) the registry is enabled (disabled).
+    If it is false, the registry is also cleared.
+    */
+    static void enable(bool value)
+    {   CPPAD_ASSERT_KNOWN(
+            ! thread_alloc::in_parallel() ,
+            "fun_registry::enable: in parallel mode."
+        );
+        std::lock_guard<std::mutex> guard( lock() );
+        if( ! value )
+            registry().clear();
+        set_get_enabled(true, value);
+    }
+    /// is the registry enabled
+    static bool enabled(void)
+    {   return set_get_enabled(false); }
+    /*!
+    Add an ADFun object to the registry (if it is enabled).
+
+    \param fun [in]
+    is the address of the ADFun object.
+
+    \param report [in]
+    computes the memory report for this ADFun object.
+    */
+    static void insert(const void* fun, report_fn report)
+    {   if( ! enabled() )
+            return;
+        std::lock_guard<std::mutex> guard( lock() );
+        registry()[fun] = report;
+    }
+    /*!
+    Remove an ADFun object from the registry (if it is there).
+
+    \param fun [in]
+    is the address of the ADFun object.
+    */
+    static void erase(const void* fun)
+    {   if( ! enabled() )
+            return;
+        std::lock_guard<std::mutex> guard( lock() );
+        registry().erase(fun);
+    }
+    /// memory reports for all the ADFun objects in the registry
+    static std::vector<fun_memory> list(void)
+    {   std::lock_guard<std::mutex> guard( lock() );
+        std::vector<fun_memory> result;
+        result.reserve( registry().size() );
+        std::map<const void*, report_fn>::const_iterator itr;
+        for(itr = registry().begin(); itr != registry().end(); ++itr)
+            result.push_back( (itr->second)(itr->first) );
+        return result;
+    }
+};
+
+} // END_CPPAD_NAMESPACE
+
+# endif
@@ -0,0 +1,456 @@
+# ifndef CPPAD_CORE_FUN_SPLICE_HPP
+# define CPPAD_CORE_FUN_SPLICE_HPP
+/* --------------------------------------------------------------------------
+CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-21 Bradley M. Bell
+
+CppAD is distributed under the terms of the
+             Eclipse Public License Version 2.0.
+
+This Source Code may also be made available under the following
+Secondary License when the conditions for such availability set forth
+in the Eclipse Public License, Version 2.0 are satisfied:
+      GNU General Public License, Version 2.0 or later.
+---------------------------------------------------------------------------- */
+/*
+$begin fun_splice$$
+$spell
+    const
+    dyn
+    ind
+    Vec
+    openmp
+$$
+
+$section Splice Separately Recorded Functions Into One ADFun Object$$
+
+$head Syntax$$
+$icode%f%.splice(%block%)%$$
+
+$head Purpose$$
+Suppose that a function is made up of blocks
+$latex \[
+    f(x) = \left( \begin{array}{c}
+        g_0 (x) \\ \vdots \\ g_{N-1} (x)
+    \end{array} \right)
+\] $$
+where each $latex g_k : \B{R}^n \rightarrow \B{R}^{m_k}$$.
+Recording each block is independent of the others,
+so the blocks can be recorded in parallel; see below.
+The $code splice$$ operation combines the blocks into one function
+with one set of independent variables and one operation sequence.
+
+$head f$$
+The object $icode f$$ has prototype
+$codei%
+    ADFun<%Base%> %f%
+%$$
+The previous operation sequence in $icode f$$ is lost.
+Upon return it contains the operation sequence for the function above.
+
+$head block$$
+The argument $icode block$$ has prototype
+$codei%
+    const %FunVector%& %block%
+%$$
+and $icode%block%.size()%$$ is the number of blocks $latex N > 0$$.
+The element $icode%block%[%k%]%$$ is an $codei%ADFun<%Base%>%$$ object
+that contains the operation sequence for $latex g_k$$.
+All the blocks must have the same
+$cref/domain/fun_property/Domain/$$ size $latex n$$
+and the same number of
+$cref/independent dynamic parameters/fun_property/size_dyn_ind/$$.
+
+$head Range$$
+The range of $icode f$$ is the concatenation of the ranges of the blocks;
+i.e., $icode%f%.Range()%$$ is the sum of $icode%block%[%k%].Range()%$$.
+
+$head Dynamic Parameters$$
+The independent dynamic parameters in $icode f$$ correspond to the
+independent dynamic parameters in each of the blocks.
+Their values in $icode f$$ are the values in $icode%block%[0]%$$.
+If the blocks were recorded with different values,
+use $cref new_dynamic$$ to set the values for $icode f$$
+before computing with it.
+The constant parameters in all the blocks are included in $icode f$$.
+
+$head Method$$
+The operation sequence for each block is copied directly into
+the operation sequence for $icode f$$.
+The variables, parameters, $cref VecAD$$ vectors and text in each block
+are renumbered so that they follow the ones for the previous blocks.
+
+$head Parallel Recording$$
+Each thread has its own tape; see $cref parallel_ad$$.
+Hence, after $code parallel_ad<%Base%>()%$$ has been called,
+each block can be recorded in parallel by a different thread
+and then $icode f$$ can be formed by the master thread using $code splice$$.
+The file $cref team_splice.cpp$$ records the blocks this way.
+
+$head Conditional Skip$$
+If a block has been $cref/optimized/optimize/$$,
+its conditional skip operations are not copied to $icode f$$.
+Use $codei%%f%.optimize()%$$ to recreate them.
+
+$head Example$$
+$children%
+    example/graph/fun_splice.cpp
+%$$
+The file $cref fun_splice.cpp$$
+contains an example and test of this operation.
+
+$end
+*/
+
+namespace CppAD { // BEGIN_CPPAD_NAMESPACE
+
+/// splice separately recorded blocks into one function; see fun_splice
+template <class Base, class RecBase>
+template <class FunVector>
+void ADFun<Base,RecBase>::splice(const FunVector& block)
+{   using local::pod_vector;
+    using local::opcode_t;
+    //
+    size_t n_block = size_t( block.size() );
+    CPPAD_ASSERT_KNOWN(
+        n_block > 0,
+        "f.splice(block): block.size() is zero"
+    );
+    size_t n_dyn = block[0].size_dyn_ind();
+    size_t n     = block[0].Domain();
+    for(size_t k = 0; k < n_block; ++k)
+    {   CPPAD_ASSERT_KNOWN(
+            block[k].size_dyn_ind() == n_dyn && block[k].Domain() == n,
+            "f.splice(block): blocks do not have the same number of "
+            "independent dynamic parameters and variables"
+        );
+    }
+    //
+    // place to store the spliced recording
+    local::recorder<Base> rec;
+    rec.set_num_dynamic_ind(n_dyn);
+    rec.set_abort_op_index(0);
+    rec.set_record_compare(true);
+    //
+    // BeginOp and the independent variables are shared by all the blocks
+    CPPAD_ASSERT_NARG_NRES(local::BeginOp, 1, 1);
+    CPPAD_ASSERT_NARG_NRES(local::InvOp, 0, 1);
+    rec.PutOp(local::BeginOp);
+    rec.PutArg(0);
+    for(size_t j = 0; j < n; ++j)
+        rec.PutOp(local::InvOp);
+    //
+    // parameter index zero and the independent dynamic parameters
+    const local::player<Base>& play_0( block[0].play_ );
+    rec.put_con_par( play_0.GetPar(0) );
+    for(size_t i_par = 1; i_par <= n_dyn; ++i_par)
+        rec.put_dyn_par( play_0.GetPar(i_par), local::ind_dyn );
+    //
+    // dependent variable information for the spliced recording
+    pod_vector<size_t> dep_taddr;
+    pod_vector<bool>   dep_parameter;
+    //
+    // mappings from block indices to spliced indices
+    pod_vector<addr_t> new_par;
+    pod_vector<addr_t> new_var;
+    //
+    // work space
+    pod_vector<addr_t> arg_vec;
+    pod_vector<bool>   is_var;
+    //
+    for(size_t k = 0; k < n_block; ++k)
+    {   const local::player<Base>& play( block[k].play_ );
+        //
+        // dynamic parameter information for this block
+        const pod_vector<bool>&     dyn_par_is( play.dyn_par_is() );
+        const pod_vector<opcode_t>& dyn_par_op( play.dyn_par_op() );
+        const pod_vector<addr_t>&   dyn_par_arg( play.dyn_par_arg() );
+        //
+        // new_par for the independent dynamic parameters
+        size_t num_par = play.num_par_rec();
+        new_par.resize(num_par);
+        for(size_t i_par = 0; i_par <= n_dyn; ++i_par)
+            new_par[i_par] = addr_t( i_par );
+        //
+        // new_par for the constant parameters
+        // (atomic function results can refer to later constants)
+        for(size_t i_par = n_dyn + 1; i_par < num_par; ++i_par)
+        if( ! dyn_par_is[i_par] )
+            new_par[i_par] = rec.put_con_par( play.GetPar(i_par) );
+        //
+        // new_par for the dependent dynamic parameters
+        size_t i_dyn = n_dyn;
+        size_t i_arg = 0;
+        for(size_t i_par = n_dyn + 1; i_par < num_par; ++i_par)
+        if( dyn_par_is[i_par] )
+        {   local::op_code_dyn op = local::op_code_dyn( dyn_par_op[i_dyn] );
+            const addr_t* arg     = dyn_par_arg.data() + i_arg;
+            size_t n_arg          = local::num_arg_dyn(op);
+            Base   par            = play.GetPar(i_par);
+            switch( op )
+            {
+                case local::atom_dyn:
+                {   size_t atom_n = size_t( arg[1] );
+                    size_t atom_m = size_t( arg[2] );
+                    n_arg         = 5 + atom_n + atom_m;
+                    arg_vec.resize(0);
+                    for(size_t i = 0; i < 4; ++i)
+                        arg_vec.push_back( arg[i] );
+                    for(size_t j = 0; j < atom_n; ++j)
+                        arg_vec.push_back( new_par[ arg[4 + j] ] );
+                    bool first_dynamic_result = true;
+                    for(size_t i = 0; i < atom_m; ++i)
+                    {   addr_t res_i = arg[4 + atom_n + i];
+                        if( dyn_par_is[res_i] )
+                        {   local::op_code_dyn res_op = local::result_dyn;
+                            if( first_dynamic_result )
+                                res_op = local::atom_dyn;
+                            first_dynamic_result = false;
+                            new_par[res_i] = rec.put_dyn_par(
+                                play.GetPar( size_t(res_i) ), res_op
+                            );
+                        }
+                        arg_vec.push_back( new_par[res_i] );
+                    }
+                    arg_vec.push_back( addr_t( n_arg ) );
+                    rec.put_dyn_arg_vec( arg_vec );
+                }
+                break;
+
+                case local::result_dyn:
+                // new_par was set by the corresponding atom_dyn
+                CPPAD_ASSERT_UNKNOWN( n_arg == 0 );
+                break;
+
+                case local::cond_exp_dyn:
+                CPPAD_ASSERT_UNKNOWN( n_arg == 5 );
+                new_par[i_par] = rec.put_dyn_cond_exp(
+                    par                  ,
+                    CompareOp( arg[0] )  ,
+                    new_par[ arg[1] ]    ,
+                    new_par[ arg[2] ]    ,
+                    new_par[ arg[3] ]    ,
+                    new_par[ arg[4] ]
+                );
+                break;
+
+                case local::dis_dyn:
+                CPPAD_ASSERT_UNKNOWN( n_arg == 2 );
+                new_par[i_par] = rec.put_dyn_par(
+                    par, op, arg[0], new_par[ arg[1] ]
+                );
+                break;
+
+                default:
+                CPPAD_ASSERT_UNKNOWN( local::num_non_par_arg_dyn(op) == 0 );
+                if( n_arg == 1 )
+                {   new_par[i_par] = rec.put_dyn_par(
+                        par, op, new_par[ arg[0] ]
+                    );
+                }
+                else
+                {   CPPAD_ASSERT_UNKNOWN( n_arg == 2 );
+                    new_par[i_par] = rec.put_dyn_par(
+                        par, op, new_par[ arg[0] ], new_par[ arg[1] ]
+                    );
+                }
+                break;
+            }
+            ++i_dyn;
+            i_arg += n_arg;
+        }
+        CPPAD_ASSERT_UNKNOWN( i_arg == dyn_par_arg.size() );
+        //
+        // VecAD vectors for this block
+        addr_t vecad_offset = 0;
+        size_t num_vecad_ind = play.num_var_vecad_ind_rec();
+        for(size_t i = 0; i < num_vecad_ind; )
+        {   size_t length = play.GetVecInd(i);
+            addr_t start  = rec.put_var_vecad_ind( addr_t(length) );
+            if( i == 0 )
+                vecad_offset = start;
+            for(size_t j = 1; j <= length; ++j)
+                rec.put_var_vecad_ind( new_par[ play.GetVecInd(i + j) ] );
+            i += length + 1;
+        }
+        //
+        // new_var for the independent variables
+        size_t num_var = play.num_var_rec();
+        new_var.resize(num_var);
+        for(size_t i_var = 0; i_var <= n; ++i_var)
+            new_var[i_var] = addr_t( i_var );
+        //
+        // variable operators
+        local::play::const_sequential_iterator itr = play.begin();
+        local::OpCode op;
+        const addr_t* arg;
+        size_t        i_var;
+        itr.op_info(op, arg, i_var);
+        CPPAD_ASSERT_UNKNOWN( op == local::BeginOp );
+        bool more_operators = true;
+        while( more_operators )
+        {   (++itr).op_info(op, arg, i_var);
+            switch( op )
+            {
+                case local::InvOp:
+                CPPAD_ASSERT_UNKNOWN( i_var <= n );
+                break;
+
+                case local::EndOp:
+                more_operators = false;
+                break;
+
+                case local::CSkipOp:
+                // the operator indices it skips are only valid for this block
+                itr.correct_before_increment();
+                break;
+
+                default:
+                {   local::arg_is_variable(op, arg, is_var);
+                    size_t n_arg = is_var.size();
+                    if( op == local::CSumOp )
+                    {   // last argument is the number of other arguments
+                        ++n_arg;
+                        is_var.push_back(false);
+                    }
+                    bool is_load =
+                        (op == local::LdpOp) || (op == local::LdvOp);
+                    arg_vec.resize(n_arg);
+                    for(size_t j = 0; j < n_arg; ++j)
+                    {   if( is_var[j] )
+                        {   arg_vec[j] = new_var[ arg[j] ];
+                            continue;
+                        }
+                        // by default a non-variable argument is a parameter
+                        bool is_par = true;
+                        switch( op )
+                        {
+                            case local::AFunOp:
+                            is_par = false;
+                            break;
+
+                            case local::CExpOp:
+                            is_par = j > 1;
+                            break;
+
+                            case local::DisOp:
+                            is_par = j > 0;
+                            break;
+
+                            case local::CSumOp:
+                            is_par = j == 0 ||
+                                ( size_t(arg[2]) <= j && j < size_t(arg[4]) );
+                            break;
+
+                            case local::PriOp:
+                            if( j == 2 || j == 4 )
+                            {   arg_vec[j] = rec.PutTxt( play.GetTxt(
+                                    size_t( arg[j] )
+                                ) );
+                                continue;
+                            }
+                            is_par = j != 0;
+                            break;
+
+                            case local::LdpOp:
+                            case local::LdvOp:
+                            case local::StppOp:
+                            case local::StpvOp:
+                            case local::StvpOp:
+                            case local::StvvOp:
+                            if( j == 0 )
+                            {   arg_vec[j] = addr_t( arg[0] + vecad_offset );
+                                continue;
+                            }
+                            if( j == 2 && is_load )
+                            {   arg_vec[j] = addr_t( rec.num_var_load_rec() );
+                                continue;
+                            }
+                            break;
+
+                            default:
+                            break;
+                        }
+                        if( is_par )
+                            arg_vec[j] = new_par[ arg[j] ];
+                        else
+                            arg_vec[j] = arg[j];
+                    }
+                    size_t j_arg = rec.ReserveArg(n_arg);
+                    for(size_t j = 0; j < n_arg; ++j)
+                        rec.ReplaceArg(j_arg + j, arg_vec[j]);
+                    //
+                    addr_t j_var;
+                    if( is_load )
+                        j_var = rec.PutLoadOp(op);
+                    else
+                        j_var = rec.PutOp(op);
+                    if( local::NumRes(op) > 0 )
+                        new_var[i_var] = j_var;
+                    if( op == local::CSumOp )
+                        itr.correct_before_increment();
+                }
+                break;
+            }
+        }
+        //
+        // dependent variables for this block
+        size_t m = block[k].Range();
+        for(size_t i = 0; i < m; ++i)
+        {   dep_taddr.push_back( size_t( new_var[ block[k].dep_taddr_[i] ] ) );
+            dep_parameter.push_back( block[k].dep_parameter_[i] );
+        }
+    }
+    // put an EndOp at the end of the recording
+    rec.PutOp(local::EndOp);
+    //
+    // bool values in this object except check_for_nan_
+    has_been_optimized_        = false;
+    //
+    // size_t values in this object
+    compare_change_count_      = 1;
+    compare_change_number_     = 0;
+    compare_change_op_index_   = 0;
+    num_order_taylor_          = 0;
+    cap_order_taylor_          = 0;
+    num_direction_taylor_      = 0;
+    num_var_tape_              = rec.num_var_rec();
+    //
+    // dep_taddr_, dep_parameter_
+    dep_taddr_.swap(dep_taddr);
+    dep_parameter_.swap(dep_parameter);
+    //
+    // taylor_, cskip_op_, load_op2var_
+    taylor_.resize(0);
+    cskip_op_.resize( rec.num_op_rec() );
+    load_op2var_.resize( rec.num_var_load_rec() );
+    //
+    // play_
+    play_.get_recording(rec, n);
+    //
+    // ind_taddr_
+    ind_taddr_.resize(n);
+    for(size_t j = 0; j < n; j++)
+    {   CPPAD_ASSERT_UNKNOWN( play_.GetOp(j+1) == local::InvOp );
+        ind_taddr_[j] = j+1;
+    }
+    //
+    // for_jac_sparse_pack_, for_jac_sparse_set_
+    for_jac_sparse_pack_.resize(0, 0);
+    for_jac_sparse_set_.resize(0,0);
+    //
+    // subgraph_info_
+    subgraph_info_.resize(
+        ind_taddr_.size(),   // n_ind
+        dep_taddr_.size(),   // n_dep
+        play_.num_op_rec(),  // n_op
+        play_.num_var_rec()  // n_var
+    );
+    //
+    // memory used by the new operation sequence
+    memory_high_water();
+    return;
+}
+
+} // END_CPPAD_NAMESPACE
+
+# endif
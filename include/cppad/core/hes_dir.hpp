@@ -0,0 +1,304 @@
+# ifndef CPPAD_CORE_HES_DIR_HPP
+# define CPPAD_CORE_HES_DIR_HPP
+/* --------------------------------------------------------------------------
+CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-21 Bradley M. Bell
+
+CppAD is distributed under the terms of the
+             Eclipse Public License Version 2.0.
+
+This Source Code may also be made available under the following
+Secondary License when the conditions for such availability set forth
+in the Eclipse Public License, Version 2.0 are satisfied:
+      GNU General Public License, Version 2.0 or later.
+---------------------------------------------------------------------------- */
+
+/*
+$begin hes_dir$$
+$spell
+    const
+    dir
+    hv
+    Taylor
+$$
+
+$section Hessian Times Multiple Directions$$
+
+$head Syntax$$
+$icode%f%.hes_dir(%r%, %w%, %v%, %hv%)%$$
+
+$head Prototype$$
+$srcthisfile%
+    0%// BEGIN_HES_DIR%// END_HES_DIR%1
+%$$
+
+$head Purpose$$
+We use $latex F : \B{R}^n \rightarrow \B{R}^m$$ to denote the
+$cref/AD function/glossary/AD Function/$$ corresponding to $icode f$$.
+The function $latex W : \B{R}^n \rightarrow \B{R}$$ is defined by
+$latex \[
+    W(x) = w_0 * F_0 ( x ) + \cdots + w_{m-1} * F_{m-1} (x)
+\] $$
+This routine computes the Hessian of $latex W$$ times $icode r$$
+direction vectors $latex v^{(\ell)}$$; i.e.,
+$latex W^{(2)} (x) v^{(\ell)}$$ for $latex \ell = 0 , \ldots , r-1$$.
+For each direction, this is the same as
+$codei%
+    %f%.Forward(1, %v_ell%)
+    %dw% = %f%.Reverse(2, %w%)
+%$$
+where $icode v_ell$$ is the $th \ell$$ direction
+and $icode%dw%[%j%*2+1]%$$ is the $th j$$ component of the product,
+but all the directions are computed using one
+$cref/multiple direction/forward_dir/$$ forward sweep
+and one reverse sweep.
+In addition, the memory used for these sweeps is kept in $icode f$$
+and reused by the next call.
+This makes it suitable for computing Hessian vector products
+inside an iterative solver.
+
+$head f$$
+The object $icode f$$ has prototype
+$codei%
+    ADFun<%Base%> %f%
+%$$
+Note that the $cref ADFun$$ object $icode f$$ is not $code const$$
+(see $cref/Taylor Coefficients/hes_dir/Taylor Coefficients/$$ below).
+Before this call, the value returned by
+$codei%
+    %f%.size_order()
+%$$
+must be greater than or equal one (see $cref size_order$$).
+
+$head x$$
+The point $icode x$$ at which the Hessian is evaluated
+corresponds to the previous call to $cref forward_zero$$
+(or $cref value_and_gradient$$) using this ADFun object $icode f$$.
+If there is no such previous call,
+the value of the $cref/independent/Independent/$$ variables
+during the recording of the AD sequence of operations is used
+for $icode x$$.
+
+$head r$$
+This is the number of directions and must be greater than zero.
+
+$head w$$
+The size of $icode w$$ is $icode m$$, the dimension of the
+$cref/range/fun_property/Range/$$ space for $icode f$$.
+It specifies the weights in the definition of $latex W(x)$$ above.
+
+$head v$$
+The size of $icode v$$ is $icode%n%*%r%$$.
+For $latex j = 0 , \ldots , n-1$$ and $latex \ell = 0 , \ldots , r-1$$,
+$latex \[
+    v_j^{(\ell)} = v [ j * r + \ell ]
+\] $$
+This is the same layout as is used for $icode xq$$ in
+$cref/Forward(q, r, xq)/forward_dir/$$.
+
+$head hv$$
+The size of $icode hv$$ must be $icode%n%*%r%$$.
+The input value of its elements does not matter.
+Upon return,
+for $latex j = 0 , \ldots , n-1$$ and $latex \ell = 0 , \ldots , r-1$$,
+$latex \[
+    hv [ j * r + \ell ] = \sum_{k=0}^{n-1}
+        \frac{ \partial^2 W }{ \partial x_j \partial x_k } (x) v_k^{(\ell)}
+\] $$
+
+$head BaseVector$$
+The type $icode BaseVector$$ must be a $cref SimpleVector$$ class with
+$cref/elements of type/SimpleVector/Elements of Specified Type/$$
+$icode Base$$.
+The routine $cref CheckSimpleVector$$ will generate an error message
+if this is not the case.
+
+$head Taylor Coefficients$$
+After this call,
+$icode%f%.size_order()%$$ is two,
+$icode%f%.size_direction()%$$ is $icode r$$,
+and the first order Taylor coefficients stored in $icode f$$ correspond to
+$codei%
+    %f%.Forward(1, %r%, %v%)
+%$$
+
+$head Example$$
+$children%
+    example/general/hes_dir.cpp
+%$$
+The file
+$cref hes_dir.cpp$$
+contains an example and test of this operation.
+
+$end
+-----------------------------------------------------------------------------
+*/
+
+//  BEGIN CppAD namespace
+namespace CppAD {
+
+/*!
+\file hes_dir.hpp
+Compute the Hessian times multiple directions.
+*/
+
+/*!
+Compute the Hessian of a weighted sum of the components of the function
+times multiple directions.
+
+\tparam Base
+base type for the operator; i.e., this operation sequence was recorded
+using AD< Base > and computations by this routine are done using type
+ Base.
+
+\tparam BaseVector
+is a Simple Vector class with elements of type Base.
+
+\param r
+is the number of directions.
+
+\param w
+is the weighting vector for the components of the function.
+
+\param v
+is the vector of directions,
+<tt>v[ j * r + ell ]</tt> is the j-th component of the ell-th direction.
+
+\param hv
+the input size must be n * r.
+Upon return, <tt>hv[ j * r + ell ]</tt> is the j-th component of
+the Hessian of the weighted sum times the ell-th direction.
+*/
+// BEGIN_HES_DIR
+template <class Base, class RecBase>
+template <class BaseVector>
+void ADFun<Base,RecBase>::hes_dir(
+    size_t            r  ,
+    const BaseVector& w  ,
+    const BaseVector& v  ,
+    BaseVector&       hv )
+// END_HES_DIR
+{   // used to identify the RecBase type in calls to sweeps
+    RecBase not_used_rec_base(0.0);
+
+    // number of independent variables
+    size_t n = ind_taddr_.size();
+
+    // number of dependent variables
+    size_t m = dep_taddr_.size();
+
+    // check BaseVector is Simple Vector class with Base type elements
+    CheckSimpleVector<Base, BaseVector>();
+
+    CPPAD_ASSERT_KNOWN(
+        r > 0,
+        "f.hes_dir(r, w, v, hv): r is zero"
+    );
+    CPPAD_ASSERT_KNOWN(
+        size_t(w.size()) == m,
+        "f.hes_dir(r, w, v, hv): w.size() is not equal m"
+    );
+    CPPAD_ASSERT_KNOWN(
+        size_t(v.size()) == n * r,
+        "f.hes_dir(r, w, v, hv): v.size() is not equal n * r"
+    );
+    CPPAD_ASSERT_KNOWN(
+        size_t(hv.size()) == n * r,
+        "f.hes_dir(r, w, v, hv): hv.size() is not equal n * r"
+    );
+    CPPAD_ASSERT_KNOWN(
+        num_order_taylor_ >= 1,
+        "f.hes_dir(r, w, v, hv): zero order Taylor coefficients are not"
+        " stored in this ADFun object."
+    );
+
+    // does taylor_ need more orders or new number of directions
+    if( cap_order_taylor_ <= 1 || num_direction_taylor_ != r )
+    {   num_order_taylor_ = 1;
+        size_t c = std::max<size_t>(2, cap_order_taylor_);
+        capacity_order(c, r);
+    }
+    CPPAD_ASSERT_UNKNOWN( cap_order_taylor_ > 1 );
+    CPPAD_ASSERT_UNKNOWN( num_direction_taylor_ == r )
+
+    // number of Base values per variable in taylor_
+    size_t per_var = (cap_order_taylor_ - 1) * r + 1;
+
+    // set first order Taylor coefficients for independent variables
+    for(size_t j = 0; j < n; j++)
+    {   CPPAD_ASSERT_UNKNOWN( ind_taddr_[j] < num_var_tape_  );
+        CPPAD_ASSERT_UNKNOWN( play_.GetOp( ind_taddr_[j] ) == local::InvOp );
+        for(size_t ell = 0; ell < r; ell++)
+            taylor_[ per_var * ind_taddr_[j] + 1 + ell ] = v[ r * j + ell ];
+    }
+
+    // first order forward sweep for all the directions
+    CPPAD_ASSERT_UNKNOWN( cskip_op_.size() == play_.num_op_rec() );
+    CPPAD_ASSERT_UNKNOWN( load_op2var_.size()  == play_.num_var_load_rec() );
+    local::sweep::forward2(
+        &play_,
+        size_t(1),
+        r,
+        n,
+        num_var_tape_,
+        cap_order_taylor_,
+        taylor_.data(),
+        cskip_op_.data(),
+        load_op2var_,
+        not_used_rec_base
+    );
+    num_order_taylor_ = 2;
+
+    // Taylor coefficients with the two orders for each direction adjacent
+    size_t K = 2 * r;
+    hes_dir_taylor_.resize(num_var_tape_ * K);
+    for(size_t i = 0; i < num_var_tape_; i++)
+    {   const Base* t_in  = taylor_.data() + per_var * i;
+        Base*       t_out = hes_dir_taylor_.data() + K * i;
+        for(size_t ell = 0; ell < r; ell++)
+        {   t_out[2 * ell + 0] = t_in[0];
+            t_out[2 * ell + 1] = t_in[1 + ell];
+        }
+    }
+
+    // initialize partials to zero
+    reverse_partial_.resize(num_var_tape_ * K);
+    for(size_t i = 0; i < num_var_tape_ * K; i++)
+        reverse_partial_[i] = Base(0.0);
+
+    // set the dependent variable weights for the first order coefficients
+    // (use += because two dependent variables can point to same location)
+    for(size_t i = 0; i < m; i++)
+    {   CPPAD_ASSERT_UNKNOWN( dep_taddr_[i] < num_var_tape_  );
+        for(size_t ell = 0; ell < r; ell++)
+            reverse_partial_[ dep_taddr_[i] * K + 2 * ell + 1 ] += w[i];
+    }
+
+    // second order reverse sweep for all the directions
+    local::sweep::reverse_hes_dir(
+        n,
+        num_var_tape_,
+        &play_,
+        r,
+        hes_dir_taylor_.data(),
+        reverse_partial_.data(),
+        cskip_op_.data(),
+        load_op2var_,
+        not_used_rec_base
+    );
+
+    // partial of first order coefficients w.r.t. zero order coefficients
+    for(size_t j = 0; j < n; j++)
+    {   for(size_t ell = 0; ell < r; ell++)
+            hv[j * r + ell] = reverse_partial_[ ind_taddr_[j] * K + 2 * ell ];
+    }
+    CPPAD_ASSERT_KNOWN( ! ( hasnan(hv) && check_for_nan_ ) ,
+        "f.hes_dir(r, w, v, hv): hv has a nan,\n"
+        "but none of its Taylor coefficents are nan."
+    );
+
+    return;
+}
+
+} // END CppAD namespace
+
+# endif
@@ -0,0 +1,124 @@
+# ifndef CPPAD_CORE_HUGE_PAGE_HPP
+# define CPPAD_CORE_HUGE_PAGE_HPP
+/* --------------------------------------------------------------------------
+CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-21 Bradley M. Bell
+
+CppAD is distributed under the terms of the
+             Eclipse Public License Version 2.0.
+
+This Source Code may also be made available under the following
+Secondary License when the conditions for such availability set forth
+in the Eclipse Public License, Version 2.0 are satisfied:
+      GNU General Public License, Version 2.0 or later.
+---------------------------------------------------------------------------- */
+/*
+$begin huge_page$$
+$spell
+    alloc
+    op
+    seq
+    dTLB
+    Taylor
+    mmap
+    madvise
+    meminfo
+    proc
+    cppad
+$$
+
+$section Use Huge Pages for the Large Arrays in an ADFun Object$$
+
+$head Syntax$$
+$icode%f%.huge_page(%value%)%$$
+
+$head Purpose$$
+The $cref Forward$$ and $cref Reverse$$ sweeps read the operation sequence,
+and read and write the Taylor coefficients, once per operation.
+For very large operation sequences, these arrays span many pages and
+the translation look-aside buffer (TLB) misses during a sweep can be
+significant.
+This routine obtains the memory for these arrays using
+$cref/get_huge_memory/ta_get_memory/get_huge_memory/$$,
+so that the large ones start on a two megabyte boundary and
+are advised to use transparent huge pages.
+This affects only $icode f$$; i.e., it does not change the
+$cref/aligned mode/ta_aligned_memory/$$ for other allocations.
+
+$head f$$
+The object $icode f$$ has prototype
+$codei%
+    ADFun<%Base%> %f%
+%$$
+The operation sequence, and the values computed using $icode f$$,
+are not affected by this operation.
+
+$head value$$
+This argument has prototype
+$codei%
+    bool %value%
+%$$
+If it is true,
+the current operation sequence and Taylor coefficients are moved
+to memory obtained using $code get_huge_memory$$
+(this is a copy of the arrays and should be done once,
+before the sweeps that use them).
+In addition, the memory for the following is obtained the same way:
+$list number$$
+The Taylor coefficients when their $cref capacity_order$$ changes;
+e.g., during $cref Forward$$.
+$lnext
+A new operation sequence stored in $icode f$$; e.g., by
+$cref/f.Dependent/Dependent/$$ or $cref/f.optimize/optimize/$$.
+$lnext
+A copy of $icode f$$; e.g., $icode%g% = %f%$$.
+$lend
+If $icode value$$ is false, future memory is obtained using
+$cref/get_memory/ta_get_memory/$$
+(the memory currently used by $icode f$$ is not changed).
+By default (when $code huge_page$$ has not been called),
+$icode value$$ is false.
+
+$head Large Blocks$$
+Only blocks with capacity greater than or equal the
+$cref/min_bytes/ta_aligned_memory/min_bytes/$$ argument to
+$code thread_alloc::large_memory$$ (two megabytes by default)
+are obtained using $code mmap$$ and advised to use huge pages.
+The smaller arrays use the finer capacities of the aligned mode.
+
+$head Instrumentation$$
+The number of bytes, for a thread, that are advised to use huge pages is
+$cref/thread_alloc::huge(thread)/ta_requested/huge/$$.
+On Linux, the $code AnonHugePages$$ entry in $code /proc/meminfo$$
+shows how much memory is actually backed by huge pages.
+The reduction in TLB misses can be measured using the hardware counters;
+e.g.,
+$codei%
+    perf stat -e dTLB-load-misses %program%
+%$$
+with and without the call to $code huge_page$$.
+See the $cref/hugepage/speed_main/Global Options/hugepage/$$ option
+for the $code speed_cppad$$ program.
+
+$head Example$$
+$children%
+    example/general/huge_page.cpp
+%$$
+The file $cref huge_page.cpp$$
+contains an example and test of this operation.
+
+$end
+*/
+
+namespace CppAD { // BEGIN_CPPAD_NAMESPACE
+
+/// set the allocation policy for the operation sequence and Taylor
+/// coefficients; see player::huge_page and pod_vector::huge_page
+template <class Base, class RecBase>
+void ADFun<Base,RecBase>::huge_page(bool value)
+{   play_.huge_page(value);
+    taylor_.huge_page(value);
+}
+
+} // END_CPPAD_NAMESPACE
+
+# endif
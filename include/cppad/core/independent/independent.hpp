@@ -11,6 +11,56 @@ Secondary License when the conditions for such availability set forth
 in the Eclipse Public License, Version 2.0 are satisfied:
       GNU General Public License, Version 2.0 or later.
 ---------------------------------------------------------------------------- */
+
+namespace CppAD { // BEGIN_CPPAD_NAMESPACE
+/*
+$begin record_hint$$
+$spell
+    op
+    num
+$$
+
+$section Independent: Size Hint For a Recording$$
+
+$head Purpose$$
+This class is used to pass the expected size of a recording to
+$cref Independent$$.
+
+$head Syntax$$
+$codei%record_hint %hint%(%num_op%, %num_op_arg%, %num_par%)%$$
+
+$head Prototype$$
+$srcthisfile%
+    0%// BEGIN_RECORD_HINT%// END_RECORD_HINT%1
+%$$
+
+$head num_op$$
+expected number of operators in the recording; see
+$cref/size_op/fun_property/size_op/$$.
+
+$head num_op_arg$$
+expected number of operator arguments in the recording; see
+$cref/size_op_arg/fun_property/size_op_arg/$$.
+
+$head num_par$$
+expected number of parameters in the recording; see
+$cref/size_par/fun_property/size_par/$$.
+
+$end
+*/
+// BEGIN_RECORD_HINT
+class record_hint {
+public:
+    size_t num_op;
+    size_t num_op_arg;
+    size_t num_par;
+    record_hint(size_t op = 0, size_t op_arg = 0, size_t par = 0)
+// END_RECORD_HINT
+    : num_op(op), num_op_arg(op_arg), num_par(par)
+    { }
+};
+} // END_CPPAD_NAMESPACE
+
 # include <cppad/local/independent.hpp>
 
 namespace CppAD { // BEGIN_CPPAD_NAMESPACE
@@ -27,7 +77,7 @@ $head Purpose$$
 This implements $cref Independent$$ with all the possible arguments present.
 
 $head Syntax$$
-$codei%Independent(%x%, %abort_op_index%, %record_compare%, %dynamic%)%$$
+$codei%Independent(%x%, %abort_op_index%, %record_compare%, %dynamic%, %hint%)%$$
 
 $head Prototype$$
 $srcthisfile%
@@ -53,15 +103,19 @@ should comparison operators be recorded.
 $head dynamic$$
 is the independent dynamic parameter vector.
 
+$head hint$$
+is the expected size of the recording.
+
 $end
 */
 // BEGIN_ALL_ARGUMENT
 template <class ADVector>
 void Independent(
-    ADVector&  x              ,
-    size_t     abort_op_index ,
-    bool       record_compare ,
-    ADVector&  dynamic        )
+    ADVector&          x              ,
+    size_t             abort_op_index ,
+    bool               record_compare ,
+    ADVector&          dynamic        ,
+    const record_hint& hint           )
 // END_ALL_ARGUMENT
 {   CPPAD_ASSERT_KNOWN(
         abort_op_index == 0 || record_compare,
@@ -76,7 +130,60 @@ void Independent(
         "AD<Base>::abort_recording() would abort this previous recording."
     );
     local::ADTape<Base>* tape = ADBase::tape_manage(new_tape_manage);
-    tape->Independent(x, abort_op_index, record_compare, dynamic);
+    tape->Independent(x, abort_op_index, record_compare, dynamic, hint);
+}
+/*
+----------------------------------------------------------------------------
+$begin independent_x_abort_record_dynamic$$
+$spell
+    op
+$$
+
+$section Independent: Default For hint$$
+
+$head Purpose$$
+This implements $cref Independent$$ using
+the default for the hint argument.
+
+$head Syntax$$
+$codei%Independent(%x%, %abort_op_index%, %record_compare%, %dynamic%)%$$
+
+$head Prototype$$
+$srcthisfile%
+    0%// BEGIN_FOUR_ARGUMENT%// END_FOUR_ARGUMENT%1
+%$$
+
+$head Base$$
+The base type the recording started by this operation.
+
+$head ADVector$$
+is simple vector type with elements of type $codei%AD<%Base%>%$$.
+
+$head x$$
+is the vector of the independent variables.
+
+$head abort_op_index$$
+operator index at which execution will be aborted (during  the recording
+of operations). The value zero corresponds to not aborting (will not match).
+
+$head record_compare$$
+should comparison operators be recorded.
+
+$head dynamic$$
+is the independent dynamic parameter vector.
+
+$end
+*/
+// BEGIN_FOUR_ARGUMENT
+template <class ADVector>
+void Independent(
+    ADVector&  x              ,
+    size_t     abort_op_index ,
+    bool       record_compare ,
+    ADVector&  dynamic        )
+// END_FOUR_ARGUMENT
+{   record_hint hint; // no hint
+    Independent(x, abort_op_index, record_compare, dynamic, hint);
 }
 /*
 ----------------------------------------------------------------------------
@@ -252,6 +359,51 @@ void Independent(ADVector &x)
     ADVector dynamic(0); // empty vector
     Independent(x, abort_op_index, record_compare, dynamic);
 }
+/*
+------------------------------------------------------------------------------
+$begin independent_x_hint$$
+$spell
+    op
+$$
+
+$section Independent: Default For abort_op_index, record_compare, dynamic$$
+
+$head Purpose$$
+This implements $cref Independent$$ using
+the default for the abort_op_index, record_compare and dynamic arguments
+and a specified hint.
+
+$head Syntax$$
+$codei%Independent(%x%, %hint%)%$$
+
+$head Prototype$$
+$srcthisfile%
+    0%// BEGIN_X_HINT%// END_X_HINT%1
+%$$
+
+$head Base$$
+The base type the recording started by this operation.
+
+$head ADVector$$
+is simple vector type with elements of type $codei%AD<%Base%>%$$.
+
+$head x$$
+is the vector of the independent variables.
+
+$head hint$$
+is the expected size of the recording.
+
+$end
+*/
+// BEGIN_X_HINT
+template <class ADVector>
+void Independent(ADVector &x, const record_hint& hint)
+// END_X_HINT
+{   size_t   abort_op_index = 0;
+    bool     record_compare = true;
+    ADVector dynamic(0); // empty vector
+    Independent(x, abort_op_index, record_compare, dynamic, hint);
+}
 
 } // END_CPPAD_NAMESPACE
 # endif
@@ -0,0 +1,185 @@
+# ifndef CPPAD_CORE_MEMORY_REPORT_HPP
+# define CPPAD_CORE_MEMORY_REPORT_HPP
+/* --------------------------------------------------------------------------
+CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-21 Bradley M. Bell
+
+CppAD is distributed under the terms of the
+             Eclipse Public License Version 2.0.
+
+This Source Code may also be made available under the following
+Secondary License when the conditions for such availability set forth
+in the Eclipse Public License, Version 2.0 are satisfied:
+      GNU General Public License, Version 2.0 or later.
+---------------------------------------------------------------------------- */
+/*
+$begin memory_report$$
+$spell
+    const
+    op
+    seq
+    Taylor
+    std
+    Jacobian
+    subgraph
+$$
+
+$section Memory Used by the Components of an ADFun Object$$
+
+$head Syntax$$
+$icode%report% = %f%.memory_report()
+%$$
+$icode%bytes% = %report%.current.%component%
+%$$
+$icode%bytes% = %report%.high_water.%component%
+%$$
+
+$head Purpose$$
+The functions $cref/size_op_seq/fun_property/size_op_seq/$$,
+$cref size_order$$, and $cref/inuse/ta_inuse/$$ each give a partial view
+of the memory used by an $code ADFun$$ object.
+The $code memory_report$$ function gives the memory used by each
+component of the object.
+See $cref fun_registry$$ for a list of the reports for all the
+$code ADFun$$ objects in a program.
+
+$head f$$
+The object $icode f$$ has prototype
+$codei%
+    const ADFun<%Base%> %f%
+%$$
+
+$head report$$
+The return value has prototype
+$codei%
+    fun_memory %report%
+%$$
+
+$subhead function_name$$
+The value $icode%report%.function_name%$$ is a $code std::string$$
+equal to the $cref function_name$$ for $icode f$$.
+
+$subhead current$$
+The value $icode%report%.current%$$ has type $code fun_memory_size$$
+and contains the number of bytes currently used by each component.
+For the $code op_seq$$ and $code dynamic$$ components,
+this is the memory required to store the operation sequence.
+For the other components, it is the memory allocated by $cref thread_alloc$$,
+which may be more than the memory the component requires.
+
+$subhead high_water$$
+The value $icode%report%.high_water%$$ has type $code fun_memory_size$$
+and contains the maximum number of bytes used by each component.
+The maximum is over the times when the operation sequence is stored in
+$icode f$$, the Taylor coefficient memory changes,
+the forward Jacobian sparsity patterns are computed,
+the subgraph information is initialized,
+and the current call to $code memory_report$$.
+Each component of $icode%report%.high_water%$$ is greater than or equal
+the corresponding component of $icode%report%.current%$$.
+
+$head component$$
+The type $code fun_memory_size$$ has the following $code size_t$$
+members:
+
+$table
+$icode component$$ $cnext Memory used by $rnext
+$code op_seq$$   $cnext
+    operation sequence, not including dynamic parameter information
+$rnext
+$code dynamic$$  $cnext
+    dynamic parameter information in the operation sequence
+$rnext
+$code random$$   $cnext
+    random access information for the operation sequence; see
+    $cref/size_random/fun_property/size_random/$$
+$rnext
+$code taylor$$   $cnext
+    Taylor coefficients; see $cref capacity_order$$
+$rnext
+$code sparsity$$ $cnext
+    forward mode Jacobian sparsity patterns; see
+    $cref/size_forward_bool/ForSparseJac/f/size_forward_bool/$$
+    and $cref/size_forward_set/ForSparseJac/f/size_forward_set/$$
+$rnext
+$code subgraph$$ $cnext
+    subgraph information; see
+    $cref/clear_subgraph/subgraph_reverse/clear_subgraph/$$
+$rnext
+$code work$$     $cnext
+    other work space; e.g., for $cref value_and_gradient$$ and $cref Reverse$$
+$rnext
+$code total$$    $cnext
+    sum of the components above
+$tend
+
+$head Atomic Functions$$
+Atomic functions are separate objects that can be used by many
+$code ADFun$$ objects, so their memory is not included in $icode report$$.
+The $code ADFun$$ objects used by checkpoint functions
+are included in the $cref fun_registry$$.
+
+$head Example$$
+$children%
+    example/general/memory_report.cpp
+%$$
+The file $cref memory_report.cpp$$
+contains an example and test of this operation.
+
+$end
+*/
+# include <cppad/core/fun_registry.hpp>
+
+namespace CppAD { // BEGIN_CPPAD_NAMESPACE
+
+/// number of bytes currently used by each component of this object
+template <class Base, class RecBase>
+fun_memory_size ADFun<Base,RecBase>::memory_size(void) const
+{   fun_memory_size size;
+    //
+    size.dynamic   = play_.size_dynamic();
+    size.op_seq    = play_.size_op_seq() - size.dynamic;
+    size.random    = play_.size_random();
+    size.taylor    = taylor_.capacity() * sizeof(Base);
+    size.sparsity  = for_jac_sparse_pack_.memory();
+    size.sparsity += for_jac_sparse_set_.memory();
+    size.subgraph  = subgraph_info_.memory();
+    size.subgraph += subgraph_partial_.capacity() * sizeof(Base);
+    //
+    size.work      = ind_taddr_.capacity()     * sizeof(size_t);
+    size.work     += dep_taddr_.capacity()     * sizeof(size_t);
+    size.work     += dep_parameter_.capacity() * sizeof(bool);
+    size.work     += cskip_op_.capacity()      * sizeof(bool);
+    size.work     += load_op2var_.capacity()   * sizeof(addr_t);
+    size.work     += hes_dir_taylor_.capacity()   * sizeof(Base);
+    size.work     += reverse_partial_.capacity()  * sizeof(Base);
+    //
+    size.total     = size.op_seq + size.dynamic + size.random + size.taylor;
+    size.total    += size.sparsity + size.subgraph + size.work;
+    return size;
+}
+
+/// include the current memory in the high water marks for this object
+template <class Base, class RecBase>
+void ADFun<Base,RecBase>::memory_high_water(void)
+{   memory_high_water_.max( memory_size() ); }
+
+/// memory report for this object
+template <class Base, class RecBase>
+fun_memory ADFun<Base,RecBase>::memory_report(void) const
+{   fun_memory report;
+    report.function_name = function_name_;
+    report.current       = memory_size();
+    report.high_water    = memory_high_water_;
+    report.high_water.max( report.current );
+    return report;
+}
+
+/// memory report for the ADFun object at the specified address
+/// (used by fun_registry)
+template <class Base, class RecBase>
+fun_memory ADFun<Base,RecBase>::memory_report_void(const void* fun)
+{   return reinterpret_cast<const ADFun*>(fun)->memory_report(); }
+
+} // END_CPPAD_NAMESPACE
+
+# endif
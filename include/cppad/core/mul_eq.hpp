@@ -66,7 +66,7 @@ AD<Base>& AD<Base>::operator *= (const AD<Base> &right)
         }
         else if( (! dyn_right) & IdenticalZero(right.value_) )
         {   // this = variable * 0
-            tape_id_ = 0; // not in current tape
+            set_tape_id(0); // not in current tape
         }
         else
         {   // this = variable  * parameter
@@ -109,7 +109,7 @@ AD<Base>& AD<Base>::operator *= (const AD<Base> &right)
             taddr_ = tape->Rec_.PutOp(local::MulpvOp);
 
             // make this a variable
-            tape_id_ = tape_id;
+            set_tape_id(tape_id);
             ad_type_ = variable_enum;
         }
     }
@@ -125,7 +125,7 @@ AD<Base>& AD<Base>::operator *= (const AD<Base> &right)
         taddr_ = tape->Rec_.put_dyn_par(
                 value_, local::mul_dyn, arg0, arg1
         );
-        tape_id_ = tape_id;
+        set_tape_id(tape_id);
         ad_type_ = dynamic_enum;
     }
     return *this;
@@ -0,0 +1,92 @@
+# ifndef CPPAD_CORE_NUMA_INTERLEAVE_HPP
+# define CPPAD_CORE_NUMA_INTERLEAVE_HPP
+/* --------------------------------------------------------------------------
+CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-21 Bradley M. Bell
+
+CppAD is distributed under the terms of the
+             Eclipse Public License Version 2.0.
+
+This Source Code may also be made available under the following
+Secondary License when the conditions for such availability set forth
+in the Eclipse Public License, Version 2.0 are satisfied:
+      GNU General Public License, Version 2.0 or later.
+---------------------------------------------------------------------------- */
+/*
+$begin numa_interleave$$
+$spell
+    alloc
+    num
+    op
+    seq
+    cpu
+    Taylor
+$$
+
+$section Spread the Operation Sequence of an ADFun Object Across NUMA Nodes$$
+
+$head Syntax$$
+$icode%num_bytes% = %f%.numa_interleave()%$$
+
+$head Purpose$$
+On systems with more than one Non-Uniform Memory Access (NUMA) node
+(e.g., more than one socket), the memory for an operation sequence
+is placed on the node for the cpu that first touched it;
+i.e., the node for the thread that recorded (or copied) the function.
+If threads on other nodes use this operation sequence,
+all of their reads go to that node.
+This routine spreads the pages that store the operation sequence
+round robin across all the nodes, so that each node does its share
+of the reads.
+
+$head f$$
+The object $icode f$$ has prototype
+$codei%
+    ADFun<%Base%> %f%
+%$$
+The operation sequence, and the values computed using $icode f$$,
+are not affected by this operation.
+
+$head num_bytes$$
+The return value has prototype
+$codei%
+    size_t %num_bytes%
+%$$
+It is the number of bytes in the operation sequence that were
+interleaved; see
+$cref/numa_interleave/ta_numa_memory/numa_interleave/$$.
+Only the pages that are completely inside the memory for each vector
+are interleaved, so small operation sequences are not affected.
+If the system does not support NUMA policies, $icode num_bytes$$ is zero.
+
+$head Per Thread Copies$$
+The Taylor coefficients stored in $icode f$$ are written
+during $cref Forward$$ mode, so each thread uses its own copy of an
+$code ADFun$$ object.
+If $cref/numa_memory/ta_numa_memory/numa_memory/$$ is true and a copy
+is made by the thread that uses it
+(during $cref/parallel/ta_in_parallel/$$ execution),
+the copy is local to that thread's node.
+The $code numa_interleave$$ operation is intended for an object that
+is only read by the threads; e.g., the object that the copies are made from.
+
+$head Example$$
+$children%
+    example/general/numa_interleave.cpp
+%$$
+The file $cref numa_interleave.cpp$$
+contains an example and test of this operation.
+
+$end
+*/
+
+namespace CppAD { // BEGIN_CPPAD_NAMESPACE
+
+/// interleave the operation sequence across NUMA nodes;
+/// see player::numa_interleave
+template <class Base, class RecBase>
+size_t ADFun<Base,RecBase>::numa_interleave(void)
+{   return play_.numa_interleave(); }
+
+} // END_CPPAD_NAMESPACE
+
+# endif
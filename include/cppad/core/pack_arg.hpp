@@ -0,0 +1,96 @@
+# ifndef CPPAD_CORE_PACK_ARG_HPP
+# define CPPAD_CORE_PACK_ARG_HPP
+/* --------------------------------------------------------------------------
+CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-21 Bradley M. Bell
+
+CppAD is distributed under the terms of the
+             Eclipse Public License Version 2.0.
+
+This Source Code may also be made available under the following
+Secondary License when the conditions for such availability set forth
+in the Eclipse Public License, Version 2.0 are satisfied:
+      GNU General Public License, Version 2.0 or later.
+---------------------------------------------------------------------------- */
+/*
+$begin pack_arg$$
+$spell
+    op
+    arg
+    addr
+    bool
+    Jacobian
+$$
+
+$section Store Operator Arguments Using the Smallest Sufficient Type$$
+
+$head Syntax$$
+$icode%f%.pack_arg(%value%)%$$
+
+$head Purpose$$
+Each operator argument in an operation sequence is stored using
+$cref/tape_addr_type/cmake/cppad_tape_addr_type/$$.
+This type may need to be large for some of the recordings in an application
+while most of the recordings are small.
+This routine stores the arguments for $icode f$$ using the smallest of
+$code unsigned short$$, $code unsigned int$$, $code size_t$$
+that can represent all of its argument indices
+(only when this type is smaller than $icode tape_addr_type$$).
+
+$head f$$
+The object $icode f$$ has prototype
+$codei%
+    ADFun<%Base%> %f%
+%$$
+The operation sequence, and the values computed using $icode f$$,
+are not affected by this operation.
+
+$head value$$
+This argument has prototype
+$codei%
+    bool %value%
+%$$
+If it is true,
+the arguments for the current operation sequence are packed,
+and so are the arguments for a new operation sequence stored in $icode f$$;
+e.g., by $cref/f.Dependent/Dependent/$$ or $cref/f.optimize/optimize/$$.
+If it is false, the arguments are stored using $icode tape_addr_type$$.
+By default (when $code pack_arg$$ has not been called),
+$icode value$$ is false.
+If $icode f$$ is $cref/compressed/fun_compress/$$,
+it remains compressed and the policy is used for the arguments
+after it is decompressed.
+
+$head Speed$$
+The $cref Forward$$, $cref Reverse$$, and sparsity pattern calculations
+convert the packed arguments for each operator to $icode tape_addr_type$$
+as they go.
+This makes these operations slower (by as much as a third for
+operation sequences with many cheap operators).
+Thus packing should only be used when the memory for the
+operation sequence is more important than the time to use it.
+
+$head size_op_arg_byte$$
+The number of bytes used to store each argument is
+$cref/f.size_op_arg_byte()/fun_property/size_op_arg_byte/$$.
+
+$head Example$$
+$children%
+    example/general/pack_arg.cpp
+%$$
+The file $cref pack_arg.cpp$$
+contains an example and test of this operation.
+
+$end
+*/
+
+namespace CppAD { // BEGIN_CPPAD_NAMESPACE
+
+/// set the argument packing policy for the operation sequence;
+/// see player::pack_arg
+template <class Base, class RecBase>
+void ADFun<Base,RecBase>::pack_arg(bool value)
+{   play_.pack_arg(value); }
+
+} // END_CPPAD_NAMESPACE
+
+# endif
@@ -106,6 +106,7 @@ void parallel_ad(void)
     // statics that depend on the value of Base
     AD<Base>::tape_id_ptr(0);
     AD<Base>::tape_handle(0);
+    local::recorder<Base>::previous_size(0);
     discrete<Base>::List();
     CheckSimpleVector< Base, CppAD::vector<Base> >();
     CheckSimpleVector< AD<Base>, CppAD::vector< AD<Base> > >();
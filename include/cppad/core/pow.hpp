@@ -156,7 +156,7 @@ pow(const AD<Base>& x, const AD<Base>& y)
             result.taddr_ = tape->Rec_.PutOp(local::PowvvOp);
 
             // make result a variable
-            result.tape_id_ = tape_id;
+            result.set_tape_id(tape_id);
             result.ad_type_ = variable_enum;
         }
         else if( IdenticalZero( y.value_ ) )
@@ -177,7 +177,7 @@ pow(const AD<Base>& x, const AD<Base>& y)
             result.taddr_ = tape->Rec_.PutOp(local::PowvpOp);
 
             // make result a variable
-            result.tape_id_ = tape_id;
+            result.set_tape_id(tape_id);
             result.ad_type_ = variable_enum;
         }
     }
@@ -200,7 +200,7 @@ pow(const AD<Base>& x, const AD<Base>& y)
             result.taddr_ = tape->Rec_.PutOp(local::PowpvOp);
 
             // make result a variable
-            result.tape_id_ = tape_id;
+            result.set_tape_id(tape_id);
             result.ad_type_ = variable_enum;
         }
     }
@@ -216,7 +216,7 @@ pow(const AD<Base>& x, const AD<Base>& y)
         result.taddr_   = tape->Rec_.put_dyn_par(
             result.value_, local::pow_dyn,   arg0, arg1
         );
-        result.tape_id_ = tape_id;
+        result.set_tape_id(tape_id);
         result.ad_type_ = dynamic_enum;
     }
     else
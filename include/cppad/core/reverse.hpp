@@ -90,6 +90,33 @@ for the independent variables as specified by previous calls to Forward.
 template <class Base, class RecBase>
 template <class BaseVector>
 BaseVector ADFun<Base,RecBase>::Reverse(size_t q, const BaseVector &w)
+{   BaseVector dw;
+    Reverse(q, w, dw);
+    return dw;
+}
+/*!
+Reverse mode with the result returned in an argument.
+
+This is the same as the version of Reverse that returns dw, except that
+dw is resized to n * q (which does not allocate memory if it already
+has that size) and the partials are stored in reverse_partial_.
+Hence, once memory has been allocated for a value of q,
+subsequent calls with the same (or smaller) q do not allocate memory.
+
+\param q
+see the version that returns dw.
+
+\param w
+see the version that returns dw.
+
+\param dw [out]
+is the return value for the version that returns dw.
+It must not be the same vector as w.
+*/
+template <class Base, class RecBase>
+template <class BaseVector>
+void ADFun<Base,RecBase>::Reverse(
+    size_t q, const BaseVector &w, BaseVector& dw)
 {   // used to identify the RecBase type in calls to sweeps
     RecBase not_used_rec_base(0.0);
 
@@ -113,6 +140,10 @@ BaseVector ADFun<Base,RecBase>::Reverse(size_t q, const BaseVector &w)
         "Argument w to Reverse does not have length equal to\n"
         "the dimension of the range or dimension of range times q."
     );
+    CPPAD_ASSERT_KNOWN(
+        &w != &dw,
+        "Reverse(q, w, dw): w and dw are the same vector."
+    );
     CPPAD_ASSERT_KNOWN(
         q > 0,
         "The first argument to Reverse must be greater than zero."
@@ -137,7 +168,8 @@ BaseVector ADFun<Base,RecBase>::Reverse(size_t q, const BaseVector &w)
     );
 
     // initialize entire Partial matrix to zero
-    local::pod_vector_maybe<Base> Partial(num_var_tape_ * q);
+    local::pod_vector_maybe<Base>& Partial( reverse_partial_ );
+    Partial.resize(num_var_tape_ * q);
     for(i = 0; i < num_var_tape_; i++)
         for(j = 0; j < q; j++)
             Partial[i * q + j] = zero;
@@ -174,7 +206,8 @@ BaseVector ADFun<Base,RecBase>::Reverse(size_t q, const BaseVector &w)
     );
 
     // return the derivative values
-    BaseVector value(n * q);
+    BaseVector& value( dw );
+    value.resize(n * q);
     for(j = 0; j < n; j++)
     {   CPPAD_ASSERT_UNKNOWN( ind_taddr_[j] < num_var_tape_  );
 
@@ -200,6 +233,129 @@ BaseVector ADFun<Base,RecBase>::Reverse(size_t q, const BaseVector &w)
         "but none of its Taylor coefficents are nan."
     );
 
+    return;
+}
+
+/*!
+Use reverse mode to compute first order derivatives for multiple
+weight vectors in one sweep.
+
+\tparam Base
+base type for the operator; i.e., this operation sequence was recorded
+using AD< Base > and computations by this routine are done using type
+ Base.
+
+\tparam BaseVector
+is a Simple Vector class with elements of type Base.
+
+\param q
+is the number of Taylor coefficients that are being differentiated
+(per variable). This must be one.
+
+\param r
+is the number of weight vectors.
+
+\param w
+has size <tt>m * r</tt> and for \f$ i = 0, \ldots , m-1 \f$,
+\f$ \ell = 0 , \ldots , r-1 \f$,
+<tt>w[ i * r + ell ]</tt> is the weight for the i-th dependent variable
+in the ell-th direction.
+
+\return
+Is a vector \f$ dw \f$ with size <tt>n * r</tt> such that
+for \f$ j = 0 , \ldots , n-1 \f$ and
+\f$ \ell = 0 , \ldots , r-1 \f$,
+<tt>dw[ j * r + ell ]</tt> is the partial w.r.t. the j-th independent
+variable of the ell-th weighted sum of the dependent variables.
+*/
+template <class Base, class RecBase>
+template <class BaseVector>
+BaseVector ADFun<Base,RecBase>::Reverse(
+    size_t q, size_t r, const BaseVector &w)
+{   // used to identify the RecBase type in calls to sweeps
+    RecBase not_used_rec_base(0.0);
+
+    // constants
+    const Base zero(0);
+
+    // number of independent variables
+    size_t n = ind_taddr_.size();
+
+    // number of dependent variables
+    size_t m = dep_taddr_.size();
+
+    // check BaseVector is Simple Vector class with Base type elements
+    CheckSimpleVector<Base, BaseVector>();
+
+    CPPAD_ASSERT_KNOWN(
+        q == 1,
+        "dw = f.Reverse(q, r, w): q is not equal to one."
+    );
+    CPPAD_ASSERT_KNOWN(
+        r > 0,
+        "dw = f.Reverse(q, r, w): r is zero."
+    );
+    CPPAD_ASSERT_KNOWN(
+        size_t(w.size()) == m * r,
+        "dw = f.Reverse(q, r, w): w.size() is not equal to\n"
+        "the dimension of the range times r."
+    );
+    CPPAD_ASSERT_KNOWN(
+        num_order_taylor_ >= 1,
+        "dw = f.Reverse(q, r, w): zero order Taylor coefficients are not"
+        " stored in this ADFun object."
+    );
+    // only using the zero order forward results
+    if( num_direction_taylor_ > 1 )
+    {   num_order_taylor_ = 1;        // number of orders to copy
+        size_t c = cap_order_taylor_; // keep the same capacity setting
+        size_t one = 1;               // only keep one direction
+        capacity_order(c, one);
+    }
+    CPPAD_ASSERT_UNKNOWN( num_direction_taylor_ == 1 );
+
+    // initialize entire Partial matrix to zero
+    local::pod_vector_maybe<Base>& Partial( reverse_partial_ );
+    Partial.resize(num_var_tape_ * r);
+    for(size_t i = 0; i < num_var_tape_ * r; i++)
+        Partial[i] = zero;
+
+    // set the dependent variable directions
+    // (use += because two dependent variables can point to same location)
+    for(size_t i = 0; i < m; i++)
+    {   CPPAD_ASSERT_UNKNOWN( dep_taddr_[i] < num_var_tape_  );
+        for(size_t ell = 0; ell < r; ell++)
+            Partial[ dep_taddr_[i] * r + ell ] += w[i * r + ell];
+    }
+
+    // evaluate the derivatives
+    CPPAD_ASSERT_UNKNOWN( cskip_op_.size() == play_.num_op_rec() );
+    CPPAD_ASSERT_UNKNOWN( load_op2var_.size()  == play_.num_var_load_rec() );
+    local::sweep::reverse_dir(
+        n,
+        num_var_tape_,
+        &play_,
+        cap_order_taylor_,
+        taylor_.data(),
+        r,
+        Partial.data(),
+        cskip_op_.data(),
+        load_op2var_,
+        not_used_rec_base
+    );
+
+    // return the derivative values
+    BaseVector value(n * r);
+    for(size_t j = 0; j < n; j++)
+    {   CPPAD_ASSERT_UNKNOWN( ind_taddr_[j] < num_var_tape_  );
+        for(size_t ell = 0; ell < r; ell++)
+            value[j * r + ell] = Partial[ ind_taddr_[j] * r + ell ];
+    }
+    CPPAD_ASSERT_KNOWN( ! ( hasnan(value) && check_for_nan_ ) ,
+        "dw = f.Reverse(q, r, w): has a nan,\n"
+        "but none of its Taylor coefficents are nan."
+    );
+
     return value;
 }
 
@@ -87,7 +87,7 @@ AD<Base> AD<Base>::sign_me (void) const
         result.taddr_   = tape->Rec_.put_dyn_par(
             result.value_, local::sign_dyn, taddr_
         );
-        result.tape_id_  = tape_id_;
+        result.set_tape_id(tape_id_);
         result.ad_type_  = dynamic_enum;
     }
     else
@@ -102,7 +102,7 @@ AD<Base> AD<Base>::sign_me (void) const
         result.taddr_ = tape->Rec_.PutOp(local::SignOp);
 
         // make result a variable
-        result.tape_id_ = tape->id_;
+        result.set_tape_id(tape->id_);
         result.ad_type_ = variable_enum;
     }
     return result;
@@ -18,6 +18,7 @@ in the Eclipse Public License, Version 2.0 are satisfied:
 //
 # include <cppad/core/for_hes_sparsity.hpp>
 # include <cppad/core/rev_hes_sparsity.hpp>
+# include <cppad/core/for_ter_sparsity.hpp>
 //
 # include <cppad/core/for_sparse_jac.hpp>
 # include <cppad/core/rev_sparse_jac.hpp>
@@ -27,6 +28,7 @@ in the Eclipse Public License, Version 2.0 are satisfied:
 //
 # include <cppad/core/sparse_jac.hpp>
 # include <cppad/core/sparse_hes.hpp>
+# include <cppad/core/sparse_ter.hpp>
 //
 # include <cppad/core/sparse_jacobian.hpp>
 # include <cppad/core/sparse_hessian.hpp>
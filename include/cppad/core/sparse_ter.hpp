@@ -0,0 +1,535 @@
+# ifndef CPPAD_CORE_SPARSE_TER_HPP
+# define CPPAD_CORE_SPARSE_TER_HPP
+/* --------------------------------------------------------------------------
+CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-21 Bradley M. Bell
+
+CppAD is distributed under the terms of the
+             Eclipse Public License Version 2.0.
+
+This Source Code may also be made available under the following
+Secondary License when the conditions for such availability set forth
+in the Eclipse Public License, Version 2.0 are satisfied:
+      GNU General Public License, Version 2.0 or later.
+---------------------------------------------------------------------------- */
+/*
+$begin sparse_ter$$
+$spell
+    const
+    Taylor
+    rc
+    rcv
+    nr
+    nc
+    ter
+    Hessian
+    Hessians
+    nnz
+$$
+
+$section Computing Sparse Third Order Tensors$$
+
+$head Syntax$$
+$icode%n_sweep% = %f%.sparse_ter(
+    %x%, %w%, %subset%, %pattern%, %work%
+)%$$
+
+$head Purpose$$
+We use $latex F : \B{R}^n \rightarrow \B{R}^m$$ to denote the
+function corresponding to $icode f$$.
+Here $icode n$$ is the $cref/domain/fun_property/Domain/$$ size,
+and $icode m$$ is the $cref/range/fun_property/Range/$$ size, or $icode f$$.
+The syntax above takes advantage of sparsity when computing the
+third order tensor
+$latex \[
+    T_{i,j,k} (x) = \frac{ \partial^3 }
+    { \partial x_i \partial x_j \partial x_k } \sum_{\ell=0}^{m-1} w_\ell F_\ell (x)
+\] $$
+This extends $cref sparse_hes$$ to third order derivatives.
+The tensor is stored using the same
+$cref/tensor storage/for_ter_sparsity/Tensor Storage/$$ as
+$cref for_ter_sparsity$$; i.e., $latex T_{i,j,k}$$ corresponds to row
+$icode i$$ and column $icode%j%*%n%+%k%$$.
+
+$head Method$$
+The indices $latex \{ 0 , \ldots , n-1 \}$$ are partitioned into colors
+so that, for each row $latex i$$ in $icode subset$$,
+the indices $latex j$$ that appear in the possibly non-zero elements
+$latex T_{i,j,k}$$ all have different colors.
+Let $latex u_a$$ be the sum of the unit vectors with color $latex a$$.
+A first order forward sweep in direction $latex u$$,
+a second order forward sweep in direction zero,
+and a third order reverse sweep, compute
+$latex T(x)[u, u, \cdot]$$.
+This is done for $latex u = u_a$$ and $latex u = u_a + u_b$$
+for each pair of colors $latex (a, b)$$ required by $icode subset$$.
+The values $latex T(x)[u_a, u_b, \cdot]$$ are obtained from these
+using the polarization identity and they contain
+the requested tensor elements.
+
+$head SizeVector$$
+The type $icode SizeVector$$ is a $cref SimpleVector$$ class with
+$cref/elements of type/SimpleVector/Elements of Specified Type/$$
+$code size_t$$.
+
+$head BaseVector$$
+The type $icode BaseVector$$ is a $cref SimpleVector$$ class with
+$cref/elements of type/SimpleVector/Elements of Specified Type/$$
+$icode Base$$.
+
+$head f$$
+This object has prototype
+$codei%
+    ADFun<%Base%> %f%
+%$$
+Note that the Taylor coefficients stored in $icode f$$ are affected
+by this operation; see
+$cref/uses forward/sparse_ter/Uses Forward/$$ below.
+
+$head x$$
+This argument has prototype
+$codei%
+    const %BaseVector%& %x%
+%$$
+and its size is $icode n$$.
+It specifies the point at which to evaluate the tensor
+$latex T(x)$$.
+
+$head w$$
+This argument has prototype
+$codei%
+    const %BaseVector%& %w%
+%$$
+and its size is $icode m$$.
+It specifies the weight for each of the components of $latex F(x)$$;
+i.e. $latex w_\ell$$ is the weight for $latex F_\ell (x)$$.
+
+$head subset$$
+This argument has prototype
+$codei%
+    sparse_rcv<%SizeVector%, %BaseVector%>& %subset%
+%$$
+Its row size is $icode n$$ and its column size is $icode%n%*%n%$$; i.e.,
+$icode%subset%.nr() == %n%$$ and $icode%subset%.nc() == %n%*%n%$$.
+It specifies which elements of the tensor are computed.
+$list number$$
+The input value of its value vector
+$icode%subset%.val()%$$ does not matter.
+Upon return it contains the value of the corresponding elements
+of the tensor.
+$lnext
+All of the elements in $icode subset$$ must also appear in
+$icode pattern$$; i.e., they must be possibly non-zero.
+$lnext
+The tensor is symmetric, so one has a choice as to which permutation
+of the indices $latex (i, j, k)$$ to put in $icode subset$$.
+Using fewer distinct rows $icode i$$ may result in fewer colors
+and hence fewer $cref/sweeps/sparse_ter/n_sweep/$$.
+$lend
+
+$head pattern$$
+This argument has prototype
+$codei%
+    const sparse_rc<%SizeVector%>& %pattern%
+%$$
+Its row size is $icode n$$ and its column size is $icode%n%*%n%$$.
+It is a symmetric sparsity pattern for the tensor $latex T(x)$$;
+see $cref/pattern_out/for_ter_sparsity/pattern_out/$$.
+If the $th i$$ row does not appear in $icode subset$$,
+the $th i$$ row of $icode pattern$$ does not matter.
+This argument is not used (and need not satisfy any conditions),
+when $cref/work/sparse_ter/work/$$ is non-empty.
+
+$head work$$
+This argument has prototype
+$codei%
+    sparse_ter_work& %work%
+%$$
+We refer to its initial value,
+and its value after $icode%work%.clear()%$$, as empty.
+If it is empty, the coloring and the list of sweeps
+are stored in $icode work$$.
+This can be used to reduce computation when
+a future call is for the same object $icode f$$,
+and the same subset of the tensor.
+If either of these values change, use $icode%work%.clear()%$$ to
+empty this structure.
+
+$head n_sweep$$
+The return value $icode n_sweep$$ has prototype
+$codei%
+    size_t %n_sweep%
+%$$
+It is the number of third order reverse sweeps
+used to compute the requested tensor values.
+Each reverse sweep is preceded by a first and second order forward sweep.
+If $icode n_color$$ is the number of colors,
+$icode n_sweep$$ is less than or equal
+$icode%n_color%*(%n_color%+1)/2%$$.
+
+$head Uses Forward$$
+After each call to $cref Forward$$,
+the object $icode f$$ contains the corresponding
+$cref/Taylor coefficients/glossary/Taylor Coefficient/$$.
+After a call to $code sparse_ter$$
+the zero order coefficients correspond to
+$codei%
+    %f%.Forward(0, %x%)
+%$$
+All the other forward mode coefficients are unspecified.
+
+$head Example$$
+$children%
+    example/sparse/sparse_ter.cpp
+%$$
+The file $cref sparse_ter.cpp$$
+is an example and test of $code sparse_ter$$.
+It returns $code true$$, if it succeeds, and $code false$$ otherwise.
+
+$end
+*/
+# include <cppad/core/cppad_assert.hpp>
+# include <cppad/local/sparse/internal.hpp>
+
+/*!
+\file sparse_ter.hpp
+Sparse third order tensor calculation routines.
+*/
+namespace CppAD { // BEGIN_CPPAD_NAMESPACE
+
+/*!
+Class used to hold information used by sparse_ter routine in this file,
+so it does not need to be recomputed every time.
+*/
+class sparse_ter_work {
+    public:
+        /// row and column indicies for return values
+        CppAD::vector<size_t> row;
+        CppAD::vector<size_t> col;
+        /// results of the coloring algorithm
+        CppAD::vector<size_t> color;
+        /// color pair a * n + b, a <= b, for each sweep
+        CppAD::vector<size_t> sweep;
+        /// contributions for sweep s are start[s] <= t < start[s+1]
+        CppAD::vector<size_t> start;
+        /// index in row, col of the element for each contribution
+        CppAD::vector<size_t> entry;
+        /// coefficient for each contribution
+        CppAD::vector<int>    coef;
+
+        /// constructor
+        sparse_ter_work(void)
+        { }
+        /// inform CppAD that this information needs to be recomputed
+        void clear(void)
+        {   row.clear();
+            col.clear();
+            color.clear();
+            sweep.clear();
+            start.clear();
+            entry.clear();
+            coef.clear();
+        }
+};
+// ----------------------------------------------------------------------------
+/*!
+Calculate sparse third order tensors using forward and reverse mode
+
+\tparam Base
+the base type for the recording that is stored in the ADFun object.
+
+\tparam SizeVector
+a simple vector class with elements of type size_t.
+
+\tparam BaseVector
+a simple vector class with elements of type Base.
+
+\param x
+a vector of length n, the number of independent variables in f
+(this ADFun object).
+
+\param w
+a vector of length m, the number of dependent variables in f
+(this ADFun object).
+
+\param subset
+specifices the subset of the sparsity pattern where the tensor is evaluated.
+subset.nr() == n,
+subset.nc() == n * n.
+
+\param pattern
+is a symmetric sparsity pattern for the tensor of w^T * f;
+pattern.nr() == n,
+pattern.nc() == n * n.
+
+\param work
+this structure must be empty, or contain the information stored
+by a previous call to sparse_ter.
+The previous call must be for the same ADFun object f
+and the same subset.
+
+\return
+This is the number of third order reverse sweeps used to compute the tensor.
+*/
+template <class Base, class RecBase>
+template <class SizeVector, class BaseVector>
+size_t ADFun<Base,RecBase>::sparse_ter(
+    const BaseVector&                    x        ,
+    const BaseVector&                    w        ,
+    sparse_rcv<SizeVector , BaseVector>& subset   ,
+    const sparse_rc<SizeVector>&         pattern  ,
+    sparse_ter_work&                     work     )
+{   size_t n = Domain();
+    //
+    CPPAD_ASSERT_KNOWN(
+        subset.nr() == n,
+        "sparse_ter: subset.nr() not equal domain dimension for f"
+    );
+    CPPAD_ASSERT_KNOWN(
+        subset.nc() == n * n,
+        "sparse_ter: subset.nc() not equal square of domain dimension for f"
+    );
+    CPPAD_ASSERT_KNOWN(
+        size_t( x.size() ) == n,
+        "sparse_ter: x.size() not equal domain dimension for f"
+    );
+    CPPAD_ASSERT_KNOWN(
+        size_t( w.size() ) == Range(),
+        "sparse_ter: w.size() not equal range dimension for f"
+    );
+    //
+    // work information
+    vector<size_t>& row(work.row);
+    vector<size_t>& col(work.col);
+    vector<size_t>& color(work.color);
+    vector<size_t>& sweep(work.sweep);
+    vector<size_t>& start(work.start);
+    vector<size_t>& entry(work.entry);
+    vector<int>&    coef(work.coef);
+    //
+    // subset information
+    const SizeVector& subset_row( subset.row() );
+    const SizeVector& subset_col( subset.col() );
+    //
+    // point at which we are evaluationg the tensor
+    Forward(0, x);
+    //
+    // number of elements in the subset
+    size_t K = subset.nnz();
+    //
+    // check for case were there is nothing to do
+    // (except for call to Forward(0, x)
+    if( K == 0 )
+        return 0;
+    //
+# ifndef NDEBUG
+    if( color.size() != 0 )
+    {   CPPAD_ASSERT_KNOWN(
+            color.size() == n && row.size() == K && col.size() == K,
+            "sparse_ter: work is non-empty and conditions have changed"
+        );
+        for(size_t k = 0; k < K; k++)
+        {   bool ok = row[k] == subset_row[k] && col[k] == subset_col[k];
+            CPPAD_ASSERT_KNOWN(
+                ok,
+                "sparse_ter: work is non-empty and conditions have changed"
+            );
+        }
+    }
+# endif
+    //
+    // check for case where input work is empty
+    if( color.size() == 0 )
+    {   CPPAD_ASSERT_KNOWN(
+            pattern.nr() == n,
+            "sparse_ter: pattern.nr() not equal domain dimension for f"
+        );
+        CPPAD_ASSERT_KNOWN(
+            pattern.nc() == n * n,
+            "sparse_ter: pattern.nc() not equal square of domain dimension"
+        );
+        //
+        // initialize work row, col to be same as subset row, col
+        row.resize(K);
+        col.resize(K);
+        vector<bool> in_subset(n);
+        for(size_t i = 0; i < n; i++)
+            in_subset[i] = false;
+        for(size_t k = 0; k < K; k++)
+        {   row[k] = subset_row[k];
+            col[k] = subset_col[k];
+            in_subset[ row[k] ] = true;
+        }
+        //
+        // index_set[i] = indices j that appear in the pattern for row i
+        // row_set[j]   = rows i such that j is in index_set[i]
+        // (only rows that appear in subset are included)
+        local::sparse::list_setvec index_set, row_set;
+        index_set.resize(n, n);
+        row_set.resize(n, n);
+        const SizeVector& pattern_row( pattern.row() );
+        const SizeVector& pattern_col( pattern.col() );
+        for(size_t k = 0; k < pattern.nnz(); k++)
+        {   size_t i = pattern_row[k];
+            if( in_subset[i] )
+            {   size_t j  = pattern_col[k] / n;
+                size_t jj = pattern_col[k] % n;
+                index_set.add_element(i, j);
+                index_set.add_element(i, jj);
+                row_set.add_element(j, i);
+                row_set.add_element(jj, i);
+            }
+        }
+        //
+        // greedy coloring: indices in the same index_set get different colors
+        typedef local::sparse::list_setvec_const_iterator set_itr;
+        color.resize(n);
+        vector<size_t> forbidden(n);
+        for(size_t j = 0; j < n; j++)
+        {   color[j]     = n;
+            forbidden[j] = n;
+        }
+        size_t n_color = 0;
+        for(size_t j = 0; j < n; j++)
+        {   set_itr itr_i(row_set, j);
+            size_t i = *itr_i;
+            if( i != n )
+            {   while( i != n )
+                {   set_itr itr_jj(index_set, i);
+                    size_t jj = *itr_jj;
+                    while( jj != n )
+                    {   if( color[jj] < n )
+                            forbidden[ color[jj] ] = j;
+                        jj = *(++itr_jj);
+                    }
+                    i = *(++itr_i);
+                }
+                size_t c = 0;
+                while( forbidden[c] == j )
+                    ++c;
+                color[j] = c;
+                n_color  = std::max(n_color, c + 1);
+            }
+        }
+        //
+        // color pairs required for each element of subset
+        vector<size_t> key(3 * K);
+        for(size_t k = 0; k < K; k++)
+        {   size_t a = color[ col[k] / n ];
+            size_t b = color[ col[k] % n ];
+            CPPAD_ASSERT_KNOWN( a < n && b < n,
+                "sparse_ter: an element of subset is not in pattern"
+            );
+            if( b < a )
+                std::swap(a, b);
+            key[3 * k + 0] = a * n + b;
+            key[3 * k + 1] = a * n + a;
+            key[3 * k + 2] = b * n + b;
+        }
+        //
+        // sweep = the sorted distinct color pairs
+        vector<size_t> order(3 * K);
+        index_sort(key, order);
+        sweep.resize(0);
+        for(size_t t = 0; t < 3 * K; t++)
+        {   size_t s = sweep.size();
+            if( s == 0 || sweep[s - 1] != key[ order[t] ] )
+                sweep.push_back( key[ order[t] ] );
+        }
+        size_t n_sweep = sweep.size();
+        //
+        // contributions to each element of subset:
+        // a == b: T[i,j,k] = 2 * dw(u_a)
+        // a <  b: T[i,j,k] = dw(u_a + u_b) - dw(u_a) - dw(u_b)
+        // where dw(u) = T[u,u,i] / 2 is the third order reverse result
+        start.resize(n_sweep + 1);
+        for(size_t s = 0; s <= n_sweep; s++)
+            start[s] = 0;
+        vector<size_t> con_sweep(3 * K), con_entry(3 * K);
+        vector<int>    con_coef(3 * K);
+        size_t n_con = 0;
+        for(size_t k = 0; k < K; k++)
+        {   size_t n_term = 3;
+            if( key[3 * k + 1] == key[3 * k + 0] )
+                n_term = 1;
+            for(size_t ell = 0; ell < n_term; ell++)
+            {   size_t s = size_t( std::lower_bound(
+                    sweep.data(), sweep.data() + n_sweep, key[3 * k + ell]
+                ) - sweep.data() );
+                CPPAD_ASSERT_UNKNOWN( sweep[s] == key[3 * k + ell] );
+                con_sweep[n_con] = s;
+                con_entry[n_con] = k;
+                if( n_term == 1 )
+                    con_coef[n_con] = 2;
+                else if( ell == 0 )
+                    con_coef[n_con] = 1;
+                else
+                    con_coef[n_con] = -1;
+                ++start[s + 1];
+                ++n_con;
+            }
+        }
+        for(size_t s = 0; s < n_sweep; s++)
+            start[s + 1] += start[s];
+        //
+        // put contributions in sweep order
+        entry.resize(n_con);
+        coef.resize(n_con);
+        vector<size_t> next(n_sweep);
+        for(size_t s = 0; s < n_sweep; s++)
+            next[s] = start[s];
+        for(size_t t = 0; t < n_con; t++)
+        {   size_t s = con_sweep[t];
+            entry[ next[s] ] = con_entry[t];
+            coef[ next[s] ]  = con_coef[t];
+            ++next[s];
+        }
+    }
+    // Base versions of zero and one
+    Base one(1.0);
+    Base zero(0.0);
+    //
+    // accumulate the return tensor values
+    BaseVector val(K);
+    for(size_t k = 0; k < K; k++)
+        val[k] = zero;
+    //
+    // direction vectors for calls to first and second order forward
+    BaseVector dx(n), ddx(n);
+    for(size_t j = 0; j < n; j++)
+        ddx[j] = zero;
+    //
+    // return values for calls to third order reverse
+    BaseVector dw(3 * n);
+    //
+    // loop over sweeps
+    size_t n_sweep = sweep.size();
+    for(size_t s = 0; s < n_sweep; s++)
+    {   size_t a = sweep[s] / n;
+        size_t b = sweep[s] % n;
+        //
+        // combine all indices with color a or color b
+        for(size_t j = 0; j < n; j++)
+        {   dx[j] = zero;
+            if( color[j] == a || color[j] == b )
+                dx[j] = one;
+        }
+        Forward(1, dx);
+        Forward(2, ddx);
+        dw = Reverse(3, w);
+        //
+        // dw[i * 3 + 2] is the partial of the second order coefficient
+        // w^T F^{(2)} (x) [u, u] / 2 w.r.t. the zero order coefficient x_i
+        for(size_t t = start[s]; t < start[s + 1]; t++)
+        {   size_t k = entry[t];
+            val[k]  += Base( double( coef[t] ) ) * dw[ row[k] * 3 + 2 ];
+        }
+    }
+    for(size_t k = 0; k < K; k++)
+        subset.set(k, val[k]);
+    //
+    return n_sweep;
+}
+
+} // END_CPPAD_NAMESPACE
+
+# endif
@@ -739,14 +739,14 @@ acos, asin, atan, cos, cosh, exp, fabs, log, sin, sinh, sqrt, tan, tanh.
         {   result.taddr_ = tape->Rec_.put_dyn_par(               \
                 result.value_, local::Name##_dyn, taddr_          \
             );                                                    \
-            result.tape_id_ = tape_id_;                           \
+            result.set_tape_id(tape_id_);                         \
             result.ad_type_ = dynamic_enum;                 \
         }                                                         \
         else                                                      \
         {   CPPAD_ASSERT_UNKNOWN( NumArg(Op) == 1 );              \
             tape->Rec_.PutArg(taddr_);                            \
             result.taddr_    = tape->Rec_.PutOp(Op);              \
-            result.tape_id_  = tape->id_;                         \
+            result.set_tape_id(tape->id_);                        \
             result.ad_type_  = variable_enum;                \
         }                                                         \
         return result;                                            \
@@ -817,7 +817,7 @@ namespace CppAD {
             result.taddr_   = tape->Rec_.put_dyn_par(
                 result.value_, op, taddr_
             );
-            result.tape_id_  = tape_id_;
+            result.set_tape_id(tape_id_);
             result.ad_type_  = dynamic_enum;
         }
         else
@@ -842,7 +842,7 @@ namespace CppAD {
             tape->Rec_.PutArg(p);
             //
             result.taddr_   = tape->Rec_.PutOp(op);
-            result.tape_id_ = tape->id_;
+            result.set_tape_id(tape->id_);
             result.ad_type_ = variable_enum;
         }
         return result;
@@ -59,7 +59,7 @@ AD<Base> operator - (const AD<Base> &left , const AD<Base> &right)
             // put operator in the tape
             result.taddr_ = tape->Rec_.PutOp(local::SubvvOp);
             // make result a variable
-            result.tape_id_ = tape_id;
+            result.set_tape_id(tape_id);
             result.ad_type_ = variable_enum;
         }
         else if( (! dyn_right) & IdenticalZero(right.value_) )
@@ -79,7 +79,7 @@ AD<Base> operator - (const AD<Base> &left , const AD<Base> &right)
             // put operator in the tape
             result.taddr_ = tape->Rec_.PutOp(local::SubvpOp);
             // make result a variable
-            result.tape_id_ = tape_id;
+            result.set_tape_id(tape_id);
             result.ad_type_ = variable_enum;
         }
     }
@@ -96,7 +96,7 @@ AD<Base> operator - (const AD<Base> &left , const AD<Base> &right)
         // put operator in the tape
         result.taddr_ = tape->Rec_.PutOp(local::SubpvOp);
         // make result a variable
-        result.tape_id_ = tape_id;
+        result.set_tape_id(tape_id);
         result.ad_type_ = variable_enum;
     }
     else if( dyn_left | dyn_right )
@@ -111,7 +111,7 @@ AD<Base> operator - (const AD<Base> &left , const AD<Base> &right)
         result.taddr_   = tape->Rec_.put_dyn_par(
             result.value_, local::sub_dyn,   arg0, arg1
         );
-        result.tape_id_ = tape_id;
+        result.set_tape_id(tape_id);
         result.ad_type_ = dynamic_enum;
     }
     return result;
@@ -96,7 +96,7 @@ AD<Base>& AD<Base>::operator -= (const AD<Base> &right)
         taddr_ = tape->Rec_.PutOp(local::SubpvOp);
 
         // make this a variable
-        tape_id_ = tape_id;
+        set_tape_id(tape_id);
         ad_type_ = variable_enum;
     }
     else if( dyn_left | dyn_right )
@@ -111,7 +111,7 @@ AD<Base>& AD<Base>::operator -= (const AD<Base> &right)
         taddr_ = tape->Rec_.put_dyn_par(
                 value_, local::sub_dyn, arg0, arg1
         );
-        tape_id_ = tape_id;
+        set_tape_id(tape_id);
         ad_type_ = dynamic_enum;
     }
     return *this;
@@ -27,6 +27,8 @@ $spell
     const
     Bool
     nnz
+    num
+    alloc
 $$
 
 $section Compute Sparse Jacobians Using Subgraphs$$
@@ -34,6 +36,8 @@ $section Compute Sparse Jacobians Using Subgraphs$$
 $head Syntax$$
 $icode%f%.subgraph_jac_rev(%x%, %subset%)
 %$$
+$icode%f%.subgraph_jac_rev(%subset%, %work%)
+%$$
 $icode%f%.subgraph_jac_rev(
     %select_domain%, %select_range%, %x%, %matrix_out%
 )%$$
@@ -65,6 +69,29 @@ containing the variables that affect the dependent variable.
 This avoids the overhead of performing set operations
 that is inherent in other methods for computing sparsity patterns.
 
+$head Parallel Mode$$
+The rows of the Jacobian are computed one at a time by this routine.
+The second syntax divides the rows between the threads.
+In sequential execution mode, first call
+$codei%
+    %f%.Forward(0, %x%)
+    %f%.subgraph_reverse(%select_domain%)
+%$$
+where $icode%select_domain%[%j%]%$$ is true for every column index
+$icode j$$ in $icode subset$$.
+Then each thread in parallel mode calls
+$codei%
+    %f%.subgraph_jac_rev(%subset%, %work%)
+%$$
+with the same $icode subset$$ and its own $icode work$$ object.
+The call by thread number $icode t$$ computes the rows $icode i$$
+for which the remainder of $icode i$$ divided by $icode num_threads$$
+is $icode t$$.
+Here $icode num_threads$$ is the
+$cref/number of threads/ta_num_threads/$$ for $code thread_alloc$$.
+When all the threads have returned,
+$icode subset$$ contains the values for all its rows.
+
 $head BaseVector$$
 The type $icode BaseVector$$ is a $cref SimpleVector$$ class with
 $cref/elements of type/SimpleVector/Elements of Specified Type/$$
@@ -119,6 +146,16 @@ The input elements in its value vector
 $icode%subset%.val()%$$ do not matter.
 Upon return it contains the value of the corresponding elements
 of the Jacobian.
+If $icode work$$ is present, only the elements in the rows
+for this thread are set; see $cref/parallel mode/subgraph_jac_rev/Parallel Mode/$$.
+
+$head work$$
+This argument has prototype
+$codei%
+    subgraph_work<%Base%>& %work%
+%$$
+It is the $cref/work/subgraph_reverse/work/$$ object for this thread.
+It must be created, used, and destroyed by this thread.
 
 $head select_domain$$
 The argument $icode select_domain$$ has prototype
@@ -169,6 +206,8 @@ $children%
 The files $cref subgraph_jac_rev.cpp$$ and $cref subgraph_hes2jac.cpp$$
 are examples and tests using $code subgraph_jac_rev$$.
 They returns $code true$$ for success and $code false$$ for failure.
+The file $cref team_subgraph_jac.cpp$$ divides the rows between
+a team of threads.
 
 $end
 -----------------------------------------------------------------------------
@@ -259,7 +298,7 @@ void ADFun<Base,RecBase>::subgraph_jac_rev(
                 ++c;
             //
             // check for match with i_ind
-            if( i_ind == dw_col[c] )
+            if( c < size_t( dw_col.size() ) && i_ind == dw_col[c] )
                 subset.set( row_major[k], dw[i_ind] );
             else
                 subset.set( row_major[k], zero);
@@ -278,6 +317,98 @@ void ADFun<Base,RecBase>::subgraph_jac_rev(
     }
     return;
 }
+/*!
+Subgraph Jacobian for the rows corresponding to this thread.
+
+\tparam Base
+is the base type for this recording.
+
+\tparam SizeVector
+is the simple vector with elements of type size_t that is used for
+row, column index sparsity patterns.
+
+\tparam BaseVector
+a simple vector class with elements of type Base.
+
+\param subset
+specifices the subset of the sparsity pattern where the Jacobian is evaluated.
+subset.nr() == m,
+subset.nc() == n.
+Only the values in rows i with i % num_threads == thread_num are set.
+
+\param work
+is the subgraph_reverse workspace for this thread.
+
+\par Assumptions
+The zero order Taylor coefficients have been computed,
+and subgraph_reverse(select_domain) has been called with
+select_domain true for all the columns in subset.
+*/
+template <class Base, class RecBase>
+template <class SizeVector, class BaseVector>
+void ADFun<Base,RecBase>::subgraph_jac_rev(
+    sparse_rcv<SizeVector, BaseVector>& subset ,
+    subgraph_work<Base>&                work   )
+{   size_t m = Range();
+    size_t n = Domain();
+    //
+    CPPAD_ASSERT_KNOWN(
+        subset.nr() == m,
+        "subgraph_jac_rev: subset.nr() not equal range dimension for f"
+    );
+    CPPAD_ASSERT_KNOWN(
+        subset.nc() == n,
+        "subgraph_jac_rev: subset.nc() not equal domain dimension for f"
+    );
+    //
+    // rows computed by this thread
+    size_t num_threads = thread_alloc::num_threads();
+    size_t thread_num  = thread_alloc::thread_num();
+    //
+    // nnz and row, column, and row_major vectors for subset
+    size_t nnz = subset.nnz();
+    const SizeVector& row( subset.row() );
+    const SizeVector& col( subset.col() );
+    SizeVector row_major = subset.row_major();
+    //
+    // memory used to hold subgraph_reverse results
+    BaseVector dw;
+    SizeVector dw_col;
+    //
+    // initialize index in row_major
+    size_t k = 0;
+    Base zero(0);
+    while(k < nnz )
+    {   size_t ell = row[ row_major[k] ];
+        if( ell % num_threads != thread_num )
+        {   // skip this row
+            while( k < nnz && row[ row_major[k] ] == ell )
+                ++k;
+        }
+        else
+        {   size_t q = 1;
+            subgraph_reverse(q, ell, dw_col, dw, work);
+            //
+            size_t c = 0;
+            while( k < nnz && row[ row_major[k] ] == ell )
+            {   size_t i_ind = col[ row_major[k] ];
+                //
+                // advance c to possible match with column i_ind
+                while( c < size_t( dw_col.size() ) && dw_col[c] < i_ind )
+                    ++c;
+                //
+                // check for match with i_ind
+                if( c < size_t( dw_col.size() ) && dw_col[c] == i_ind )
+                    subset.set( row_major[k], dw[i_ind] );
+                else
+                    subset.set( row_major[k], zero);
+                //
+                ++k;
+            }
+        }
+    }
+    return;
+}
 template <class Base, class RecBase>
 template <class BoolVector, class SizeVector, class BaseVector>
 void ADFun<Base,RecBase>::subgraph_jac_rev(
@@ -21,6 +21,7 @@ $spell
     Taylor
     Bool
     const
+    openmp
 $$
 
 $section Reverse Mode Using Subgraphs$$
@@ -30,6 +31,8 @@ $icode%f%.subgraph_reverse(%select_domain%)
 %$$
 $icode%f%.subgraph_reverse(%q%, %ell%, %col%, %dw%)
 %$$
+$icode%f%.subgraph_reverse(%q%, %ell%, %col%, %dw%, %work%)
+%$$
 $icode%f%.clear_subgraph()
 %$$
 
@@ -135,6 +138,47 @@ independent variable where $icode%j% = %col%[%c%]%$$.
 Note that this corresponds to the $cref reverse_any$$ convention when
 $cref/w/reverse_any/w/$$ has size $icode%m% * %q%$$.
 
+$head work$$
+If this argument is present, it has prototype
+$codei%
+    subgraph_work<%Base%>& %work%
+%$$
+It holds the information that changes for each dependent variable
+$icode ell$$.
+If it is not present, this information is stored in $icode f$$.
+The information that is shared by all the dependent variables
+is computed by the call that selects the domain
+and is not changed by the calls that compute derivatives.
+
+$subhead Index ell$$
+Each dependent variable index $icode ell$$ can only be used once,
+after a call that selects the domain,
+for all the calls that use the same $icode work$$ object.
+The same $icode ell$$ can be used with a different $icode work$$ object.
+The first use of $icode work$$ after a call that selects the domain
+includes the dependent variables that were already used
+without a $icode work$$ argument.
+
+$subhead Parallel Mode$$
+Calls that use different $icode work$$ objects,
+and the same function object $icode f$$,
+can be made at the same time by different threads;
+e.g., the rows of a sparse Jacobian can be divided between threads.
+The call that selects the domain and the call to $cref/Forward/forward_zero/$$
+that sets the Taylor coefficients must be done before
+these calls and in sequential execution mode.
+Each thread must have its own $icode work$$ object.
+It must be created, used, and destroyed by that thread.
+See $cref/parallel_setup/ta_parallel_setup/$$ for the setup
+needed before using CppAD in parallel mode.
+
+$head work.clear()$$
+The syntax
+$codei%
+    %work%.clear()
+%$$
+frees the memory used by $icode work$$.
+
 $head clear_subgraph$$
 Calling this routine will free memory that holds
 information between calls to subgraph calculations so that
@@ -160,6 +204,37 @@ namespace CppAD { // BEGIN_CPPAD_NAMESPACE
 Compute derivatvies using reverse mode and subgraphs.
 */
 
+/*!
+Class used to hold the information for subgraph reverse mode
+that changes for each dependent variable.
+The information that is the same for all the dependent variables is in
+the subgraph_info_ for the ADFun object.
+*/
+template <class Base>
+class subgraph_work {
+    public:
+        /// number of init_rev calls for the subgraph_info_ that in_subgraph
+        /// and process_range were copied from (zero for not copied)
+        size_t n_init_rev;
+        /// copy of in_subgraph for this workspace
+        local::pod_vector<addr_t> in_subgraph;
+        /// copy of process_range for this workspace
+        local::pod_vector<bool> process_range;
+        /// partial derivatives for the reverse mode sweep
+        local::pod_vector_maybe<Base> partial;
+        //
+        /// constructor
+        subgraph_work(void) : n_init_rev(0)
+        { }
+        /// free the memory used by this workspace
+        void clear(void)
+        {   n_init_rev = 0;
+            in_subgraph.clear();
+            process_range.clear();
+            partial.clear();
+        }
+};
+
 /// clear all subgraph information
 template <class Base, class RecBase>
 void ADFun<Base,RecBase>::clear_subgraph(void)
@@ -233,6 +308,8 @@ void ADFun<Base,RecBase>::subgraph_reverse( const BoolVector& select_domain )
         subgraph_info_.in_subgraph().size() == play_.num_op_rec()
     );
 
+    // memory used by the subgraph information
+    memory_high_water();
     return;
 }
 
@@ -281,21 +358,35 @@ where the matrix \f$ x \f$ is the value for \f$ u \f$
 that corresponding to the forward mode Taylor coefficients
 for the independent variables as specified by previous calls to Forward.
 
-\par subgraph_info.process_range()
-The element process_range[ell] is set to true by this operation.
-
-\par subgraph_info.in_subgraph_
-some of the elements of this vector are set to have value ell
+\param in_subgraph
+is subgraph_info_.in_subgraph() or a copy of it made after the previous
+subgraph_reverse(select_domain).
+Some of the elements of this vector are set to have value ell
 (so it can not longer be used to determine the subgraph corresponding to
 the ell-th dependent variable).
+
+\param process_range
+is subgraph_info_.process_range() or a copy of it made after the previous
+subgraph_reverse(select_domain).
+The element process_range[ell] is set to true by this operation.
+
+\param partial
+is the workspace used for the partial derivatives.
+
+\par
+Calls that use different in_subgraph, process_range, and partial
+vectors do not modify this ADFun object.
 */
 template <class Base, class RecBase>
 template <class Addr, class BaseVector, class SizeVector>
 void ADFun<Base,RecBase>::subgraph_reverse_helper(
-    size_t      q   ,
-    size_t      ell ,
-    SizeVector& col ,
-    BaseVector& dw  )
+    size_t                          q             ,
+    size_t                          ell           ,
+    SizeVector&                     col           ,
+    BaseVector&                     dw            ,
+    local::pod_vector<addr_t>&      in_subgraph   ,
+    local::pod_vector<bool>&        process_range ,
+    local::pod_vector_maybe<Base>&  partial       )
 {   using local::pod_vector;
     // used to identify the RecBase type in calls to sweeps
     RecBase not_used_rec_base(0.0);
@@ -326,7 +417,7 @@ void ADFun<Base,RecBase>::subgraph_reverse_helper(
         "dependent variable index in to large for this function"
     );
     CPPAD_ASSERT_KNOWN(
-        subgraph_info_.process_range()[ell] == false,
+        process_range[ell] == false,
         "This dependent variable index has already been processed\n"
         "after the previous subgraph_reverse(select_domain)."
     );
@@ -334,7 +425,12 @@ void ADFun<Base,RecBase>::subgraph_reverse_helper(
     // subgraph of operators connected to dependent variable ell
     pod_vector<addr_t> subgraph;
     subgraph_info_.get_rev(
-        random_itr, dep_taddr_, addr_t(ell), subgraph
+        random_itr,
+        dep_taddr_,
+        addr_t(ell),
+        in_subgraph,
+        process_range,
+        subgraph
     );
 
     // Add all the atomic function call operators
@@ -361,9 +457,9 @@ void ADFun<Base,RecBase>::subgraph_reverse_helper(
     std::cout << "}\n";
     */
 
-    // initialize subgraph_partial_ matrix to zero on subgraph
+    // initialize partial matrix to zero on subgraph
     Base zero(0);
-    subgraph_partial_.resize(num_var_tape_ * q);
+    partial.resize(num_var_tape_ * q);
     for(size_t k = 0; k < subgraph.size(); ++k)
     {
         size_t               i_op = size_t( subgraph[k] );
@@ -385,13 +481,13 @@ void ADFun<Base,RecBase>::subgraph_reverse_helper(
             size_t j_var = i_var + 1 - NumRes(op);
             for(size_t i = j_var; i <= i_var; ++i)
             {   for(size_t j = 0; j < q; ++j)
-                    subgraph_partial_[i * q + j] = zero;
+                    partial[i * q + j] = zero;
             }
         }
     }
 
     // set partial to one for component we are differentiating
-    subgraph_partial_[ dep_taddr_[ell] * q + q - 1] = Base(1);
+    partial[ dep_taddr_[ell] * q + q - 1] = Base(1);
 
     // evaluate the derivatives
     CPPAD_ASSERT_UNKNOWN( cskip_op_.size() == play_.num_op_rec() );
@@ -409,7 +505,7 @@ void ADFun<Base,RecBase>::subgraph_reverse_helper(
         cap_order_taylor_,
         taylor_.data(),
         q,
-        subgraph_partial_.data(),
+        partial.data(),
         cskip_op_.data(),
         load_op2var_,
         subgraph_itr,
@@ -445,7 +541,7 @@ void ADFun<Base,RecBase>::subgraph_reverse_helper(
         // return paritial for this independent variable
         col[c] = j;
         for(size_t k = 0; k < q; k++)
-            dw[j * q + k ] = subgraph_partial_[ind_taddr_[j] * q + k];
+            dw[j * q + k ] = partial[ind_taddr_[j] * q + k];
     }
     //
     CPPAD_ASSERT_KNOWN( ! ( hasnan(dw) && check_for_nan_ ) ,
@@ -467,20 +563,88 @@ void ADFun<Base,RecBase>::subgraph_reverse(
     SizeVector& col ,
     BaseVector& dw  )
 {   using local::pod_vector;
+    //
+    // the information that changes for each dependent variable
+    // is stored in this ADFun object
+    pod_vector<addr_t>& in_subgraph( subgraph_info_.in_subgraph() );
+    pod_vector<bool>& process_range( subgraph_info_.process_range() );
+    //
+    // call proper version of helper function
+    switch( play_.address_type() )
+    {
+        case local::play::unsigned_short_enum:
+        subgraph_reverse_helper<unsigned short>(
+            q, ell, col, dw, in_subgraph, process_range, subgraph_partial_
+        );
+        break;
+
+        case local::play::unsigned_int_enum:
+        subgraph_reverse_helper<unsigned int>(
+            q, ell, col, dw, in_subgraph, process_range, subgraph_partial_
+        );
+        break;
+
+        case local::play::size_t_enum:
+        subgraph_reverse_helper<size_t>(
+            q, ell, col, dw, in_subgraph, process_range, subgraph_partial_
+        );
+        break;
+
+        default:
+        CPPAD_ASSERT_UNKNOWN(false);
+    }
+    //
+    return;
+}
+/*!
+\copydoc subgraph_reverse_helper
+
+\param work
+is the workspace for this call. If it was not copied after the previous
+subgraph_reverse(select_domain), in_subgraph and process_range
+are copied from subgraph_info_.
+*/
+template <class Base, class RecBase>
+template <class BaseVector, class SizeVector>
+void ADFun<Base,RecBase>::subgraph_reverse(
+    size_t                q    ,
+    size_t                ell  ,
+    SizeVector&           col  ,
+    BaseVector&           dw   ,
+    subgraph_work<Base>&  work )
+{   using local::pod_vector;
+    //
+    CPPAD_ASSERT_KNOWN(
+        subgraph_info_.n_init_rev() > 0,
+        "subgraph_reverse: the domain has not been selected"
+    );
+    //
+    // copy the information that changes for each dependent variable
+    if( work.n_init_rev != subgraph_info_.n_init_rev() )
+    {   work.n_init_rev    = subgraph_info_.n_init_rev();
+        work.in_subgraph   = subgraph_info_.in_subgraph();
+        work.process_range = subgraph_info_.process_range();
+    }
     //
     // call proper version of helper function
     switch( play_.address_type() )
     {
         case local::play::unsigned_short_enum:
-        subgraph_reverse_helper<unsigned short>(q, ell, col, dw);
+        subgraph_reverse_helper<unsigned short>(q, ell, col, dw,
+            work.in_subgraph, work.process_range, work.partial
+        );
         break;
 
         case local::play::unsigned_int_enum:
-        subgraph_reverse_helper<unsigned int>(q, ell, col, dw);
+        subgraph_reverse_helper<unsigned int>(q, ell, col, dw,
+            work.in_subgraph, work.process_range, work.partial
+        );
         break;
 
         case local::play::size_t_enum:
-        subgraph_reverse_helper<size_t>(q, ell, col, dw);
+        subgraph_reverse_helper<size_t>(q, ell, col, dw,
+            work.in_subgraph, work.process_range, work.partial
+        );
         break;
 
         default:
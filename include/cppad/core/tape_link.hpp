@@ -15,6 +15,7 @@ in the Eclipse Public License, Version 2.0 are satisfied:
 # include <cppad/local/define.hpp>
 # include <cppad/utility/thread_alloc.hpp>
 # include <cppad/core/cppad_assert.hpp>
+# include <cppad/core/arena_allocator.hpp>
 
 // needed before one can use CPPAD_ASSERT_FIRST_CALL_NOT_PARALLEL
 # include <cppad/utility/thread_alloc.hpp>
@@ -184,6 +185,12 @@ local::ADTape<Base>*  AD<Base>::tape_manage(tape_manage_enum job)
     tape_id_t*            tape_id_p  = tape_id_ptr(thread);
     local::ADTape<Base>** tape_h     = tape_handle(thread);
 
+# ifndef NDEBUG
+    // maximum tape_id that can be stored in an AD object
+    size_t max_tape_id = size_t( std::numeric_limits<tape_id_t>::max() );
+    max_tape_id      >>= 8 * sizeof(tape_id_t) - CPPAD_TAPE_ID_BITS;
+# endif
+
 
     // -----------------------------------------------------------------------
     // new_tape_manage
@@ -200,7 +207,7 @@ local::ADTape<Base>*  AD<Base>::tape_manage(tape_manage_enum job)
         if( *tape_id_p == 0 )
         {   size_t new_tape_id = thread + CPPAD_MAX_NUM_THREADS;
             CPPAD_ASSERT_KNOWN(
-                size_t( std::numeric_limits<tape_id_t>::max() ) >= new_tape_id,
+                max_tape_id >= new_tape_id,
                 "cppad_tape_id_type maximum value has been exceeded"
             );
             *tape_id_p = static_cast<tape_id_t>( new_tape_id );
@@ -211,6 +218,9 @@ local::ADTape<Base>*  AD<Base>::tape_manage(tape_manage_enum job)
         );
         // set the tape_id for this tape
         (*tape_h)->id_ = *tape_id_p;
+        //
+        // use the arena for this thread while recording
+        local::recording_arena::begin();
     }
     // -----------------------------------------------------------------------
     // delete_tape_manage
@@ -220,10 +230,12 @@ local::ADTape<Base>*  AD<Base>::tape_manage(tape_manage_enum job)
         delete *tape_h;
         *tape_h = nullptr;
         //
+        // release the arena when no longer in use
+        local::recording_arena::end();
+        //
         // advance tape_id so that all AD<Base> variables become parameters
         CPPAD_ASSERT_KNOWN(
-            std::numeric_limits<CPPAD_TAPE_ID_TYPE>::max()
-            - CPPAD_MAX_NUM_THREADS > *tape_id_p,
+            max_tape_id - CPPAD_MAX_NUM_THREADS > size_t( *tape_id_p ),
             "To many different tapes given the type used for "
             "CPPAD_TAPE_ID_TYPE"
         );
@@ -106,7 +106,7 @@ AD<Base> AD<Base>::operator - (void) const
         // put operator in the tape
         result.taddr_ = tape->Rec_.PutOp(local::NegOp);
         // make result a variable
-        result.tape_id_ = tape_id_;
+        result.set_tape_id(tape_id_);
         result.ad_type_ = variable_enum;
     }
     else
@@ -115,7 +115,7 @@ AD<Base> AD<Base>::operator - (void) const
         result.taddr_ = tape->Rec_.put_dyn_par(
             result.value_, local::neg_dyn, arg0
         );
-        result.tape_id_  = tape_id_;
+        result.set_tape_id(tape_id_);
         result.ad_type_  = dynamic_enum;
     }
     return result;
@@ -0,0 +1,283 @@
+# ifndef CPPAD_CORE_VALUE_AND_GRADIENT_HPP
+# define CPPAD_CORE_VALUE_AND_GRADIENT_HPP
+/* --------------------------------------------------------------------------
+CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-21 Bradley M. Bell
+
+CppAD is distributed under the terms of the
+             Eclipse Public License Version 2.0.
+
+This Source Code may also be made available under the following
+Secondary License when the conditions for such availability set forth
+in the Eclipse Public License, Version 2.0 are satisfied:
+      GNU General Public License, Version 2.0 or later.
+---------------------------------------------------------------------------- */
+
+/*
+$begin value_and_gradient$$
+$spell
+    const
+    Taylor
+    nan
+    valgrind
+$$
+
+$section Function Value and Gradient: Driver Routine$$
+
+$head Syntax$$
+$icode%f%.value_and_gradient(%x%, %w%, %y%, %g%)%$$
+
+$head Prototype$$
+$srcthisfile%
+    0%// BEGIN_VALUE_AND_GRADIENT%// END_VALUE_AND_GRADIENT%1
+%$$
+
+$head Purpose$$
+We use $latex F : \B{R}^n \rightarrow \B{R}^m$$ to denote the
+$cref/AD function/glossary/AD Function/$$ corresponding to $icode f$$.
+The function $latex W : \B{R}^n \rightarrow \B{R}$$ is defined by
+$latex \[
+    W(x) = w_0 * F_0 ( x ) + \cdots + w_{m-1} * F_{m-1} (x)
+\] $$
+This routine computes $latex F(x)$$ and the derivative $latex W^{(1)} (x)$$.
+It gives the same result as
+$codei%
+    %y% = %f%.Forward(0, %x%)
+    %g% = %f%.Reverse(1, %w%)
+%$$
+but is faster when it is called many times with the same $icode f$$:
+
+$list number$$
+The results are stored in $icode y$$ and $icode g$$,
+so no vectors are allocated for the return values.
+$lnext
+The memory used for the partial derivatives during the reverse sweep
+is kept in $icode f$$ and reused by the next call.
+$lnext
+$cref/Forward(0, x)/forward_zero/$$ sets all the zero order
+Taylor coefficients to nan before the forward sweep
+(this avoids valgrind warnings for values that are never computed).
+This routine only does so when the Taylor coefficient memory is allocated,
+after that the coefficients have been set by a previous sweep.
+$lend
+
+$head f$$
+The object $icode f$$ has prototype
+$codei%
+    ADFun<%Base%> %f%
+%$$
+Note that the $cref ADFun$$ object $icode f$$ is not $code const$$
+(see $cref/Taylor Coefficients/value_and_gradient/Taylor Coefficients/$$
+below).
+
+$head x$$
+The size of $icode x$$ is $icode n$$, the dimension of the
+$cref/domain/fun_property/Domain/$$ space for $icode f$$.
+It specifies the point at which the function and derivative are evaluated.
+
+$head w$$
+The size of $icode w$$ is $icode m$$, the dimension of the
+$cref/range/fun_property/Range/$$ space for $icode f$$.
+It specifies the weights in the definition of $latex W(x)$$ above.
+
+$head y$$
+The size of $icode y$$ must be $icode m$$.
+The input value of its elements does not matter.
+Upon return, $icode%y% = %F%(%x%)%$$.
+
+$head g$$
+The size of $icode g$$ must be $icode n$$.
+The input value of its elements does not matter.
+Upon return, for $latex j = 0 , \ldots , n-1$$,
+$latex \[
+    g[ j ] = \D{ W }{ x_j } ( x )
+\] $$
+
+$head BaseVector$$
+The type $icode BaseVector$$ must be a $cref SimpleVector$$ class with
+$cref/elements of type/SimpleVector/Elements of Specified Type/$$
+$icode Base$$.
+The routine $cref CheckSimpleVector$$ will generate an error message
+if this is not the case.
+
+$head Taylor Coefficients$$
+After this call,
+the zero order Taylor coefficients in $icode f$$ correspond to
+$icode%f%.Forward(0, %x%)%$$
+and $cref/size_order/size_order/$$ is one.
+
+$head Example$$
+$children%
+    example/general/value_and_gradient.cpp
+%$$
+The file
+$cref value_and_gradient.cpp$$
+contains an example and test of this operation.
+
+$end
+-----------------------------------------------------------------------------
+*/
+
+//  BEGIN CppAD namespace
+namespace CppAD {
+
+/*!
+\file value_and_gradient.hpp
+Compute the value and gradient using zero order forward and first order
+reverse mode.
+*/
+
+/*!
+Compute the function value and the derivative of a weighted sum of the
+components of the function.
+
+\tparam Base
+base type for the operator; i.e., this operation sequence was recorded
+using AD< Base > and computations by this routine are done using type
+ Base.
+
+\tparam BaseVector
+is a Simple Vector class with elements of type Base.
+
+\param x
+is the argument value at which the function and derivative are evaluated.
+
+\param w
+is the weighting vector for the components of the function.
+
+\param y
+the input size must be the range dimension for this function.
+Upon return, it is the value of the function at x.
+
+\param g
+the input size must be the domain dimension for this function.
+Upon return, it is the derivative of the weighted sum w^T F(x)
+with respect to x.
+*/
+// BEGIN_VALUE_AND_GRADIENT
+template <class Base, class RecBase>
+template <class BaseVector>
+void ADFun<Base,RecBase>::value_and_gradient(
+    const BaseVector& x ,
+    const BaseVector& w ,
+    BaseVector&       y ,
+    BaseVector&       g )
+// END_VALUE_AND_GRADIENT
+{   // used to identify the RecBase type in calls to sweeps
+    RecBase not_used_rec_base(0.0);
+
+    // number of independent variables
+    size_t n = ind_taddr_.size();
+
+    // number of dependent variables
+    size_t m = dep_taddr_.size();
+
+    // check BaseVector is Simple Vector class with Base type elements
+    CheckSimpleVector<Base, BaseVector>();
+
+    CPPAD_ASSERT_KNOWN(
+        size_t(x.size()) == n,
+        "f.value_and_gradient(x, w, y, g): x.size() is not equal n"
+    );
+    CPPAD_ASSERT_KNOWN(
+        size_t(w.size()) == m,
+        "f.value_and_gradient(x, w, y, g): w.size() is not equal m"
+    );
+    CPPAD_ASSERT_KNOWN(
+        size_t(y.size()) == m,
+        "f.value_and_gradient(x, w, y, g): y.size() is not equal m"
+    );
+    CPPAD_ASSERT_KNOWN(
+        size_t(g.size()) == n,
+        "f.value_and_gradient(x, w, y, g): g.size() is not equal n"
+    );
+
+    // does taylor_ need more orders or fewer directions
+    if( (cap_order_taylor_ < 1) | (num_direction_taylor_ != 1) )
+    {   // no need to copy old values during capacity_order
+        num_order_taylor_ = 0;
+        size_t c = std::max<size_t>(1, cap_order_taylor_);
+        size_t r = 1;
+        capacity_order(c, r);
+        //
+        // Initialize the new zero order coefficients; see Forward(0, x).
+        // Once they have been set by a sweep they stay defined.
+        for(size_t j = 0; j < num_var_tape_; j++)
+            taylor_[cap_order_taylor_ * j] =
+                CppAD::numeric_limits<Base>::quiet_NaN();
+    }
+    CPPAD_ASSERT_UNKNOWN( cap_order_taylor_ >= 1 );
+    CPPAD_ASSERT_UNKNOWN( num_direction_taylor_ == 1 );
+
+    // short hand notation for order capacity
+    size_t C = cap_order_taylor_;
+
+    // set Taylor coefficients for independent variables
+    for(size_t j = 0; j < n; j++)
+    {   CPPAD_ASSERT_UNKNOWN( ind_taddr_[j] < num_var_tape_  );
+        CPPAD_ASSERT_UNKNOWN( play_.GetOp( ind_taddr_[j] ) == local::InvOp );
+        taylor_[ C * ind_taddr_[j] ] = x[j];
+    }
+
+    // zero order forward sweep
+    CPPAD_ASSERT_UNKNOWN( cskip_op_.size() == play_.num_op_rec() );
+    CPPAD_ASSERT_UNKNOWN( load_op2var_.size()  == play_.num_var_load_rec() );
+    local::sweep::forward0(&play_, std::cout, true,
+        n, num_var_tape_, C,
+        taylor_.data(), cskip_op_.data(), load_op2var_,
+        compare_change_count_,
+        compare_change_number_,
+        compare_change_op_index_,
+        not_used_rec_base
+    );
+    num_order_taylor_ = 1;
+
+    // function value
+    for(size_t i = 0; i < m; i++)
+    {   CPPAD_ASSERT_UNKNOWN( dep_taddr_[i] < num_var_tape_  );
+        y[i] = taylor_[ C * dep_taddr_[i] ];
+    }
+    CPPAD_ASSERT_KNOWN( ! ( hasnan(y) && check_for_nan_ ) ,
+        "f.value_and_gradient(x, w, y, g): y has a nan."
+    );
+
+    // initialize partials to zero
+    reverse_partial_.resize(num_var_tape_);
+    for(size_t i = 0; i < num_var_tape_; i++)
+        reverse_partial_[i] = Base(0.0);
+
+    // set the dependent variable weights
+    // (use += because two dependent variables can point to same location)
+    for(size_t i = 0; i < m; i++)
+        reverse_partial_[ dep_taddr_[i] ] += w[i];
+
+    // first order reverse sweep
+    local::play::const_sequential_iterator play_itr = play_.end();
+    local::sweep::reverse(
+        0,
+        n,
+        num_var_tape_,
+        &play_,
+        C,
+        taylor_.data(),
+        1,
+        reverse_partial_.data(),
+        cskip_op_.data(),
+        load_op2var_,
+        play_itr,
+        not_used_rec_base
+    );
+
+    // derivative values
+    for(size_t j = 0; j < n; j++)
+        g[j] = reverse_partial_[ ind_taddr_[j] ];
+    CPPAD_ASSERT_KNOWN( ! ( hasnan(g) && check_for_nan_ ) ,
+        "f.value_and_gradient(x, w, y, g): g has a nan,\n"
+        "but none of its Taylor coefficents are nan."
+    );
+
+    return;
+}
+
+} // END CppAD namespace
+
+# endif
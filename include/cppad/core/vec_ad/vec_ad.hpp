@@ -238,7 +238,7 @@ public:
                 );
 
                 // change result to variable for this load
-                result.tape_id_ = tape->id_;
+                result.set_tape_id(tape->id_);
                 result.ad_type_ = variable_enum;
             }
             else
@@ -255,7 +255,7 @@ public:
                 result.taddr_ = tape->Rec_.PutLoadOp(local::LdpOp);
 
                 // change result to variable for this load
-                result.tape_id_ = tape->id_;
+                result.set_tape_id(tape->id_);
                 result.ad_type_ = variable_enum;
             }
         }
@@ -138,10 +138,11 @@ public:
     // public function only used by CppAD::Independent
     template <class ADBaseVector>
     void Independent(
-        ADBaseVector&   x              ,
-        size_t          abort_op_index ,
-        bool            record_compare ,
-        ADBaseVector&   dynamic
+        ADBaseVector&        x              ,
+        size_t               abort_op_index ,
+        bool                 record_compare ,
+        ADBaseVector&        dynamic        ,
+        const record_hint&   hint
     );
 
 };
@@ -42,9 +42,18 @@ namespace CppAD {
     typedef CPPAD_TAPE_ADDR_TYPE addr_t;
     typedef CPPAD_TAPE_ID_TYPE   tape_id_t;
 
+    // number of bits used to store a tape_id_t value in an AD object
+# if CPPAD_COMPACT_AD
+# define CPPAD_TAPE_ID_BITS ( 8 * sizeof(CPPAD_TAPE_ID_TYPE) - 2 )
+# else
+# define CPPAD_TAPE_ID_BITS ( 8 * sizeof(CPPAD_TAPE_ID_TYPE) )
+# endif
+
     // classes
+    class record_hint;
     class sparse_hes_work;
     class sparse_jac_work;
+    class sparse_ter_work;
     class sparse_jacobian_work;
     class sparse_hessian_work;
     template <class Base> class AD;
@@ -52,6 +61,7 @@ namespace CppAD {
     template <class Base> class atomic_base;
     template <class Base> class atomic_three;
     template <class Base> class discrete;
+    template <class Base> class subgraph_work;
     template <class Base> class VecAD;
     template <class Base> class VecAD_reference;
 
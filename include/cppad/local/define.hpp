@@ -55,6 +55,24 @@ This macro is defined as empty for Microsoft compilers.
 # define CPPAD_INLINE_FRIEND_TEMPLATE_FUNCTION inline
 # endif
 
+// ----------------------------------------------------------------------------
+/*!
+\def CPPAD_NOINLINE
+Request that the compiler not inline a function.
+
+This is used for code that is rarely executed and is called from
+functions that must be inlined in the operation sequence sweeps;
+e.g., the operator++ for a player iterator.
+This macro is defined as empty for compilers that do not support it.
+*/
+# if defined(__GNUC__) || defined(__clang__)
+# define CPPAD_NOINLINE __attribute__((noinline))
+# elif defined(_MSC_VER)
+# define CPPAD_NOINLINE __declspec(noinline)
+# else
+# define CPPAD_NOINLINE
+# endif
+
 // ----------------------------------------------------------------------------
 /*!
 \def CPPAD_LIB_EXPORT
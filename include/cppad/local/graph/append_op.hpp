@@ -0,0 +1,186 @@
+# ifndef CPPAD_LOCAL_GRAPH_APPEND_OP_HPP
+# define CPPAD_LOCAL_GRAPH_APPEND_OP_HPP
+/* --------------------------------------------------------------------------
+CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-21 Bradley M. Bell
+
+  CppAD is distributed under the terms of the
+               Eclipse Public License Version 2.0.
+
+  This Source Code may also be made available under the following
+  Secondary License when the conditions for such availability set forth
+  in the Eclipse Public License, Version 2.0 are satisfied:
+        GNU General Public License, Version 2.0 or later.
+-------------------------------------------------------------------------- */
+
+# include <cppad/core/graph/cpp_graph.hpp>
+
+namespace CppAD { namespace local { namespace graph {
+/*
+$begin graph_append_op$$
+$spell
+    src
+    dst
+    obj
+    cpp
+    vec
+    str
+    itr
+$$
+
+$section Append the Operators in One C++ AD Graph to Another$$
+
+$head Syntax$$
+$codei%append_one_op(%dst_obj%, %src_obj%, %itr_value%, %node_map%, %n_node%)
+%$$
+$codei%append_op(%dst_obj%, %src_obj%, %node_map%, %n_node%)%$$
+
+$head Prototype$$
+$srcthisfile%
+    0%// BEGIN_APPEND_ONE_OP%// END_APPEND_ONE_OP%1
+%$$
+$srcthisfile%
+    0%// BEGIN_APPEND_OP%// END_APPEND_OP%1
+%$$
+
+$head dst_obj$$
+This is the graph that the operators are appended to.
+The discrete function names, atomic function names, and print text
+used by the operators in $icode src_obj$$ are added to
+the corresponding vectors in $icode dst_obj$$ if they are not already there.
+
+$head src_obj$$
+This is the graph that the operators are copied from.
+
+$head itr_value$$
+This is the value of a $icode src_obj$$ iterator
+that points to the one operator that is appended by $code append_one_op$$.
+
+$head node_map$$
+The size of $icode node_map$$ is the index of the first result
+for the operator that $icode itr_value$$ points to.
+For each node index $icode i$$ in $icode src_obj$$ that is
+an argument for this operator,
+$icode%node_map%[%i%]%$$ is the corresponding node index in $icode dst_obj$$
+($icode%node_map%[0]%$$ is not used).
+Upon return, $icode node_map$$ has been extended to include
+the results of the operator.
+
+$subhead append_op$$
+In the case of $code append_op$$,
+all the operators in $icode src_obj$$ are appended.
+On input, the size of $icode node_map$$ is one plus the number of
+independent dynamic parameters, independent variables, and constants
+in $icode src_obj$$.
+Upon return, $icode node_map$$ has been extended to include
+the results of all the operators in $icode src_obj$$.
+Thus $icode%node_map%[ %src_obj%.dependent_vec_get(%i%) ]%$$
+is the node in $icode dst_obj$$ corresponding to the $th i$$ dependent
+in $icode src_obj$$.
+
+$head n_node$$
+On input, this is the number of nodes in $icode dst_obj$$
+(not counting the node with index zero).
+Upon return, it has been incremented by the number of results for the
+operators that were appended.
+
+$end
+*/
+// BEGIN_APPEND_ONE_OP
+inline void append_one_op(
+    cpp_graph&                                  dst_obj   ,
+    const cpp_graph&                            src_obj   ,
+    const cpp_graph::const_iterator::value_type& itr_value ,
+    vector<size_t>&                             node_map  ,
+    size_t&                                     n_node    )
+// END_APPEND_ONE_OP
+{   const vector<size_t>& str_index( *itr_value.str_index_ptr );
+    const vector<size_t>&       arg( *itr_value.arg_node_ptr );
+    graph_op_enum          op_enum  = itr_value.op_enum;
+    size_t                n_result  = itr_value.n_result;
+    size_t                   n_arg  = arg.size();
+    //
+    dst_obj.operator_vec_push_back(op_enum);
+    //
+    // prefix for this operator in operator_arg
+    size_t index;
+    switch( op_enum )
+    {
+        case discrete_graph_op:
+        {   const std::string& name =
+                src_obj.discrete_name_vec_get( str_index[0] );
+            index = dst_obj.discrete_name_vec_find(name);
+            if( index == dst_obj.discrete_name_vec_size() )
+                dst_obj.discrete_name_vec_push_back(name);
+            dst_obj.operator_arg_push_back(index);
+        }
+        break;
+
+        case atom_graph_op:
+        {   const std::string& name =
+                src_obj.atomic_name_vec_get( str_index[0] );
+            index = dst_obj.atomic_name_vec_find(name);
+            if( index == dst_obj.atomic_name_vec_size() )
+                dst_obj.atomic_name_vec_push_back(name);
+            dst_obj.operator_arg_push_back(index);
+            dst_obj.operator_arg_push_back(n_result);
+            dst_obj.operator_arg_push_back(n_arg);
+        }
+        break;
+
+        case print_graph_op:
+        for(size_t k = 0; k < 2; ++k)
+        {   const std::string& text =
+                src_obj.print_text_vec_get( str_index[k] );
+            index = dst_obj.print_text_vec_find(text);
+            if( index == dst_obj.print_text_vec_size() )
+                dst_obj.print_text_vec_push_back(text);
+            dst_obj.operator_arg_push_back(index);
+        }
+        break;
+
+        case sum_graph_op:
+        dst_obj.operator_arg_push_back(n_arg);
+        break;
+
+        default:
+        CPPAD_ASSERT_UNKNOWN( str_index.size() == 0 );
+        break;
+    }
+    //
+    // argument nodes
+    for(size_t i = 0; i < n_arg; ++i)
+    {   CPPAD_ASSERT_UNKNOWN( 0 < arg[i] && arg[i] < node_map.size() );
+        dst_obj.operator_arg_push_back( node_map[ arg[i] ] );
+    }
+    //
+    // result nodes
+    for(size_t i = 0; i < n_result; ++i)
+        node_map.push_back( ++n_node );
+    return;
+}
+// BEGIN_APPEND_OP
+inline void append_op(
+    cpp_graph&           dst_obj  ,
+    const cpp_graph&     src_obj  ,
+    vector<size_t>&      node_map ,
+    size_t&              n_node   )
+// END_APPEND_OP
+{   CPPAD_ASSERT_UNKNOWN( node_map.size() ==
+        1 + src_obj.n_dynamic_ind_get() + src_obj.n_variable_ind_get()
+        + src_obj.constant_vec_size()
+    );
+    size_t n_op = src_obj.operator_vec_size();
+    cpp_graph::const_iterator itr;
+    for(size_t op_index = 0; op_index < n_op; ++op_index)
+    {   if( op_index == 0 )
+            itr = src_obj.begin();
+        else
+            ++itr;
+        append_one_op(dst_obj, src_obj, *itr, node_map, n_node);
+    }
+    return;
+}
+
+} } } // END_CPPAD_LOCAL_GRAPH_NAMESPACE
+
+# endif
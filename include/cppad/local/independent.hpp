@@ -35,14 +35,19 @@ of operations). The value zero corresponds to not aborting (will not match).
 
 \param dynamic
 Vector of dynamic parameters.
+
+\param hint
+Expected size of the recording. The size of the previous recording for
+this thread is used when it is larger.
 */
 template <class Base>
 template <class ADVector>
 void ADTape<Base>::Independent(
-    ADVector&    x               ,
-    size_t       abort_op_index  ,
-    bool         record_compare  ,
-    ADVector&    dynamic
+    ADVector&          x               ,
+    size_t             abort_op_index  ,
+    bool               record_compare  ,
+    ADVector&          dynamic         ,
+    const record_hint& hint
 ) {
     // check ADVector is Simple Vector class with AD<Base> elements
     CheckSimpleVector< AD<Base>, ADVector>();
@@ -58,6 +63,15 @@ void ADTape<Base>::Independent(
     CPPAD_ASSERT_UNKNOWN( Rec_.get_record_compare() == true );
     CPPAD_ASSERT_UNKNOWN( Rec_.get_num_dynamic_ind()    == 0 );
 
+    // reserve memory for the recording
+    const size_t* previous =
+        recorder<Base>::previous_size( thread_alloc::thread_num() );
+    Rec_.reserve(
+        std::max(hint.num_op,     previous[0]) ,
+        std::max(hint.num_op_arg, previous[1]) ,
+        std::max(hint.num_par,    previous[2])
+    );
+
     // set record_compare and abort_op_index before doing anything else
     Rec_.set_record_compare(record_compare);
     Rec_.set_abort_op_index(abort_op_index);
@@ -75,7 +89,7 @@ void ADTape<Base>::Independent(
     {   // tape address for this independent variable
         CPPAD_ASSERT_UNKNOWN( ! Variable(x[j] ) );
         x[j].taddr_     = Rec_.PutOp(InvOp);
-        x[j].tape_id_   = id_;
+        x[j].set_tape_id(id_);
         x[j].ad_type_   = variable_enum;
         CPPAD_ASSERT_UNKNOWN( size_t(x[j].taddr_) == j+1 );
         CPPAD_ASSERT_UNKNOWN( Variable(x[j] ) );
@@ -109,7 +123,7 @@ void ADTape<Base>::Independent(
         //
         // make this parameter dynamic
         dynamic[j].taddr_   = static_cast<addr_t>(j+1);
-        dynamic[j].tape_id_ = id_;
+        dynamic[j].set_tape_id(id_);
         dynamic[j].ad_type_ = dynamic_enum;
         CPPAD_ASSERT_UNKNOWN( Dynamic( dynamic[j] ) );
     }
@@ -129,6 +129,30 @@ void reverse_addvv_op(
     }
 }
 
+// See dev documentation: reverse_binary_op_0
+template <class Base>
+void reverse_addvv_op_0(
+    size_t        i_z         ,
+    const addr_t* arg         ,
+    const Base*   parameter   ,
+    size_t        cap_order   ,
+    const Base*   taylor      ,
+    size_t        nc_partial  ,
+    Base*         partial     )
+{
+    // check assumptions
+    CPPAD_ASSERT_UNKNOWN( NumArg(AddvvOp) == 2 );
+    CPPAD_ASSERT_UNKNOWN( NumRes(AddvvOp) == 1 );
+
+    // Partial derivatives corresponding to arguments and result
+    Base* px = partial + size_t(arg[0]) * nc_partial;
+    Base* py = partial + size_t(arg[1]) * nc_partial;
+    Base* pz = partial + i_z    * nc_partial;
+
+    px[0] += pz[0];
+    py[0] += pz[0];
+}
+
 // --------------------------- Addpv -----------------------------------------
 // See dev documentation: forward_unary_op
 // See dev documentation: forward_binary_op
@@ -245,6 +269,28 @@ void reverse_addpv_op(
     }
 }
 
+// See dev documentation: reverse_binary_op_0
+template <class Base>
+void reverse_addpv_op_0(
+    size_t        i_z         ,
+    const addr_t* arg         ,
+    const Base*   parameter   ,
+    size_t        cap_order   ,
+    const Base*   taylor      ,
+    size_t        nc_partial  ,
+    Base*         partial     )
+{
+    // check assumptions
+    CPPAD_ASSERT_UNKNOWN( NumArg(AddpvOp) == 2 );
+    CPPAD_ASSERT_UNKNOWN( NumRes(AddpvOp) == 1 );
+
+    // Partial derivatives corresponding to arguments and result
+    Base* py = partial + size_t(arg[1]) * nc_partial;
+    Base* pz = partial + i_z    * nc_partial;
+
+    py[0] += pz[0];
+}
+
 
 } } // END_CPPAD_LOCAL_NAMESPACE
 # endif
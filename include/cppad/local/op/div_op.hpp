@@ -157,6 +157,36 @@ void reverse_divvv_op(
     }
 }
 
+// See dev documentation: reverse_binary_op_0
+template <class Base>
+void reverse_divvv_op_0(
+    size_t        i_z         ,
+    const addr_t* arg         ,
+    const Base*   parameter   ,
+    size_t        cap_order   ,
+    const Base*   taylor      ,
+    size_t        nc_partial  ,
+    Base*         partial     )
+{
+    // check assumptions
+    CPPAD_ASSERT_UNKNOWN( NumArg(DivvvOp) == 2 );
+    CPPAD_ASSERT_UNKNOWN( NumRes(DivvvOp) == 1 );
+
+    // Arguments
+    const Base* y  = taylor + size_t(arg[1]) * cap_order;
+    const Base* z  = taylor + i_z    * cap_order;
+
+    // Partial derivatives corresponding to arguments and result
+    Base* px = partial + size_t(arg[0]) * nc_partial;
+    Base* py = partial + size_t(arg[1]) * nc_partial;
+    Base* pz = partial + i_z    * nc_partial;
+
+    // partial of z w.r.t. x is 1 / y, partial w.r.t y is - z / y
+    Base pz_y = azmul(pz[0], Base(1.0) / y[0]);
+    px[0]    += pz_y;
+    py[0]    -= azmul(pz_y, z[0]);
+}
+
 // --------------------------- Divpv -----------------------------------------
 
 // See dev documentation: forward_binary_op
@@ -302,6 +332,34 @@ void reverse_divpv_op(
     }
 }
 
+// See dev documentation: reverse_binary_op_0
+template <class Base>
+void reverse_divpv_op_0(
+    size_t        i_z         ,
+    const addr_t* arg         ,
+    const Base*   parameter   ,
+    size_t        cap_order   ,
+    const Base*   taylor      ,
+    size_t        nc_partial  ,
+    Base*         partial     )
+{
+    // check assumptions
+    CPPAD_ASSERT_UNKNOWN( NumArg(DivpvOp) == 2 );
+    CPPAD_ASSERT_UNKNOWN( NumRes(DivpvOp) == 1 );
+
+    // Arguments
+    const Base* y  = taylor + size_t(arg[1]) * cap_order;
+    const Base* z  = taylor + i_z    * cap_order;
+
+    // Partial derivatives corresponding to arguments and result
+    Base* py = partial + size_t(arg[1]) * nc_partial;
+    Base* pz = partial + i_z    * nc_partial;
+
+    // partial of z w.r.t y is - z / y
+    Base pz_y = azmul(pz[0], Base(1.0) / y[0]);
+    py[0]    -= azmul(pz_y, z[0]);
+}
+
 
 // --------------------------- Divvp -----------------------------------------
 
@@ -430,5 +488,30 @@ void reverse_divvp_op(
     }
 }
 
+// See dev documentation: reverse_binary_op_0
+template <class Base>
+void reverse_divvp_op_0(
+    size_t        i_z         ,
+    const addr_t* arg         ,
+    const Base*   parameter   ,
+    size_t        cap_order   ,
+    const Base*   taylor      ,
+    size_t        nc_partial  ,
+    Base*         partial     )
+{
+    // check assumptions
+    CPPAD_ASSERT_UNKNOWN( NumArg(DivvpOp) == 2 );
+    CPPAD_ASSERT_UNKNOWN( NumRes(DivvpOp) == 1 );
+
+    // Argument values
+    Base  y = parameter[ arg[1] ];
+
+    // Partial derivatives corresponding to arguments and result
+    Base* px = partial + size_t(arg[0]) * nc_partial;
+    Base* pz = partial + i_z    * nc_partial;
+
+    px[0] += azmul(pz[0], Base(1.0) / y);
+}
+
 } } // END_CPPAD_LOCAL_NAMESPACE
 # endif
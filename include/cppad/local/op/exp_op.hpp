@@ -150,5 +150,34 @@ void reverse_exp_op(
     px[0] += azmul(pz[0], z[0]);
 }
 
+// See dev documentation: reverse_unary_op_0
+template <class Base>
+void reverse_exp_op_0(
+    size_t      i_z          ,
+    size_t      i_x          ,
+    size_t      cap_order    ,
+    const Base* taylor       ,
+    size_t      nc_partial   ,
+    Base*       partial      )
+{
+    // check assumptions
+    CPPAD_ASSERT_UNKNOWN( NumArg(ExpOp) == 1 );
+    CPPAD_ASSERT_UNKNOWN( NumRes(ExpOp) == 1 );
+
+    // partials corresponding to argument
+    Base* px       = partial + i_x * nc_partial;
+
+    // Taylor coefficients and partials corresponding to result
+    const Base* z  = taylor  + i_z * cap_order;
+    Base* pz       = partial + i_z * nc_partial;
+
+    // If pz is zero, make sure this operation has no effect
+    // (zero times infinity or nan would be non-zero).
+    if( IdenticalZero(pz[0]) )
+        return;
+
+    px[0] += azmul(pz[0], z[0]);
+}
+
 } } // END_CPPAD_LOCAL_NAMESPACE
 # endif
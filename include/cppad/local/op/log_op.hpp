@@ -158,5 +158,29 @@ void reverse_log_op(
     px[0] += azmul(pz[0], inv_x0);
 }
 
+// See dev documentation: reverse_unary_op_0
+template <class Base>
+void reverse_log_op_0(
+    size_t      i_z          ,
+    size_t      i_x          ,
+    size_t      cap_order    ,
+    const Base* taylor       ,
+    size_t      nc_partial   ,
+    Base*       partial      )
+{
+    // check assumptions
+    CPPAD_ASSERT_UNKNOWN( NumArg(LogOp) == 1 );
+    CPPAD_ASSERT_UNKNOWN( NumRes(LogOp) == 1 );
+
+    // Taylor coefficients and partials corresponding to argument
+    const Base* x  = taylor  + i_x * cap_order;
+    Base* px       = partial + i_x * nc_partial;
+
+    // partials corresponding to result
+    Base* pz       = partial + i_z * nc_partial;
+
+    px[0] += azmul(pz[0], Base(1.0) / x[0]);
+}
+
 } } // END_CPPAD_LOCAL_NAMESPACE
 # endif
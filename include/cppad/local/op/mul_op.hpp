@@ -141,6 +141,34 @@ void reverse_mulvv_op(
         }
     }
 }
+
+// See dev documentation: reverse_binary_op_0
+template <class Base>
+void reverse_mulvv_op_0(
+    size_t        i_z         ,
+    const addr_t* arg         ,
+    const Base*   parameter   ,
+    size_t        cap_order   ,
+    const Base*   taylor      ,
+    size_t        nc_partial  ,
+    Base*         partial     )
+{
+    // check assumptions
+    CPPAD_ASSERT_UNKNOWN( NumArg(MulvvOp) == 2 );
+    CPPAD_ASSERT_UNKNOWN( NumRes(MulvvOp) == 1 );
+
+    // Arguments
+    const Base* x  = taylor + size_t(arg[0]) * cap_order;
+    const Base* y  = taylor + size_t(arg[1]) * cap_order;
+
+    // Partial derivatives corresponding to arguments and result
+    Base* px = partial + size_t(arg[0]) * nc_partial;
+    Base* py = partial + size_t(arg[1]) * nc_partial;
+    Base* pz = partial + i_z    * nc_partial;
+
+    px[0] += azmul(pz[0], y[0]);
+    py[0] += azmul(pz[0], x[0]);
+}
 // --------------------------- Mulpv -----------------------------------------
 
 // See dev documentation: forward_binary_op
@@ -258,6 +286,31 @@ void reverse_mulpv_op(
     }
 }
 
+// See dev documentation: reverse_binary_op_0
+template <class Base>
+void reverse_mulpv_op_0(
+    size_t        i_z         ,
+    const addr_t* arg         ,
+    const Base*   parameter   ,
+    size_t        cap_order   ,
+    const Base*   taylor      ,
+    size_t        nc_partial  ,
+    Base*         partial     )
+{
+    // check assumptions
+    CPPAD_ASSERT_UNKNOWN( NumArg(MulpvOp) == 2 );
+    CPPAD_ASSERT_UNKNOWN( NumRes(MulpvOp) == 1 );
+
+    // Arguments
+    Base x  = parameter[ arg[0] ];
+
+    // Partial derivatives corresponding to arguments and result
+    Base* py = partial + size_t(arg[1]) * nc_partial;
+    Base* pz = partial + i_z    * nc_partial;
+
+    py[0] += azmul(pz[0], x);
+}
+
 
 } } // END_CPPAD_LOCAL_NAMESPACE
 # endif
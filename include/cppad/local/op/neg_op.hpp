@@ -114,5 +114,26 @@ void reverse_neg_op(
 
 }
 
+// See dev documentation: reverse_unary_op_0
+template <class Base>
+void reverse_neg_op_0(
+    size_t      i_z          ,
+    size_t      i_x          ,
+    size_t      cap_order    ,
+    const Base* taylor       ,
+    size_t      nc_partial   ,
+    Base*       partial      )
+{
+    // check assumptions
+    CPPAD_ASSERT_UNKNOWN( NumArg(NegOp) == 1 );
+    CPPAD_ASSERT_UNKNOWN( NumRes(NegOp) == 1 );
+
+    // partials corresponding to argument and result
+    Base* px       = partial + i_x * nc_partial;
+    Base* pz       = partial + i_z * nc_partial;
+
+    px[0] += azmul(pz[0], Base(-1.0));
+}
+
 } } // END_CPPAD_LOCAL_NAMESPACE
 # endif
@@ -629,9 +629,16 @@ In the documentation below,
 this operations is for the case where x is a variable and y is a parameter.
 
 \copydetails CppAD::local::reverse_pow_op
+
+\tparam Vector
+is a simple vector class with elements of type Base; e.g.,
+CppAD::vector<Base> or CppAD::small_vector<Base, N>.
+
+\param work
+is work space used by this routine. It is resized to nc_partial elements.
 */
 
-template <class Base>
+template <class Base, class Vector>
 void reverse_powvp_op(
     size_t        d           ,
     size_t        i_z         ,
@@ -641,7 +648,7 @@ void reverse_powvp_op(
     const Base*   taylor      ,
     size_t        nc_partial  ,
     Base*         partial     ,
-    CppAD::vector<Base>& work )
+    Vector&       work        )
 {
     // check assumptions
     CPPAD_ASSERT_UNKNOWN( NumArg(PowvpOp) == 2 );
@@ -174,5 +174,34 @@ void reverse_sin_op(
     px[0] -= azmul(pc[0], s[0]);
 }
 
+// See dev documentation: reverse_unary_op_0
+template <class Base>
+void reverse_sin_op_0(
+    size_t      i_z          ,
+    size_t      i_x          ,
+    size_t      cap_order    ,
+    const Base* taylor       ,
+    size_t      nc_partial   ,
+    Base*       partial      )
+{
+    // check assumptions
+    CPPAD_ASSERT_UNKNOWN( NumArg(SinOp) == 1 );
+    CPPAD_ASSERT_UNKNOWN( NumRes(SinOp) == 2 );
+
+    // partials corresponding to argument
+    Base* px       = partial + i_x * nc_partial;
+
+    // Taylor coefficients and partials corresponding to first result
+    const Base* s  = taylor  + i_z * cap_order; // called z in doc
+    Base* ps       = partial + i_z * nc_partial;
+
+    // Taylor coefficients and partials corresponding to auxillary result
+    const Base* c  = s  - cap_order; // called y in documentation
+    Base* pc       = ps - nc_partial;
+
+    px[0] += azmul(ps[0], c[0]);
+    px[0] -= azmul(pc[0], s[0]);
+}
+
 } } // END_CPPAD_LOCAL_NAMESPACE
 # endif
@@ -149,5 +149,29 @@ void reverse_sqrt_op(
     px[0] += azmul(pz[0], inv_z0) / Base(2.0);
 }
 
+// See dev documentation: reverse_unary_op_0
+template <class Base>
+void reverse_sqrt_op_0(
+    size_t      i_z          ,
+    size_t      i_x          ,
+    size_t      cap_order    ,
+    const Base* taylor       ,
+    size_t      nc_partial   ,
+    Base*       partial      )
+{
+    // check assumptions
+    CPPAD_ASSERT_UNKNOWN( NumArg(SqrtOp) == 1 );
+    CPPAD_ASSERT_UNKNOWN( NumRes(SqrtOp) == 1 );
+
+    // partials corresponding to argument
+    Base* px       = partial + i_x * nc_partial;
+
+    // Taylor coefficients and partials corresponding to result
+    const Base* z  = taylor  + i_z * cap_order;
+    Base* pz       = partial + i_z * nc_partial;
+
+    px[0] += azmul(pz[0], Base(1.0) / z[0]) / Base(2.0);
+}
+
 } } // END_CPPAD_LOCAL_NAMESPACE
 # endif
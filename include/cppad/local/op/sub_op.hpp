@@ -125,6 +125,30 @@ void reverse_subvv_op(
     }
 }
 
+// See dev documentation: reverse_binary_op_0
+template <class Base>
+void reverse_subvv_op_0(
+    size_t        i_z         ,
+    const addr_t* arg         ,
+    const Base*   parameter   ,
+    size_t        cap_order   ,
+    const Base*   taylor      ,
+    size_t        nc_partial  ,
+    Base*         partial     )
+{
+    // check assumptions
+    CPPAD_ASSERT_UNKNOWN( NumArg(SubvvOp) == 2 );
+    CPPAD_ASSERT_UNKNOWN( NumRes(SubvvOp) == 1 );
+
+    // Partial derivatives corresponding to arguments and result
+    Base* px = partial + size_t(arg[0]) * nc_partial;
+    Base* py = partial + size_t(arg[1]) * nc_partial;
+    Base* pz = partial + i_z    * nc_partial;
+
+    px[0] += pz[0];
+    py[0] -= pz[0];
+}
+
 // --------------------------- Subpv -----------------------------------------
 
 // See dev documentation: forward_binary_op
@@ -240,6 +264,28 @@ void reverse_subpv_op(
     }
 }
 
+// See dev documentation: reverse_binary_op_0
+template <class Base>
+void reverse_subpv_op_0(
+    size_t        i_z         ,
+    const addr_t* arg         ,
+    const Base*   parameter   ,
+    size_t        cap_order   ,
+    const Base*   taylor      ,
+    size_t        nc_partial  ,
+    Base*         partial     )
+{
+    // check assumptions
+    CPPAD_ASSERT_UNKNOWN( NumArg(SubpvOp) == 2 );
+    CPPAD_ASSERT_UNKNOWN( NumRes(SubpvOp) == 1 );
+
+    // Partial derivatives corresponding to arguments and result
+    Base* py = partial + size_t(arg[1]) * nc_partial;
+    Base* pz = partial + i_z    * nc_partial;
+
+    py[0] -= pz[0];
+}
+
 // --------------------------- Subvp -----------------------------------------
 
 // See dev documentation: forward_binary_op
@@ -356,5 +402,27 @@ void reverse_subvp_op(
     }
 }
 
+// See dev documentation: reverse_binary_op_0
+template <class Base>
+void reverse_subvp_op_0(
+    size_t        i_z         ,
+    const addr_t* arg         ,
+    const Base*   parameter   ,
+    size_t        cap_order   ,
+    const Base*   taylor      ,
+    size_t        nc_partial  ,
+    Base*         partial     )
+{
+    // check assumptions
+    CPPAD_ASSERT_UNKNOWN( NumArg(SubvpOp) == 2 );
+    CPPAD_ASSERT_UNKNOWN( NumRes(SubvpOp) == 1 );
+
+    // Partial derivatives corresponding to arguments and result
+    Base* px = partial + size_t(arg[0]) * nc_partial;
+    Base* pz = partial + i_z    * nc_partial;
+
+    px[0] += pz[0];
+}
+
 } } // END_CPPAD_LOCAL_NAMESPACE
 # endif
@@ -56,9 +56,37 @@ private:
     /// The operators in the recording.
     pod_vector<opcode_t> op_vec_;
 
-    /// The operation argument indices in the recording
+    /// The operation argument indices in the recording.
+    /// If the arguments are packed, this is empty unless random access
+    /// has been setup; see setup_random.
     pod_vector<addr_t> arg_vec_;
 
+    /// The operation argument indices packed using the smallest unsigned
+    /// integer type that can represent all of their values
+    /// (empty if that type is not smaller than addr_t).
+    pod_vector<unsigned char> arg_pack_;
+
+    /// type used for each element of arg_pack_
+    /// (only defined when arg_pack_ is not empty).
+    /// If arg_compressed_ is true, this is the type that will be used
+    /// after the arguments are decompressed.
+    play::addr_enum arg_pack_type_;
+
+    /// If true, arg_pack_ contains the arguments compressed using
+    /// variable length codes; see compress.
+    bool arg_compressed_;
+
+    /// Number of operation argument indices in the recording.
+    size_t num_op_arg_rec_;
+
+    /// If true, the pod_vectors for this recording use huge page memory;
+    /// see huge_page.
+    bool huge_page_;
+
+    /// If true, the operation arguments are packed when a recording is
+    /// stored in this player; see pack_arg.
+    bool pack_arg_;
+
     /// Character strings ('\\0' terminated) in the recording.
     pod_vector<char> text_vec_;
 
@@ -115,7 +143,12 @@ public:
     num_dynamic_ind_(0)  ,
     num_var_rec_(0)      ,
     num_var_load_rec_(0)  ,
-    num_var_vecad_rec_(0)
+    num_var_vecad_rec_(0) ,
+    arg_pack_type_(play::size_t_enum) ,
+    arg_compressed_(false) ,
+    num_op_arg_rec_(0)   ,
+    huge_page_(false)    ,
+    pack_arg_(false)
     { }
     // move semantics constructor
     // (none of the default constructor values matter to the destructor)
@@ -133,7 +166,7 @@ public:
         size_t required = 0;
         required = std::max(required, num_var_rec_   );  // number variables
         required = std::max(required, op_vec_.size()  ); // number operators
-        required = std::max(required, arg_vec_.size() ); // number arguments
+        required = std::max(required, num_op_arg_rec_ ); // number arguments
         //
         // unsigned short
         if( required <= std::numeric_limits<unsigned short>::max() )
@@ -186,6 +219,9 @@ public:
         // op_arg_vec_
         arg_vec_.swap(rec.arg_vec_);
         CPPAD_ASSERT_UNKNOWN(arg_vec_.size()    < addr_t_max );
+        num_op_arg_rec_ = arg_vec_.size();
+        arg_pack_.clear();
+        arg_compressed_ = false;
 
         // all_par_vec_
         all_par_vec_.swap(rec.all_par_vec_);
@@ -228,9 +264,23 @@ public:
         }
         CPPAD_ASSERT_UNKNOWN( i_dyn == dyn_ind2par_ind_.size() );
 
+        // free extra memory (in case the recording reserved too much)
+        op_vec_.shrink();
+        arg_vec_.shrink();
+        all_par_vec_.shrink();
+        dyn_par_is_.shrink();
+
         // random access information
         clear_random();
 
+        // use the smallest type that can represent the arguments
+        if( pack_arg_ )
+            pack_arg_vec();
+
+        // the vectors that came from rec use the default allocation policy
+        if( huge_page_ )
+            huge_page(true);
+
         // some checks
         check_inv_op(n_ind);
         check_variable_dag();
@@ -489,6 +539,192 @@ public:
         return;
     }
 # endif
+    // ===============================================================
+    /*!
+    Pack the operator arguments using the smallest unsigned integer type
+    that can represent all of their values.
+
+    \par
+    If this type is not smaller than addr_t, arg_vec_ is not changed
+    and arg_pack_ is empty. Otherwise, arg_pack_ contains the arguments,
+    arg_pack_type_ is the type used for its elements, and arg_vec_ is empty.
+    */
+    void pack_arg_vec(void)
+    {   CPPAD_ASSERT_UNKNOWN( arg_pack_.size() == 0 );
+        CPPAD_ASSERT_UNKNOWN( arg_vec_.size() == num_op_arg_rec_ );
+        //
+        // largest argument value
+        size_t max_arg = 0;
+        for(size_t i = 0; i < num_op_arg_rec_; ++i)
+            max_arg = std::max(max_arg, size_t( arg_vec_[i] ) );
+        //
+        // smallest type that can represent max_arg
+        play::addr_enum type = play::size_t_enum;
+        size_t          byte = sizeof(size_t);
+        if( max_arg <= std::numeric_limits<unsigned short>::max() )
+        {   type = play::unsigned_short_enum;
+            byte = sizeof(unsigned short);
+        }
+        else if( max_arg <= std::numeric_limits<unsigned int>::max() )
+        {   type = play::unsigned_int_enum;
+            byte = sizeof(unsigned int);
+        }
+        //
+        // check if packing would reduce memory
+        if( sizeof(addr_t) <= byte )
+            return;
+        //
+        arg_pack_type_ = type;
+        switch( type )
+        {   case play::unsigned_short_enum:
+            pack_arg_copy<unsigned short>();
+            break;
+
+            case play::unsigned_int_enum:
+            pack_arg_copy<unsigned int>();
+            break;
+
+            default:
+            CPPAD_ASSERT_UNKNOWN( type == play::size_t_enum );
+            pack_arg_copy<size_t>();
+            break;
+        }
+        arg_vec_.clear();
+    }
+    /// copy arg_vec_ to arg_pack_ using elements of type Pack
+    template <class Pack>
+    void pack_arg_copy(void)
+    {   pod_vector<Pack>* pack = arg_pack_.pod_vector_ptr<Pack>();
+        pack->resize(num_op_arg_rec_);
+        for(size_t i = 0; i < num_op_arg_rec_; ++i)
+            (*pack)[i] = Pack( arg_vec_[i] );
+    }
+    /// copy arg_pack_ to arg_vec_ using elements of type Pack
+    template <class Pack>
+    void unpack_arg_copy(void)
+    {   const pod_vector<Pack>* pack = arg_pack_.pod_vector_ptr<Pack>();
+        arg_vec_.resize(num_op_arg_rec_);
+        for(size_t i = 0; i < num_op_arg_rec_; ++i)
+            arg_vec_[i] = addr_t( (*pack)[i] );
+    }
+    /*!
+    If the arguments are packed, set arg_vec_ to the corresponding addr_t
+    values (no work if arg_vec_ is already set). This is undone by
+    clear_random.
+    */
+    void unpack_arg(void)
+    {   if( arg_pack_.size() == 0 || arg_vec_.size() == num_op_arg_rec_ )
+            return;
+        if( arg_compressed_ )
+        {   // decode the arguments one operator at a time
+            arg_vec_.resize(num_op_arg_rec_);
+            play::const_sequential_iterator itr = begin();
+            OpCode        op;
+            const addr_t* arg;
+            size_t        i_var;
+            size_t        i_arg = 0;
+            itr.op_info(op, arg, i_var);
+            while( op != EndOp )
+            {   size_t n_arg = num_arg(op, arg);
+                for(size_t j = 0; j < n_arg; ++j)
+                    arg_vec_[i_arg++] = arg[j];
+                (++itr).op_info(op, arg, i_var);
+            }
+            CPPAD_ASSERT_UNKNOWN( i_arg == num_op_arg_rec_ );
+            return;
+        }
+        switch( arg_pack_type_ )
+        {   case play::unsigned_short_enum:
+            unpack_arg_copy<unsigned short>();
+            break;
+
+            case play::unsigned_int_enum:
+            unpack_arg_copy<unsigned int>();
+            break;
+
+            default:
+            CPPAD_ASSERT_UNKNOWN( arg_pack_type_ == play::size_t_enum );
+            unpack_arg_copy<size_t>();
+            break;
+        }
+    }
+    /// actual number of arguments for an operator
+    /// (not equal NumArg(op) for CSumOp and CSkipOp)
+    static size_t num_arg(OpCode op, const addr_t* arg)
+    {   if( op == CSumOp )
+            return size_t( arg[4] ) + 1;
+        if( op == CSkipOp )
+            return 7 + size_t( arg[4] ) + size_t( arg[5] );
+        return NumArg(op);
+    }
+    // ===============================================================
+    /*!
+    Compress the operator arguments (no work if they are already compressed).
+
+    \par
+    Each argument is encoded using a variable length code that, for variables,
+    is relative to the current operator; see
+    const_sequential_iterator::arg_code_put.
+    The sequential iterators decode the arguments as they go, so the
+    forward, reverse and sparsity sweeps do not need to decompress.
+    Random access (setup_random) creates a temporary addr_t copy
+    of the arguments.
+    */
+    void compress(void)
+    {   if( arg_compressed_ )
+            return;
+        //
+        // type to use when decompressed
+        if( arg_pack_.size() == 0 )
+        {   if( sizeof(addr_t) == sizeof(unsigned short) )
+                arg_pack_type_ = play::unsigned_short_enum;
+            else if( sizeof(addr_t) == sizeof(unsigned int) )
+                arg_pack_type_ = play::unsigned_int_enum;
+            else
+                arg_pack_type_ = play::size_t_enum;
+        }
+        //
+        // code
+        pod_vector<unsigned char> code;
+        play::const_sequential_iterator itr = begin();
+        OpCode        op;
+        const addr_t* arg;
+        size_t        i_var;
+        itr.op_info(op, arg, i_var);
+        while( op != EndOp )
+        {   size_t n_arg = num_arg(op, arg);
+            for(size_t j = 0; j < n_arg; ++j)
+                play::const_sequential_iterator::arg_code_put(
+                    code, i_var, size_t( arg[j] )
+            );
+            if( op == CSumOp || op == CSkipOp )
+                itr.correct_before_increment();
+            (++itr).op_info(op, arg, i_var);
+        }
+        //
+        // free the uncompressed arguments and random access information
+        arg_vec_.clear();
+        clear_random();
+        //
+        // copy so that the capacity of arg_pack_ is not larger than necessary
+        arg_pack_.resize( code.size() );
+        for(size_t i = 0; i < code.size(); ++i)
+            arg_pack_[i] = code[i];
+        arg_compressed_ = true;
+    }
+    /// Undo compress (no work if the arguments are not compressed).
+    void decompress(void)
+    {   if( ! arg_compressed_ )
+            return;
+        unpack_arg();
+        arg_pack_.clear();
+        arg_compressed_ = false;
+        if( pack_arg_ )
+            pack_arg_vec();
+    }
+    /// are the operator arguments compressed
+    bool compressed(void) const
+    {   return arg_compressed_; }
     // ===============================================================
     /*!
     Copy a player<Base> to another player<Base>
@@ -503,10 +739,16 @@ public:
         num_var_rec_        = play.num_var_rec_;
         num_var_load_rec_   = play.num_var_load_rec_;
         num_var_vecad_rec_  = play.num_var_vecad_rec_;
+        num_op_arg_rec_     = play.num_op_arg_rec_;
+        arg_pack_type_      = play.arg_pack_type_;
+        arg_compressed_     = play.arg_compressed_;
+        huge_page_          = play.huge_page_;
+        pack_arg_           = play.pack_arg_;
         //
-        // pod_vectors
+        // pod_vectors (assignment also copies their allocation policy)
         op_vec_             = play.op_vec_;
         arg_vec_            = play.arg_vec_;
+        arg_pack_           = play.arg_pack_;
         text_vec_           = play.text_vec_;
         all_var_vecad_ind_  = play.all_var_vecad_ind_;
         dyn_par_is_         = play.dyn_par_is_;
@@ -530,10 +772,16 @@ public:
         play.num_var_rec_        = num_var_rec_;
         play.num_var_load_rec_   = num_var_load_rec_;
         play.num_var_vecad_rec_  = num_var_vecad_rec_;
+        play.num_op_arg_rec_     = num_op_arg_rec_;
+        play.arg_pack_type_      = arg_pack_type_;
+        play.arg_compressed_     = arg_compressed_;
+        play.huge_page_          = huge_page_;
+        play.pack_arg_           = pack_arg_;
         //
         // pod_vectors
         play.op_vec_             = op_vec_;
         play.arg_vec_            = arg_vec_;
+        play.arg_pack_           = arg_pack_;
         play.text_vec_           = text_vec_;
         play.all_var_vecad_ind_  = all_var_vecad_ind_;
         play.dyn_par_is_         = dyn_par_is_;
@@ -545,6 +793,7 @@ public:
         play.var2op_vec_         = var2op_vec_;
         //
         // pod_maybe_vector< AD<Base> > = pod_maybe_vector<Base>
+        play.all_par_vec_.huge_page( all_par_vec_.huge_page() );
         play.all_par_vec_.resize( all_par_vec_.size() );
         for(size_t i = 0; i < all_par_vec_.size(); ++i)
             play.all_par_vec_[i] = all_par_vec_[i];
@@ -560,10 +809,16 @@ public:
         std::swap(num_var_rec_,        other.num_var_rec_);
         std::swap(num_var_load_rec_,   other.num_var_load_rec_);
         std::swap(num_var_vecad_rec_,  other.num_var_vecad_rec_);
+        std::swap(num_op_arg_rec_,     other.num_op_arg_rec_);
+        std::swap(arg_pack_type_,      other.arg_pack_type_);
+        std::swap(arg_compressed_,     other.arg_compressed_);
+        std::swap(huge_page_,          other.huge_page_);
+        std::swap(pack_arg_,           other.pack_arg_);
         //
         // pod_vectors
         op_vec_.swap(             other.op_vec_);
         arg_vec_.swap(            other.arg_vec_);
+        arg_pack_.swap(           other.arg_pack_);
         text_vec_.swap(           other.text_vec_);
         all_var_vecad_ind_.swap(  other.all_var_vecad_ind_);
         dyn_par_is_.swap(         other.dyn_par_is_);
@@ -581,11 +836,104 @@ public:
     void operator=(player&& play)
     {   swap(play); }
     // =================================================================
+    /// Interleave the memory for this recording across the NUMA nodes
+    /// (returns the number of bytes that were interleaved)
+    size_t numa_interleave(void)
+    {   size_t num_bytes = 0;
+        //
+        // pod_vectors
+        num_bytes += op_vec_.numa_interleave();
+        num_bytes += arg_vec_.numa_interleave();
+        num_bytes += arg_pack_.numa_interleave();
+        num_bytes += text_vec_.numa_interleave();
+        num_bytes += all_var_vecad_ind_.numa_interleave();
+        num_bytes += dyn_par_is_.numa_interleave();
+        num_bytes += dyn_ind2par_ind_.numa_interleave();
+        num_bytes += dyn_par_op_.numa_interleave();
+        num_bytes += dyn_par_arg_.numa_interleave();
+        num_bytes += op2arg_vec_.numa_interleave();
+        num_bytes += op2var_vec_.numa_interleave();
+        num_bytes += var2op_vec_.numa_interleave();
+        //
+        // pod_maybe_vectors
+        num_bytes += all_par_vec_.numa_interleave();
+        //
+        return num_bytes;
+    }
+    // =================================================================
+    /*!
+    Set the allocation policy for the vectors in this recording.
+
+    \param value
+    If true, the vectors use pod_vector::huge_page(true) and the current
+    recording is moved to such memory. This policy is kept when a new
+    recording is stored in this player. Otherwise, the vectors use
+    the default policy for future allocations.
+    */
+    void huge_page(bool value)
+    {   huge_page_ = value;
+        //
+        // pod_vectors
+        op_vec_.huge_page(value);
+        arg_vec_.huge_page(value);
+        arg_pack_.huge_page(value);
+        text_vec_.huge_page(value);
+        all_var_vecad_ind_.huge_page(value);
+        dyn_par_is_.huge_page(value);
+        dyn_ind2par_ind_.huge_page(value);
+        dyn_par_op_.huge_page(value);
+        dyn_par_arg_.huge_page(value);
+        op2arg_vec_.huge_page(value);
+        op2var_vec_.huge_page(value);
+        var2op_vec_.huge_page(value);
+        //
+        // pod_maybe_vectors
+        all_par_vec_.huge_page(value);
+    }
+    /// is the huge page allocation policy used for this recording
+    bool huge_page(void) const
+    {   return huge_page_; }
+    // =================================================================
+    /*!
+    Set the argument packing policy for this player.
+
+    \param value
+    If true, the operation arguments are packed using pack_arg_vec
+    (for this recording and future recordings stored in this player).
+    Otherwise they are stored using addr_t.
+    If the arguments are compressed, they are decompressed
+    (which applies the policy) and then compressed again.
+    */
+    void pack_arg(bool value)
+    {   pack_arg_ = value;
+        if( arg_compressed_ )
+        {   decompress();
+            compress();
+            return;
+        }
+        if( value )
+        {   if( arg_pack_.size() == 0 && num_op_arg_rec_ > 0 )
+            {   // random access information refers to arg_vec_
+                clear_random();
+                pack_arg_vec();
+            }
+        }
+        else if( arg_pack_.size() > 0 )
+        {   unpack_arg();
+            arg_pack_.clear();
+        }
+    }
+    /// is the argument packing policy used for this player
+    bool pack_arg(void) const
+    {   return pack_arg_; }
+    // =================================================================
     /// Enable use of const_subgraph_iterator and member functions that begin
     // with random_(no work if already setup).
     template <class Addr>
     void setup_random(void)
-    {   play::random_setup(
+    {   // random access uses the addr_t version of the arguments
+        unpack_arg();
+        play::random_setup(
             num_var_rec_                               ,
             op_vec_                                    ,
             arg_vec_                                   ,
@@ -597,7 +945,9 @@ public:
     /// Free memory used for functions that begin with random_
     /// and random iterators and subgraph iterators
     void clear_random(void)
-    {
+    {   // addr_t version of arguments is not needed when they are packed
+        if( arg_pack_.size() > 0 )
+            arg_vec_.clear();
         op2arg_vec_.clear();
         op2var_vec_.clear();
         var2op_vec_.clear();
@@ -725,7 +1075,27 @@ public:
 
     /// Fetch number of argument indices in the recording.
     size_t num_op_arg_rec(void) const
-    {   return arg_vec_.size(); }
+    {   return num_op_arg_rec_; }
+
+    /// Number of bytes used to store each operation argument index
+    /// (see pack_arg_vec). If the arguments are compressed, this is the value
+    /// after they are decompressed.
+    size_t size_op_arg_byte(void) const
+    {   if( arg_pack_.size() == 0 )
+            return sizeof(addr_t);
+        switch( arg_pack_type_ )
+        {   case play::unsigned_short_enum:
+            return sizeof(unsigned short);
+
+            case play::unsigned_int_enum:
+            return sizeof(unsigned int);
+
+            default:
+            CPPAD_ASSERT_UNKNOWN( arg_pack_type_ == play::size_t_enum );
+            break;
+        }
+        return sizeof(size_t);
+    }
 
     /// Fetch number of parameters in the recording.
     size_t num_par_rec(void) const
@@ -739,14 +1109,26 @@ public:
     /// the operation sequence, just lengths, not capacities.
     /// In user api as f.size_op_seq(); see the file fun_property.omh.
     size_t size_op_seq(void) const
+    {   if( arg_compressed_ )
+            return size_op_seq_decompressed()
+                - num_op_arg_rec_ * size_op_arg_byte() + arg_pack_.size();
+        return size_op_seq_decompressed();
+    }
+    /// Value of size_op_seq after the arguments are decompressed.
+    /// In user api as f.size_op_seq_decompressed(); see fun_compress.hpp.
+    size_t size_op_seq_decompressed(void) const
     {   // check assumptions made by ad_fun<Base>::size_op_seq()
         CPPAD_ASSERT_UNKNOWN( op_vec_.size() == num_op_rec() );
-        CPPAD_ASSERT_UNKNOWN( arg_vec_.size()    == num_op_arg_rec() );
+        CPPAD_ASSERT_UNKNOWN(
+            arg_compressed_ ||
+            arg_pack_.size() == num_op_arg_rec() * size_op_arg_byte() ||
+            arg_vec_.size()  == num_op_arg_rec()
+        );
         CPPAD_ASSERT_UNKNOWN( all_par_vec_.size() == num_par_rec() );
         CPPAD_ASSERT_UNKNOWN( text_vec_.size() == num_text_rec() );
         CPPAD_ASSERT_UNKNOWN( all_var_vecad_ind_.size() == num_var_vecad_ind_rec() );
         return op_vec_.size()        * sizeof(opcode_t)
-             + arg_vec_.size()       * sizeof(addr_t)
+             + num_op_arg_rec_       * size_op_arg_byte()
              + all_par_vec_.size()   * sizeof(Base)
              + dyn_par_is_.size()    * sizeof(bool)
              + dyn_ind2par_ind_.size() * sizeof(addr_t)
@@ -756,6 +1138,16 @@ public:
              + all_var_vecad_ind_.size() * sizeof(addr_t)
         ;
     }
+    /// Part of size_op_seq used for the dynamic parameter information.
+    /// In user api as f.memory_report().current.dynamic.
+    size_t size_dynamic(void) const
+    {   // dyn_par_is_ has an element for every parameter so it is not
+        // included here
+        return dyn_ind2par_ind_.size() * sizeof(addr_t)
+             + dyn_par_op_.size()      * sizeof(opcode_t)
+             + dyn_par_arg_.size()     * sizeof(addr_t)
+        ;
+    }
     /// A measure of amount of memory used for random access routine
     /// In user api as f.size_random(); see the file fun_property.omh.
     size_t size_random(void) const
@@ -790,9 +1182,14 @@ public:
         }
 # endif
         CPPAD_ASSERT_UNKNOWN( sizeof(unsigned char) == 1 );
+        // addr_t version of the arguments when they are packed
+        size_t unpack = 0;
+        if( arg_pack_.size() > 0 )
+            unpack = arg_vec_.size() * sizeof(addr_t);
         return op2arg_vec_.size()
              + op2var_vec_.size()
              + var2op_vec_.size()
+             + unpack
         ;
     }
     // -----------------------------------------------------------------------
@@ -800,16 +1197,32 @@ public:
     play::const_sequential_iterator begin(void) const
     {   size_t op_index = 0;
         size_t num_var  = num_var_rec_;
+        if( arg_pack_.size() == 0 )
+            return play::const_sequential_iterator(
+                num_var, &op_vec_, &arg_vec_, op_index
+            );
+        if( arg_compressed_ )
+            return play::const_sequential_iterator(
+                num_var, &op_vec_, &arg_pack_, op_index
+            );
         return play::const_sequential_iterator(
-            num_var, &op_vec_, &arg_vec_, op_index
+            num_var, &op_vec_, &arg_pack_, arg_pack_type_, op_index
         );
     }
     /// const sequential iterator end
     play::const_sequential_iterator end(void) const
     {   size_t op_index = op_vec_.size() - 1;
         size_t num_var  = num_var_rec_;
+        if( arg_pack_.size() == 0 )
+            return play::const_sequential_iterator(
+                num_var, &op_vec_, &arg_vec_, op_index
+            );
+        if( arg_compressed_ )
+            return play::const_sequential_iterator(
+                num_var, &op_vec_, &arg_pack_, op_index
+            );
         return play::const_sequential_iterator(
-            num_var, &op_vec_, &arg_vec_, op_index
+            num_var, &op_vec_, &arg_pack_, arg_pack_type_, op_index
         );
     }
     // -----------------------------------------------------------------------
@@ -840,7 +1253,9 @@ public:
     /// const random iterator
     template <class Addr>
     play::const_random_iterator<Addr> get_random(void) const
-    {   return play::const_random_iterator<Addr>(
+    {   // setup_random must be called first
+        CPPAD_ASSERT_UNKNOWN( arg_vec_.size() == num_op_arg_rec_ );
+        return play::const_random_iterator<Addr>(
             op_vec_,
             arg_vec_,
             op2arg_vec_.pod_vector_ptr<Addr>(),
@@ -12,23 +12,376 @@ in the Eclipse Public License, Version 2.0 are satisfied:
       GNU General Public License, Version 2.0 or later.
 ---------------------------------------------------------------------------- */
 
+# include <cppad/local/define.hpp>
+# include <cppad/local/pod_vector.hpp>
+# include <cppad/utility/small_vector.hpp>
+# include <cppad/local/play/addr_enum.hpp>
+
 // BEGIN_CPPAD_LOCAL_PLAY_NAMESPACE
 namespace CppAD { namespace local { namespace play {
 
 /*!
 \file sequential_iterator.hpp
 */
+/*!
+Decoder for the packed or compressed arguments of a player object.
+
+\par
+If the player has packed its operator arguments using a type that is smaller
+than addr_t (see player::arg_pack_type), the arguments for the current
+operator are converted to addr_t and stored in arg_buf_.
+If the player has compressed its operator arguments (see player::compress),
+pack_ contains a sequence of bytes and each argument is a variable length
+unsigned integer; see const_sequential_iterator::arg_code_put.
+The arguments for the current operator are decoded and stored in arg_buf_
+in the same way as for packed arguments.
+
+\par
+This state is kept outside of const_sequential_iterator so that
+the iterator is as small as possible when the arguments are not packed.
+*/
+class arg_decoder {
+private:
+    /// packed arguments for all the operators
+    const unsigned char*      pack_;
+
+    /// is pack_ a sequence of variable length codes
+    bool                      code_;
+
+    /// type used for each element of pack_ (not used if code_ is true)
+    addr_enum                 pack_type_;
+
+    /// number of elements in pack_
+    size_t                    pack_size_;
+
+    /// index in pack_ of first argument for current operator
+    size_t                    arg_index_;
+
+    /// actual number of arguments for current operator
+    size_t                    n_arg_;
+
+    /// index in pack_ one past the last byte for current operator
+    /// (only used if code_ is true)
+    size_t                    code_end_;
+
+    /// arguments for current operator converted to addr_t
+    /// (usually does not allocate memory)
+    small_vector<addr_t, 8>   arg_buf_;
+    // -----------------------------------------------------------------------
+    /*!
+    Decode one argument (see const_sequential_iterator::arg_code_put)
+
+    \param index [in,out]
+    On input it is the index in pack_ of the first byte for this argument.
+    Upon return it is one past the index of the last byte.
+
+    \param var_index
+    index of the last result for the current operator.
+
+    \return
+    is the value of the argument.
+    */
+    size_t code_get(size_t& index, size_t var_index) const
+    {   size_t code  = 0;
+        size_t shift = 0;
+        unsigned char byte;
+        do
+        {   CPPAD_ASSERT_UNKNOWN( index < pack_size_ );
+            byte   = pack_[index++];
+            code  |= size_t(byte & 0x7f) << shift;
+            shift += 7;
+        }
+        while( byte & 0x80 );
+        //
+        // relative to one past the last result for this operator
+        if( code & 1 )
+            return var_index + 1 - (code >> 1);
+        return code >> 1;
+    }
+    /// index in pack_ of the first byte for the argument that is n arguments
+    /// before the argument that starts at index
+    size_t code_back(size_t index, size_t n) const
+    {   for(size_t i = 0; i < n; ++i)
+        {   // last byte of the previous argument
+            CPPAD_ASSERT_UNKNOWN( 0 < index );
+            --index;
+            CPPAD_ASSERT_UNKNOWN( (pack_[index] & 0x80) == 0 );
+            while( 0 < index && (pack_[index - 1] & 0x80) )
+                --index;
+        }
+        return index;
+    }
+    /// set n_arg_, arg_buf_ and code_end_ for the operator op where
+    /// arg_index_ is the index of its first byte (only used when code_)
+    void code_decode(OpCode op, size_t var_index)
+    {   CPPAD_ASSERT_UNKNOWN( code_ );
+        //
+        // number of arguments
+        size_t n_arg = NumArg(op);
+        if( op == CSumOp || op == CSkipOp )
+        {   size_t index = arg_index_;
+            size_t value[6];
+            for(size_t i = 0; i < 6; ++i)
+                value[i] = code_get(index, var_index);
+            if( op == CSumOp )
+                n_arg = value[4] + 1;
+            else
+                n_arg = 7 + value[4] + value[5];
+        }
+        n_arg_ = n_arg;
+        //
+        // arguments
+        if( arg_buf_.size() < n_arg )
+            arg_buf_.resize(n_arg);
+        addr_t* buf   = arg_buf_.data();
+        size_t  index = arg_index_;
+        for(size_t i = 0; i < n_arg; ++i)
+            buf[i] = addr_t( code_get(index, var_index) );
+        code_end_ = index;
+    }
+    /// value of the i-th element of pack_
+    size_t pack_value(size_t i) const
+    {   CPPAD_ASSERT_UNKNOWN( i < pack_size_ );
+        switch( pack_type_ )
+        {   case unsigned_short_enum:
+            return size_t( reinterpret_cast<const unsigned short*>(pack_)[i] );
+
+            case unsigned_int_enum:
+            return size_t( reinterpret_cast<const unsigned int*>(pack_)[i] );
+
+            default:
+            CPPAD_ASSERT_UNKNOWN( pack_type_ == size_t_enum );
+            break;
+        }
+        return reinterpret_cast<const size_t*>(pack_)[i];
+    }
+    /// convert n_arg elements of pack_, starting at arg_index_, to arg_buf_
+    template <class Pack>
+    void unpack(size_t n_arg)
+    {   const Pack* pack = reinterpret_cast<const Pack*>(pack_) + arg_index_;
+        addr_t*     buf  = arg_buf_.data();
+        for(size_t i = 0; i < n_arg; ++i)
+            buf[i] = addr_t( pack[i] );
+    }
+    /// set n_arg_ and arg_buf_ using the n_arg elements of pack_
+    /// starting at arg_index_ (only used when code_ is false)
+    void decode(size_t n_arg)
+    {   CPPAD_ASSERT_UNKNOWN( ! code_ );
+        n_arg_ = n_arg;
+        CPPAD_ASSERT_UNKNOWN( arg_index_ + n_arg <= pack_size_ );
+        if( arg_buf_.size() < n_arg )
+            arg_buf_.resize(n_arg);
+        switch( pack_type_ )
+        {   case unsigned_short_enum:
+            unpack<unsigned short>(n_arg);
+            break;
+
+            case unsigned_int_enum:
+            unpack<unsigned int>(n_arg);
+            break;
+
+            default:
+            CPPAD_ASSERT_UNKNOWN( pack_type_ == size_t_enum );
+            unpack<size_t>(n_arg);
+            break;
+        }
+    }
+public:
+    /*!
+    Create a decoder for arguments packed using pack_type elements
+
+    \param arg_pack
+    is the vector of arguments for all the operators, packed
+    using elements of type corresponding to pack_type.
+
+    \param pack_type
+    is the type used for each element of arg_pack.
+    */
+    arg_decoder(
+        const pod_vector<unsigned char>*      arg_pack   ,
+        addr_enum                             pack_type  )
+    :
+    pack_       ( arg_pack->data() )                 ,
+    code_       ( false )                            ,
+    pack_type_  ( pack_type )                        ,
+    arg_index_  ( 0 )                                ,
+    n_arg_      ( 0 )                                ,
+    code_end_   ( 0 )
+    {   switch( pack_type_ )
+        {   case unsigned_short_enum:
+            pack_size_ = arg_pack->size() / sizeof(unsigned short);
+            break;
+
+            case unsigned_int_enum:
+            pack_size_ = arg_pack->size() / sizeof(unsigned int);
+            break;
+
+            default:
+            CPPAD_ASSERT_UNKNOWN( pack_type_ == size_t_enum );
+            pack_size_ = arg_pack->size() / sizeof(size_t);
+            break;
+        }
+    }
+    /*!
+    Create a decoder for compressed arguments
+
+    \param arg_code
+    is the vector of arguments for all the operators, compressed
+    using variable length codes; see const_sequential_iterator::arg_code_put.
+    */
+    arg_decoder(const pod_vector<unsigned char>* arg_code)
+    :
+    pack_       ( arg_code->data() )                 ,
+    code_       ( true )                             ,
+    pack_type_  ( size_t_enum )                      ,
+    pack_size_  ( arg_code->size() )                 ,
+    arg_index_  ( 0 )                                ,
+    n_arg_      ( 0 )                                ,
+    code_end_   ( 0 )
+    { }
+    // -----------------------------------------------------------------------
+    // The iterator only uses the following functions to create and destroy
+    // a decoder. They are not inlined so that the iterator constructors,
+    // and player::begin, remain small enough to be inlined in the sweeps
+    // (when the arguments are not packed).
+    //
+    /// new decoder for packed arguments
+    CPPAD_NOINLINE static arg_decoder* create(
+        const pod_vector<unsigned char>* arg_pack, addr_enum pack_type )
+    {   return new arg_decoder(arg_pack, pack_type); }
+    /// new decoder for compressed arguments
+    CPPAD_NOINLINE static arg_decoder* create(
+        const pod_vector<unsigned char>* arg_code )
+    {   return new arg_decoder(arg_code); }
+    /// new copy of a decoder
+    CPPAD_NOINLINE static arg_decoder* create(const arg_decoder& decoder)
+    {   return new arg_decoder(decoder); }
+    /// delete a decoder
+    CPPAD_NOINLINE static void destroy(arg_decoder* decoder)
+    {   delete decoder; }
+    // -----------------------------------------------------------------------
+    /// arguments for the current operator converted to addr_t
+    const addr_t* arg(void) const
+    {   return arg_buf_.data(); }
+    /// actual number of arguments for the current operator
+    size_t n_arg(void) const
+    {   return n_arg_; }
+    /// index in the packed arguments of the first argument for the
+    /// current operator
+    size_t arg_index(void) const
+    {   return arg_index_; }
+    /// number of elements in the packed arguments
+    size_t pack_size(void) const
+    {   return pack_size_; }
+    /*!
+    Decode the arguments for the first or last operator
+
+    \param op
+    is the operator; i.e., BeginOp or EndOp.
+
+    \param var_index
+    is the index of the last result for op.
+
+    \return
+    pointer to the arguments for op.
+    */
+    CPPAD_NOINLINE const addr_t* start(OpCode op, size_t var_index)
+    {   CPPAD_ASSERT_UNKNOWN( op == BeginOp || op == EndOp );
+        if( op == BeginOp )
+            arg_index_ = 0;
+        else
+            arg_index_ = pack_size_;
+        if( code_ )
+            code_decode(op, var_index);
+        else
+            decode( NumArg(op) );
+        return arg_buf_.data();
+    }
+    /*!
+    Decode the arguments for the operator after the current one
+
+    \param op
+    is the next operator.
+
+    \param var_index
+    is the index of the last result for op.
+
+    \return
+    pointer to the arguments for op.
+    */
+    CPPAD_NOINLINE const addr_t* next(OpCode op, size_t var_index)
+    {   if( code_ )
+        {   arg_index_ = code_end_;
+            code_decode(op, var_index);
+            return arg_buf_.data();
+        }
+        arg_index_ += n_arg_;
+        size_t n_arg = NumArg(op);
+        if( op == CSumOp )
+            n_arg = pack_value(arg_index_ + 4) + 1;
+        else if( op == CSkipOp )
+            n_arg = 7 + pack_value(arg_index_ + 4) + pack_value(arg_index_ + 5);
+        decode(n_arg);
+        return arg_buf_.data();
+    }
+    /*!
+    Decode the arguments for the operator before the current one
+
+    \param op
+    is the previous operator.
+
+    \param var_index
+    is the index of the last result for op.
+
+    \return
+    pointer to the arguments for op.
+    */
+    CPPAD_NOINLINE const addr_t* previous(OpCode op, size_t var_index)
+    {   if( code_ )
+        {   code_end_ = arg_index_;
+            //
+            // last argument is arg[4] for CSumOp, arg[4]+arg[5] for CSkipOp
+            size_t n_arg = NumArg(op);
+            if( op == CSumOp || op == CSkipOp )
+            {   size_t index = code_back(code_end_, 1);
+                size_t last  = code_get(index, var_index);
+                if( op == CSumOp )
+                    n_arg = last + 1;
+                else
+                    n_arg = 7 + last;
+            }
+            arg_index_ = code_back(code_end_, n_arg);
+            code_decode(op, var_index);
+            return arg_buf_.data();
+        }
+        size_t n_arg = NumArg(op);
+        if( op == CSumOp )
+            n_arg = pack_value(arg_index_ - 1) + 1;
+        else if( op == CSkipOp )
+            n_arg = 7 + pack_value(arg_index_ - 1);
+        arg_index_ -= n_arg;
+        decode(n_arg);
+        return arg_buf_.data();
+    }
+};
 
 /*!
 Constant sequential iterator for a player object.
 
-\tparam Addr
-An integer type capable of representing the largest value in the vectors
-arg_vec, op2arg_vec, op2var_vec, var2op_vec.
-
 \par
 Except for constructor, the public API for this class is the same as
 for the subgraph_iterator class.
+
+\par Packed Arguments
+If the player has packed or compressed its operator arguments,
+decoder_ converts the arguments for the current operator to addr_t
+(see arg_decoder).
+In this case the pointer returned by op_info is only valid until
+the iterator is moved to another operator.
+In addition, the actual number of arguments for CSumOp and CSkipOp
+is determined when the iterator is moved to the operator, so the
+corrections before increment and after decrement are not necessary
+(but they are allowed).
 */
 class const_sequential_iterator {
 private:
@@ -39,9 +392,11 @@ private:
     const opcode_t*           op_end_;
 
     /// pointer to the first argument for the first operator
+    /// (null when the arguments are packed)
     const addr_t*             arg_begin_;
 
     /// pointer on past last argumemnt for last operator
+    /// (null when the arguments are packed)
     const addr_t*             arg_end_;
 
     /// pointer to current operator
@@ -58,6 +413,49 @@ private:
 
     /// value of current operator; i.e. op_ = *op_cur_
     OpCode                    op_;
+
+    /// decoder for packed arguments (null if the arguments are not packed)
+    arg_decoder*              decoder_;
+    // -----------------------------------------------------------------------
+    /// common part of the constructors
+    void init(size_t num_var, size_t num_op, size_t op_index)
+    {   num_var_ = num_var;
+        if( op_index == 0 )
+        {
+            // index of last result for BeginOp
+            var_index_ = 0;
+            //
+            // BeginOp
+            op_cur_    = op_begin_;
+            op_        = OpCode( *op_cur_ );
+            CPPAD_ASSERT_UNKNOWN( op_ == BeginOp );
+            CPPAD_ASSERT_NARG_NRES(op_, 1, 1);
+            //
+            // first argument to BeginOp
+            if( decoder_ == nullptr )
+                arg_ = arg_begin_;
+            else
+                arg_ = decoder_->start(op_, var_index_);
+        }
+        else
+        {   CPPAD_ASSERT_UNKNOWN(op_index == num_op - 1);
+            //
+            // index of last result for EndOp
+            var_index_ = num_var - 1;
+            //
+            // EndOp
+            op_cur_    = op_end_ - 1;
+            op_        = OpCode( *op_cur_ );
+            CPPAD_ASSERT_UNKNOWN( op_ == EndOp );
+            CPPAD_ASSERT_NARG_NRES(op_, 0, 0);
+            //
+            // first argument to EndOp (has no arguments)
+            if( decoder_ == nullptr )
+                arg_ = arg_end_;
+            else
+                arg_ = decoder_->start(op_, var_index_);
+        }
+    }
 public:
     /// default constructor
     const_sequential_iterator(void) :
@@ -69,8 +467,19 @@ public:
     arg_(nullptr)       ,
     num_var_(0)            ,
     var_index_(0)          ,
-    op_(NumberOp)
+    op_(NumberOp)          ,
+    decoder_(nullptr)
     { }
+    /// copy constructor
+    const_sequential_iterator(const const_sequential_iterator& rhs)
+    :
+    decoder_(nullptr)
+    {   *this = rhs; }
+    /// destructor
+    ~const_sequential_iterator(void)
+    {   if( decoder_ != nullptr )
+            arg_decoder::destroy(decoder_);
+    }
     /// assignment operator
     void operator=(const const_sequential_iterator& rhs)
     {
@@ -83,6 +492,16 @@ public:
         num_var_   = rhs.num_var_;
         var_index_ = rhs.var_index_;
         op_        = rhs.op_;
+        if( decoder_ != rhs.decoder_ )
+        {   if( decoder_ != nullptr )
+                arg_decoder::destroy(decoder_);
+            decoder_ = nullptr;
+            if( rhs.decoder_ != nullptr )
+            {   // arg_ must point to this iterators copy of the arguments
+                decoder_ = arg_decoder::create( *rhs.decoder_ );
+                arg_     = decoder_->arg();
+            }
+        }
         return;
     }
     /*!
@@ -115,36 +534,109 @@ public:
     op_end_     ( op_vec->data() + op_vec->size() )  ,
     arg_begin_  ( arg_vec->data() )                  ,
     arg_end_    ( arg_vec->data() + arg_vec->size() ),
-    num_var_    ( num_var )
-    {   if( op_index == 0 )
-        {
-            // index of last result for BeginOp
-            var_index_ = 0;
-            //
-            // first argument to BeginOp
-            arg_       = arg_vec->data();
-            //
-            // BeginOp
-            op_cur_    = op_begin_;
-            op_        = OpCode( *op_cur_ );
-            CPPAD_ASSERT_UNKNOWN( op_ == BeginOp );
-            CPPAD_ASSERT_NARG_NRES(op_, 1, 1);
+    decoder_    ( nullptr )
+    {   init(num_var, op_vec->size(), op_index); }
+    /*!
+    Create a sequential iterator for packed arguments
+
+    \param num_var
+    is the number of variables in the tape.
+
+    \param op_vec
+    is the vector of operators on the tape.
+
+    \param arg_pack
+    is the vector of arguments for all the operators, packed
+    using elements of type corresponding to pack_type.
+
+    \param pack_type
+    is the type used for each element of arg_pack.
+
+    \param op_index
+    is the operator index that iterator will start at.
+    It must be zero or op_vec_->size() - 1.
+    */
+    const_sequential_iterator(
+        size_t                                num_var    ,
+        const pod_vector<opcode_t>*           op_vec     ,
+        const pod_vector<unsigned char>*      arg_pack   ,
+        addr_enum                             pack_type  ,
+        size_t                                op_index   )
+    :
+    op_begin_   ( op_vec->data() )                   ,
+    op_end_     ( op_vec->data() + op_vec->size() )  ,
+    arg_begin_  ( nullptr )                          ,
+    arg_end_    ( nullptr )                          ,
+    decoder_    ( arg_decoder::create(arg_pack, pack_type) )
+    {   init(num_var, op_vec->size(), op_index); }
+    /*!
+    Create a sequential iterator for compressed arguments
+
+    \param num_var
+    is the number of variables in the tape.
+
+    \param op_vec
+    is the vector of operators on the tape.
+
+    \param arg_code
+    is the vector of arguments for all the operators, compressed
+    using variable length codes; see arg_code_put.
+
+    \param op_index
+    is the operator index that iterator will start at.
+    It must be zero or op_vec_->size() - 1.
+    */
+    const_sequential_iterator(
+        size_t                                num_var    ,
+        const pod_vector<opcode_t>*           op_vec     ,
+        const pod_vector<unsigned char>*      arg_code   ,
+        size_t                                op_index   )
+    :
+    op_begin_   ( op_vec->data() )                   ,
+    op_end_     ( op_vec->data() + op_vec->size() )  ,
+    arg_begin_  ( nullptr )                          ,
+    arg_end_    ( nullptr )                          ,
+    decoder_    ( arg_decoder::create(arg_code) )
+    {   init(num_var, op_vec->size(), op_index); }
+    /*!
+    Encode one argument using a variable length code
+
+    \param code [in,out]
+    The bytes corresponding to this argument are added at the end of code.
+
+    \param var_index
+    is the index of the last result for the operator that this argument
+    belongs to (as returned by op_info).
+
+    \param value
+    is the value of the argument.
+
+    \par Code
+    If value <= var_index, let delta = var_index + 1 - value. If this case
+    holds and delta < value, the code for the argument is 2 * delta + 1,
+    otherwise it is 2 * value. Thus variable indices, which are
+    less than or equal var_index, are usually coded relative to the
+    current operator.
+    The code is stored seven bits per byte, low order bits first, and the
+    high order bit of a byte is one if and only if it is not the last byte.
+    This enables decoding in the forward and reverse directions.
+    */
+    static void arg_code_put(
+        pod_vector<unsigned char>& code      ,
+        size_t                     var_index ,
+        size_t                     value     )
+    {   size_t c = 2 * value;
+        if( value <= var_index )
+        {   size_t delta = var_index + 1 - value;
+            if( delta < value )
+                c = 2 * delta + 1;
         }
-        else
-        {   CPPAD_ASSERT_UNKNOWN(op_index == op_vec->size()-1);
-            //
-            // index of last result for EndOp
-            var_index_ = num_var - 1;
-            //
-            // first argument to EndOp (has no arguments)
-            arg_ = arg_vec->data() + arg_vec->size();
-            //
-            // EndOp
-            op_cur_    = op_end_ - 1;
-            op_        = OpCode( *op_cur_ );
-            CPPAD_ASSERT_UNKNOWN( op_ == EndOp );
-            CPPAD_ASSERT_NARG_NRES(op_, 0, 0);
+        CPPAD_ASSERT_UNKNOWN( (c >> 1) == value || (c & 1) == 1 );
+        while( c >= 0x80 )
+        {   code.push_back( (unsigned char)( (c & 0x7f) | 0x80 ) );
+            c >>= 7;
         }
+        code.push_back( (unsigned char)( c ) );
     }
     /*!
     Advance iterator to next operator
@@ -161,6 +653,10 @@ public:
         // last result for next operator
         var_index_ += NumRes(op_);
         //
+        // packed arguments for next operator
+        if( decoder_ != nullptr )
+            arg_ = decoder_->next(op_, var_index_);
+        //
         return *this;
     }
     /*!
@@ -170,6 +666,11 @@ public:
     void correct_before_increment(void)
     {   // number of arguments for this operator depends on argument data
         CPPAD_ASSERT_UNKNOWN( NumArg(op_) == 0 );
+        //
+        // already included by operator++ when arguments are packed
+        if( decoder_ != nullptr )
+            return;
+        //
         const addr_t* arg = arg_;
         //
         // CSumOp
@@ -204,7 +705,10 @@ public:
         op_ = OpCode( *op_cur_ );
         //
         // first argument for next operator
-        arg_ -= NumArg(op_);
+        if( decoder_ == nullptr )
+            arg_ -= NumArg(op_);
+        else
+            arg_ = decoder_->previous(op_, var_index_);
         //
         return *this;
     }
@@ -219,6 +723,16 @@ public:
     {   // number of arguments for this operator depends on argument data
         CPPAD_ASSERT_UNKNOWN( NumArg(op_) == 0 );
         //
+        // correction already included by operator-- when arguments are packed
+        if( decoder_ != nullptr )
+        {   arg = arg_;
+            CPPAD_ASSERT_UNKNOWN( op_ != CSumOp  || arg[arg[4]] == arg[4] );
+            CPPAD_ASSERT_UNKNOWN(
+                op_ != CSkipOp || arg[4] + arg[5] == arg[6 + arg[4] + arg[5]]
+            );
+            return;
+        }
+        //
         // infromation for number of arguments is stored in arg_ - 1
         CPPAD_ASSERT_UNKNOWN( arg_begin_ < arg_ );
         //
@@ -257,6 +771,8 @@ public:
 
     \param arg [out]
     pointer to the first arguement to this operator.
+    If the arguments are packed, this pointer is only valid until
+    this iterator is moved.
 
     \param var_index [out]
     index of the last variable (primary variable) for this operator.
@@ -273,8 +789,11 @@ public:
         //
         // arg
         arg = arg_;
-        CPPAD_ASSERT_UNKNOWN( arg_begin_ <= arg );
-        CPPAD_ASSERT_UNKNOWN( arg + NumArg(op) <= arg_end_ );
+        CPPAD_ASSERT_UNKNOWN( decoder_ != nullptr || arg_begin_ <= arg );
+        CPPAD_ASSERT_UNKNOWN( decoder_ != nullptr || arg + NumArg(op) <= arg_end_ );
+        CPPAD_ASSERT_UNKNOWN( decoder_ == nullptr ||
+            decoder_->arg_index() + NumArg(op) <= decoder_->pack_size()
+        );
         //
         // var_index
         CPPAD_ASSERT_UNKNOWN( var_index_ < num_var_ || NumRes(op) == 0 );
@@ -45,13 +45,23 @@ private:
     /// (not defined and should not be used when byte_capacity_ = 0)
     Type   *data_;
 
+    /// if true, memory is obtained using thread_alloc::get_huge_memory
+    bool   huge_page_;
+
     /// do not use the copy constructor
     explicit pod_vector(const pod_vector& )
     {   CPPAD_ASSERT_UNKNOWN(false); }
+
+    /// get memory using the allocation policy for this vector
+    void* get_memory(size_t min_bytes, size_t& cap_bytes)
+    {   if( huge_page_ )
+            return thread_alloc::get_huge_memory(min_bytes, cap_bytes);
+        return thread_alloc::get_memory(min_bytes, cap_bytes);
+    }
 public:
     /// default constructor sets byte_capacity_ = byte_length_ = data_ = 0
     pod_vector(void)
-    : byte_capacity_(0), byte_length_(0), data_(nullptr)
+    : byte_capacity_(0), byte_length_(0), data_(nullptr), huge_page_(false)
     {   CPPAD_ASSERT_UNKNOWN( is_pod<Type>() );
     }
 
@@ -59,7 +69,7 @@ public:
     pod_vector(
         /// number of elements in this vector
         size_t n )
-    : byte_capacity_(0), byte_length_(0), data_(nullptr)
+    : byte_capacity_(0), byte_length_(0), data_(nullptr), huge_page_(false)
     {   CPPAD_ASSERT_UNKNOWN( is_pod<Type>() );
         extend(n);
     }
@@ -168,6 +178,46 @@ public:
     {   std::swap(byte_capacity_, other.byte_capacity_);
         std::swap(byte_length_,   other.byte_length_);
         std::swap(data_,          other.data_);
+        std::swap(huge_page_,     other.huge_page_);
+    }
+    // ----------------------------------------------------------------------
+    /// is memory for this vector obtained using get_huge_memory
+    bool huge_page(void) const
+    {   return huge_page_; }
+    /*!
+    Set the allocation policy for this vector.
+
+    \param value
+    If true, the memory for this vector is obtained using
+    thread_alloc::get_huge_memory and the current elements are moved
+    to such memory. Otherwise, future memory for this vector is obtained
+    using thread_alloc::get_memory (the current memory is not changed).
+    */
+    void huge_page(bool value)
+    {   bool move  = value && (! huge_page_) && byte_capacity_ > 0;
+        huge_page_ = value;
+        if( ! move )
+            return;
+        pod_vector other;
+        other.huge_page_ = true;
+        other.extend( size() );
+        if( byte_length_ > 0 )
+            std::memcpy(other.data_, data_, byte_length_);
+        swap(other);
+    }
+    // ----------------------------------------------------------------------
+    /*!
+    Interleave the memory for this vector across the NUMA nodes.
+
+    \return
+    is the number of bytes that were interleaved; see
+    thread_alloc::numa_interleave.
+    */
+    size_t numa_interleave(void)
+    {   if( byte_capacity_ == 0 )
+            return 0;
+        void* v_ptr = reinterpret_cast<void*>( data_ );
+        return thread_alloc::numa_interleave(v_ptr, byte_capacity_);
     }
     // ----------------------------------------------------------------------
     /*!
@@ -201,7 +251,7 @@ public:
         void* old_v_ptr     = reinterpret_cast<void*>(data_);
 
         // get new memory and set capacity
-        void* v_ptr = thread_alloc::get_memory(byte_length_, byte_capacity_);
+        void* v_ptr = get_memory(byte_length_, byte_capacity_);
         data_       = reinterpret_cast<Type*>(v_ptr);
 
         // copy old data to new
@@ -250,7 +300,7 @@ public:
             }
             //
             // get new memory and set capacity
-            v_ptr     = thread_alloc::get_memory(byte_length_, byte_capacity_);
+            v_ptr     = get_memory(byte_length_, byte_capacity_);
             data_     = reinterpret_cast<Type*>(v_ptr);
             //
         }
@@ -258,6 +308,34 @@ public:
     }
     // ----------------------------------------------------------------------
     /*!
+    Increase the capacity of this vector
+    (existing elements are always preserved).
+
+    \param n
+    is the minimum number of elements that the capacity must hold.
+    If n <= capacity(), this operation has no effect.
+    */
+    void reserve(size_t n)
+    {   if( n * sizeof(Type) <= byte_capacity_ )
+            return;
+        size_t old_length = byte_length_;
+        extend( n - old_length / sizeof(Type) );
+        byte_length_      = old_length;
+    }
+    // ----------------------------------------------------------------------
+    /*!
+    Reduce the capacity of this vector if it is more than twice
+    the number of elements (existing elements are always preserved).
+    */
+    void shrink(void)
+    {   if( byte_capacity_ <= 2 * byte_length_ )
+            return;
+        pod_vector copy;
+        copy = *this;
+        swap(copy);
+    }
+    // ----------------------------------------------------------------------
+    /*!
     Remove all the elements from this vector and free its memory.
     */
     void clear(void)
@@ -271,12 +349,16 @@ public:
         byte_length_   = 0;
     }
     // -----------------------------------------------------------------------
-    /// vector assignment operator
+    /// vector assignment operator (the allocation policy is also copied)
     void operator=(
         /// right hand size of the assingment operation
         const pod_vector& x
     )
     {   CPPAD_ASSERT_UNKNOWN( x.byte_length_ % sizeof(Type) == 0 );
+        if( huge_page_ != x.huge_page_ )
+        {   clear();
+            huge_page_ = x.huge_page_;
+        }
         resize( x.byte_length_ / sizeof(Type) );
         if( byte_length_ > 0 )
         {
@@ -305,13 +387,23 @@ private:
     /// (not defined and should not be used when capacity_ = 0)
     Type   *data_;
 
+    /// if true, memory is obtained using thread_alloc::get_huge_memory
+    bool   huge_page_;
+
     /// do not use the copy constructor
     explicit pod_vector_maybe(const pod_vector_maybe& )
     {   CPPAD_ASSERT_UNKNOWN(false); }
+
+    /// get memory using the allocation policy for this vector
+    void* get_memory(size_t min_bytes, size_t& cap_bytes)
+    {   if( huge_page_ )
+            return thread_alloc::get_huge_memory(min_bytes, cap_bytes);
+        return thread_alloc::get_memory(min_bytes, cap_bytes);
+    }
 public:
     /// default constructor sets capacity_ = length_ = data_ = 0
     pod_vector_maybe(void)
-    : capacity_(0), length_(0), data_(nullptr)
+    : capacity_(0), length_(0), data_(nullptr), huge_page_(false)
     {   CPPAD_ASSERT_UNKNOWN( is_pod<size_t>() );
     }
 
@@ -319,7 +411,7 @@ public:
     pod_vector_maybe(
         /// number of elements in this vector
         size_t n )
-    : capacity_(0), length_(0), data_(nullptr)
+    : capacity_(0), length_(0), data_(nullptr), huge_page_(false)
     {   extend(n); }
 
 
@@ -409,9 +501,49 @@ public:
     is the other vector that we are swapping this vector with.
     */
     void swap(pod_vector_maybe& other)
-    {   std::swap(capacity_, other.capacity_);
-        std::swap(length_,   other.length_);
-        std::swap(data_,     other.data_);
+    {   std::swap(capacity_,  other.capacity_);
+        std::swap(length_,    other.length_);
+        std::swap(data_,      other.data_);
+        std::swap(huge_page_, other.huge_page_);
+    }
+    // ----------------------------------------------------------------------
+    /// is memory for this vector obtained using get_huge_memory
+    bool huge_page(void) const
+    {   return huge_page_; }
+    /*!
+    Set the allocation policy for this vector.
+
+    \param value
+    If true, the memory for this vector is obtained using
+    thread_alloc::get_huge_memory and the current elements are moved
+    to such memory. Otherwise, future memory for this vector is obtained
+    using thread_alloc::get_memory (the current memory is not changed).
+    */
+    void huge_page(bool value)
+    {   bool move  = value && (! huge_page_) && capacity_ > 0;
+        huge_page_ = value;
+        if( ! move )
+            return;
+        pod_vector_maybe other;
+        other.huge_page_ = true;
+        other.extend(length_);
+        for(size_t i = 0; i < length_; i++)
+            other.data_[i] = data_[i];
+        swap(other);
+    }
+    // ----------------------------------------------------------------------
+    /*!
+    Interleave the memory for this vector across the NUMA nodes.
+
+    \return
+    is the number of bytes that were interleaved; see
+    thread_alloc::numa_interleave.
+    */
+    size_t numa_interleave(void)
+    {   if( capacity_ == 0 )
+            return 0;
+        void* v_ptr = reinterpret_cast<void*>( data_ );
+        return thread_alloc::numa_interleave(v_ptr, capacity_ * sizeof(Type));
     }
     // ----------------------------------------------------------------------
     /*!
@@ -447,7 +579,7 @@ public:
         // get new memory and set capacity
         size_t length_bytes = length_ * sizeof(Type);
         size_t capacity_bytes;
-        void* v_ptr = thread_alloc::get_memory(length_bytes, capacity_bytes);
+        void* v_ptr = get_memory(length_bytes, capacity_bytes);
         capacity_   = capacity_bytes / sizeof(Type);
         data_       = reinterpret_cast<Type*>(v_ptr);
 
@@ -516,7 +648,7 @@ public:
             // get new memory and set capacity
             size_t length_bytes = length_ * sizeof(Type);
             size_t capacity_bytes;
-            v_ptr     = thread_alloc::get_memory(length_bytes, capacity_bytes);
+            v_ptr     = get_memory(length_bytes, capacity_bytes);
             capacity_ = capacity_bytes / sizeof(Type);
             data_     = reinterpret_cast<Type*>(v_ptr);
             //
@@ -531,6 +663,34 @@ public:
     }
     // ----------------------------------------------------------------------
     /*!
+    Increase the capacity of this vector
+    (existing elements are always preserved).
+
+    \param n
+    is the minimum number of elements that the capacity must hold.
+    If n <= capacity(), this operation has no effect.
+    */
+    void reserve(size_t n)
+    {   if( n <= capacity_ )
+            return;
+        size_t old_length = length_;
+        extend( n - old_length );
+        length_           = old_length;
+    }
+    // ----------------------------------------------------------------------
+    /*!
+    Reduce the capacity of this vector if it is more than twice
+    the number of elements (existing elements are always preserved).
+    */
+    void shrink(void)
+    {   if( capacity_ <= 2 * length_ )
+            return;
+        pod_vector_maybe copy;
+        copy = *this;
+        swap(copy);
+    }
+    // ----------------------------------------------------------------------
+    /*!
     Remove all the elements from this vector and free its memory.
     */
     void clear(void)
@@ -548,12 +708,16 @@ public:
         length_   = 0;
     }
     // -----------------------------------------------------------------------
-    /// vector assignment operator
+    /// vector assignment operator (the allocation policy is also copied)
     void operator=(
         /// right hand size of the assingment operation
         const pod_vector_maybe& x
     )
-    {   resize( x.length_ );
+    {   if( huge_page_ != x.huge_page_ )
+        {   clear();
+            huge_page_ = x.huge_page_;
+        }
+        resize( x.length_ );
         //
         CPPAD_ASSERT_UNKNOWN( length_   == x.length_ );
         for(size_t i = 0; i < length_; i++)
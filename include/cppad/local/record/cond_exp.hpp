@@ -150,7 +150,7 @@ void recorder<Base>::cond_exp(
             result.value_, CompareOp(arg0), arg2, arg3, arg4, arg5
         );
         result.ad_type_ = dynamic_enum;
-        result.tape_id_ = tape_id;
+        result.set_tape_id(tape_id);
 
         // check that result is a dynamic parameter
         CPPAD_ASSERT_UNKNOWN( Dynamic(result) );
@@ -166,7 +166,7 @@ void recorder<Base>::cond_exp(
         // make result a variable
         CPPAD_ASSERT_UNKNOWN( result.ad_type_ == constant_enum );
         result.ad_type_ = variable_enum;
-        result.tape_id_ = tape_id;
+        result.set_tape_id(tape_id);
 
         // check that result is a variable
         CPPAD_ASSERT_UNKNOWN( Variable(result) );
@@ -148,7 +148,7 @@ void recorder<Base>::put_dyn_atomic(
                 arg = put_dyn_par(ay[i].value_, result_dyn );  // result_dyn
             ay[i].ad_type_ = dynamic_enum;
             ay[i].taddr_   = arg;
-            ay[i].tape_id_ = tape_id;
+            ay[i].set_tape_id(tape_id);
             first_dynamic_result = false;
             break;
 
@@ -129,7 +129,7 @@ void recorder<Base>::put_var_atomic(
     for(size_t i = 0; i < m; i++)
     {   if( type_y[i] == variable_enum )
         {   ay[i].taddr_    = PutOp(local::FunrvOp);
-            ay[i].tape_id_  = tape_id;
+            ay[i].set_tape_id(tape_id);
             ay[i].ad_type_  = variable_enum;
         }
         else
@@ -261,6 +261,58 @@ public:
     const pod_vector_maybe<Base>& all_par_vec(void) const
     {   return all_par_vec_; }
 
+    /*!
+    Reserve memory for a recording.
+
+    \param num_op
+    number of operators expected in the recording.
+
+    \param num_op_arg
+    number of operator arguments expected in the recording.
+
+    \param num_par
+    number of parameters expected in the recording.
+    */
+    void reserve(size_t num_op, size_t num_op_arg, size_t num_par)
+    {   op_vec_.reserve(num_op);
+        arg_vec_.reserve(num_op_arg);
+        all_par_vec_.reserve(num_par);
+        dyn_par_is_.reserve(num_par);
+    }
+
+    /*!
+    Size of the previous recording for a thread.
+
+    \param thread
+    is the thread number; i.e.,
+    \code
+    (! thread_alloc::in_parallel()) || thread == thread_alloc::thread_num()
+    \endcode
+
+    \return
+    is a pointer to three values; i.e., the number of operators,
+    operator arguments, and parameters in the previous recording
+    for this thread that was transferred to an ADFun object
+    (zero if there was no such recording).
+    */
+    static size_t* previous_size(size_t thread)
+    {   CPPAD_ASSERT_FIRST_CALL_NOT_PARALLEL;
+        static size_t size_table[3 * CPPAD_MAX_NUM_THREADS];
+        CPPAD_ASSERT_UNKNOWN(
+            (! thread_alloc::in_parallel()) || thread == thread_alloc::thread_num()
+        );
+        return size_table + 3 * thread;
+    }
+
+    /// Store the size of this recording as the previous size for the
+    /// current thread.
+    void set_previous_size(void) const
+    {   size_t* size = previous_size( thread_alloc::thread_num() );
+        size[0] = op_vec_.size();
+        size[1] = arg_vec_.size();
+        size[2] = all_par_vec_.size();
+    }
+
     /// Approximate amount of memory used by the recording
     size_t Memory(void) const
     {   return op_vec_.capacity()        * sizeof(opcode_t)
@@ -87,12 +87,39 @@ void subgraph_info::get_rev(
     const pod_vector<size_t>&                  dep_taddr   ,
     addr_t                                     i_dep       ,
     pod_vector<addr_t>&                        subgraph    )
+{   get_rev(
+        random_itr, dep_taddr, i_dep, in_subgraph_, process_range_, subgraph
+    );
+}
+// ===========================================================================
+/*!
+Get the subgraph corresponding to a dependent variables
+using a separate copy of in_subgraph_ and process_range_.
+
+This is the same as the get_rev function above except that
+in_subgraph and process_range are used in place of
+the member variables in_subgraph_ and process_range_.
+Both must be copies of the member variables made after the
+previous init_rev (or the member variables themselves).
+Calls that use different copies do not modify this object and
+can be made at the same time by different threads.
+*/
+template <class Addr>
+void subgraph_info::get_rev(
+    const play::const_random_iterator<Addr>&   random_itr    ,
+    const pod_vector<size_t>&                  dep_taddr     ,
+    addr_t                                     i_dep         ,
+    pod_vector<addr_t>&                        in_subgraph   ,
+    pod_vector<bool>&                          process_range ,
+    pod_vector<addr_t>&                        subgraph      ) const
 {   // check sizes
     CPPAD_ASSERT_UNKNOWN( map_user_op_.size()   == n_op_ );
+    CPPAD_ASSERT_UNKNOWN( in_subgraph.size()    == n_op_ );
+    CPPAD_ASSERT_UNKNOWN( process_range.size()  == n_dep_ );
 
-    // process_range_
-    CPPAD_ASSERT_UNKNOWN( process_range_[i_dep] == false );
-    process_range_[i_dep] = true;
+    // process_range
+    CPPAD_ASSERT_UNKNOWN( process_range[i_dep] == false );
+    process_range[i_dep] = true;
 
     // special value; see init_rev_in_subgraph
     addr_t depend_yes = addr_t( n_dep_ );
@@ -112,10 +139,10 @@ void subgraph_info::get_rev(
 
     // if this variable depends on the selected indepent variables
     // process its subgraph
-    CPPAD_ASSERT_UNKNOWN( in_subgraph_[i_op] != i_dep )
-    if( in_subgraph_[i_op] <= depend_yes )
+    CPPAD_ASSERT_UNKNOWN( in_subgraph[i_op] != i_dep )
+    if( in_subgraph[i_op] <= depend_yes )
     {   subgraph.push_back( addr_t(i_op) );
-        in_subgraph_[i_op] = i_dep;
+        in_subgraph[i_op] = i_dep;
     }
 
     // space used to return set of arguments that are variables
@@ -129,7 +156,7 @@ void subgraph_info::get_rev(
     while(sub_index < subgraph.size() )
     {   // this operator connected to this dependent and selected independent
         i_op = size_t( subgraph[sub_index] );
-        CPPAD_ASSERT_UNKNOWN( in_subgraph_[i_op] == i_dep );
+        CPPAD_ASSERT_UNKNOWN( in_subgraph[i_op] == i_dep );
         //
         // There must be a result for this operator
 # ifndef NDEBUG
@@ -144,15 +171,15 @@ void subgraph_info::get_rev(
             size_t j_var = argument_variable[j];
             size_t j_op  = random_itr.var2op(j_var);
             j_op         = size_t( map_user_op_[j_op] );
-            bool add = in_subgraph_[j_op] <= depend_yes;
-            add     &= in_subgraph_[j_op] != i_dep;
+            bool add = in_subgraph[j_op] <= depend_yes;
+            add     &= in_subgraph[j_op] != i_dep;
             if( random_itr.get_op(j_op) == InvOp )
             {   CPPAD_ASSERT_UNKNOWN( j_op == j_var );
                 add &= select_domain_[j_var - 1];
             }
             if( add )
             {   subgraph.push_back( addr_t(j_op) );
-                in_subgraph_[j_op] = i_dep;
+                in_subgraph[j_op] = i_dep;
             }
         }
         // we are done scaning this subgraph operator
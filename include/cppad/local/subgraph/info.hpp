@@ -65,6 +65,10 @@ private:
     /// the previous init_rev
     pod_vector<bool> process_range_;
 
+    /// number of calls to init_rev (used to check if a copy of
+    /// in_subgraph_ and process_range_ corresponds to the previous init_rev)
+    size_t n_init_rev_;
+
 public:
     // -----------------------------------------------------------------------
     // const public functions
@@ -97,6 +101,14 @@ public:
     const pod_vector<bool>& process_range(void) const
     {   return process_range_; }
 
+    /// number of calls to init_rev
+    size_t n_init_rev(void) const
+    {   return n_init_rev_; }
+
+    /// value of in_subgraph (for copying to a separate workspace)
+    const pod_vector<addr_t>& in_subgraph(void) const
+    {   return in_subgraph_; }
+
     /// amount of memory corresonding to this object
     size_t memory(void) const
     {   size_t sum = map_user_op_.size()   * sizeof(addr_t);
@@ -157,10 +169,14 @@ public:
     pod_vector<addr_t>& in_subgraph(void)
     {   return in_subgraph_; }
 
+    /// flag which dependent variables have been processed
+    pod_vector<bool>& process_range(void)
+    {   return process_range_; }
+
 
     /// default constructor (all sizes are zero)
     subgraph_info(void)
-    : n_ind_(0), n_dep_(0), n_op_(0), n_var_(0)
+    : n_ind_(0), n_dep_(0), n_op_(0), n_var_(0), n_init_rev_(0)
     {   CPPAD_ASSERT_UNKNOWN( map_user_op_.size()   == 0 );
         CPPAD_ASSERT_UNKNOWN( in_subgraph_.size()   == 0 );
     }
@@ -175,6 +191,7 @@ public:
         in_subgraph_      = info.in_subgraph_;
         select_domain_    = info.select_domain_;
         process_range_    = info.process_range_;
+        n_init_rev_       = info.n_init_rev_;
         return;
     }
     // -----------------------------------------------------------------------
@@ -186,6 +203,7 @@ public:
         std::swap(n_dep_ , info.n_dep_);
         std::swap(n_op_  , info.n_op_);
         std::swap(n_var_ , info.n_var_);
+        std::swap(n_init_rev_ , info.n_init_rev_);
         //
         // pod_vectors
         map_user_op_.swap(   info.map_user_op_);
@@ -323,6 +341,15 @@ public:
         addr_t                                     i_dep        ,
         pod_vector<addr_t>&                        subgraph
     );
+    template <class Addr>
+    void get_rev(
+        const play::const_random_iterator<Addr>&   random_itr    ,
+        const pod_vector<size_t>&                  dep_taddr     ,
+        addr_t                                     i_dep         ,
+        pod_vector<addr_t>&                        in_subgraph   ,
+        pod_vector<bool>&                          process_range ,
+        pod_vector<addr_t>&                        subgraph
+    ) const;
 };
 
 } } } // END_CPPAD_LOCAL_SUBGRAPH_NAMESPACE
@@ -58,6 +58,9 @@ This vector is is set equal to the select_domain argument.
 
 \par process_range_
 This vector is to to size n_dep_ and its values are set to false
+
+\par n_init_rev_
+This counter is incremented by one.
 */
 template <class Addr, class BoolVector>
 void subgraph_info::init_rev(
@@ -83,6 +86,9 @@ void subgraph_info::init_rev(
     for(size_t i = 0; i < n_dep_; ++i)
         process_range_[i] = false;
 
+    // n_init_rev_
+    ++n_init_rev_;
+
     // set in_subgraph to have proper size
     in_subgraph_.resize(n_op_);
 
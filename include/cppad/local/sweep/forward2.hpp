@@ -14,6 +14,7 @@ in the Eclipse Public License, Version 2.0 are satisfied:
 
 # include <cppad/local/play/atom_op_info.hpp>
 # include <cppad/local/sweep/call_atomic.hpp>
+# include <cppad/utility/small_vector.hpp>
 
 // BEGIN_CPPAD_LOCAL_SWEEP_NAMESPACE
 namespace CppAD { namespace local { namespace sweep {
@@ -171,7 +172,7 @@ void forward2(
 
     // variable indices for results vector
     // (done differently for order zero).
-    vector<size_t> atom_iy;
+    small_vector<size_t, 8> atom_iy;
 
     // skip the BeginOp at the beginning of the recording
     play::const_sequential_iterator itr = play->begin();
@@ -14,6 +14,7 @@ in the Eclipse Public License, Version 2.0 are satisfied:
 
 
 # include <cppad/local/play/atom_op_info.hpp>
+# include <cppad/utility/small_vector.hpp>
 
 // BEGIN_CPPAD_LOCAL_SWEEP_NAMESPACE
 namespace CppAD { namespace local { namespace sweep {
@@ -40,6 +41,8 @@ and computations by this routine are done using type Base.
 \param d
 is the highest order Taylor coefficients that
 we are computing the derivative of.
+If d is zero, the reverse_*_op_0 version of an operator is used
+when it exists; these only use scalar partials.
 
 \param n
 is the number of independent variables on the tape.
@@ -200,7 +203,7 @@ void reverse(
     const size_t         atom_k1 = d+1; // number orders for this calculation
     vector<Base>         atom_par_x;    // argument parameter values
     vector<ad_type_enum> atom_type_x;   // argument type
-    vector<size_t>       atom_ix;       // variable indices for argument vector
+    small_vector<size_t, 8> atom_ix;    // variable indices for argument vector
     vector<Base>         atom_tx;       // argument vector Taylor coefficients
     vector<Base>         atom_ty;       // result vector Taylor coefficients
     vector<Base>         atom_px;       // partials w.r.t argument vector
@@ -212,7 +215,8 @@ void reverse(
 
     // A vector with unspecified contents declared here so that operator
     // routines do not need to re-allocate it
-    vector<Base> work;
+    // (no allocation when it has four or fewer elements)
+    small_vector<Base, 4> work;
 
     // temporary indices
     size_t j, ell;
@@ -307,7 +311,10 @@ void reverse(
             // --------------------------------------------------
 
             case AddvvOp:
-            reverse_addvv_op(
+            if( d == 0 ) reverse_addvv_op_0(
+                i_var, arg, parameter, J, Taylor, K, Partial
+            );
+            else reverse_addvv_op(
                 d, i_var, arg, parameter, J, Taylor, K, Partial
             );
             break;
@@ -315,7 +322,10 @@ void reverse(
 
             case AddpvOp:
             CPPAD_ASSERT_UNKNOWN( size_t(arg[0]) < num_par );
-            reverse_addpv_op(
+            if( d == 0 ) reverse_addpv_op_0(
+                i_var, arg, parameter, J, Taylor, K, Partial
+            );
+            else reverse_addpv_op(
                 d, i_var, arg, parameter, J, Taylor, K, Partial
             );
             break;
@@ -395,7 +405,10 @@ void reverse(
 
             case CosOp:
             CPPAD_ASSERT_UNKNOWN( i_var < numvar );
-            reverse_cos_op(
+            if( d == 0 ) reverse_cos_op_0(
+                i_var, size_t(arg[0]), J, Taylor, K, Partial
+            );
+            else reverse_cos_op(
                 d, i_var, size_t(arg[0]), J, Taylor, K, Partial
             );
             break;
@@ -416,7 +429,10 @@ void reverse(
             // --------------------------------------------------
 
             case DivvvOp:
-            reverse_divvv_op(
+            if( d == 0 ) reverse_divvv_op_0(
+                i_var, arg, parameter, J, Taylor, K, Partial
+            );
+            else reverse_divvv_op(
                 d, i_var, arg, parameter, J, Taylor, K, Partial
             );
             break;
@@ -424,7 +440,10 @@ void reverse(
 
             case DivpvOp:
             CPPAD_ASSERT_UNKNOWN( size_t(arg[0]) < num_par );
-            reverse_divpv_op(
+            if( d == 0 ) reverse_divpv_op_0(
+                i_var, arg, parameter, J, Taylor, K, Partial
+            );
+            else reverse_divpv_op(
                 d, i_var, arg, parameter, J, Taylor, K, Partial
             );
             break;
@@ -432,7 +451,10 @@ void reverse(
 
             case DivvpOp:
             CPPAD_ASSERT_UNKNOWN( size_t(arg[1]) < num_par );
-            reverse_divvp_op(
+            if( d == 0 ) reverse_divvp_op_0(
+                i_var, arg, parameter, J, Taylor, K, Partial
+            );
+            else reverse_divvp_op(
                 d, i_var, arg, parameter, J, Taylor, K, Partial
             );
             break;
@@ -454,7 +476,10 @@ void reverse(
             // --------------------------------------------------
 
             case ExpOp:
-            reverse_exp_op(
+            if( d == 0 ) reverse_exp_op_0(
+                i_var, size_t(arg[0]), J, Taylor, K, Partial
+            );
+            else reverse_exp_op(
                 d, i_var, size_t(arg[0]), J, Taylor, K, Partial
             );
             break;
@@ -503,7 +528,10 @@ void reverse(
             // -------------------------------------------------
 
             case LogOp:
-            reverse_log_op(
+            if( d == 0 ) reverse_log_op_0(
+                i_var, size_t(arg[0]), J, Taylor, K, Partial
+            );
+            else reverse_log_op(
                 d, i_var, size_t(arg[0]), J, Taylor, K, Partial
             );
             break;
@@ -518,21 +546,30 @@ void reverse(
 
             case MulpvOp:
             CPPAD_ASSERT_UNKNOWN( size_t(arg[0]) < num_par );
-            reverse_mulpv_op(
+            if( d == 0 ) reverse_mulpv_op_0(
+                i_var, arg, parameter, J, Taylor, K, Partial
+            );
+            else reverse_mulpv_op(
                 d, i_var, arg, parameter, J, Taylor, K, Partial
             );
             break;
             // --------------------------------------------------
 
             case MulvvOp:
-            reverse_mulvv_op(
+            if( d == 0 ) reverse_mulvv_op_0(
+                i_var, arg, parameter, J, Taylor, K, Partial
+            );
+            else reverse_mulvv_op(
                 d, i_var, arg, parameter, J, Taylor, K, Partial
             );
             break;
             // -------------------------------------------------
 
             case NegOp:
-            reverse_neg_op(
+            if( d == 0 ) reverse_neg_op_0(
+                i_var, size_t(arg[0]), J, Taylor, K, Partial
+            );
+            else reverse_neg_op(
                 d, i_var, size_t(arg[0]), J, Taylor, K, Partial
             );
             break;
@@ -580,7 +617,10 @@ void reverse(
 
             case SinOp:
             CPPAD_ASSERT_UNKNOWN( i_var < numvar );
-            reverse_sin_op(
+            if( d == 0 ) reverse_sin_op_0(
+                i_var, size_t(arg[0]), J, Taylor, K, Partial
+            );
+            else reverse_sin_op(
                 d, i_var, size_t(arg[0]), J, Taylor, K, Partial
             );
             break;
@@ -595,7 +635,10 @@ void reverse(
             // --------------------------------------------------
 
             case SqrtOp:
-            reverse_sqrt_op(
+            if( d == 0 ) reverse_sqrt_op_0(
+                i_var, size_t(arg[0]), J, Taylor, K, Partial
+            );
+            else reverse_sqrt_op(
                 d, i_var, size_t(arg[0]), J, Taylor, K, Partial
             );
             break;
@@ -618,7 +661,10 @@ void reverse(
             // --------------------------------------------------
 
             case SubvvOp:
-            reverse_subvv_op(
+            if( d == 0 ) reverse_subvv_op_0(
+                i_var, arg, parameter, J, Taylor, K, Partial
+            );
+            else reverse_subvv_op(
                 d, i_var, arg, parameter, J, Taylor, K, Partial
             );
             break;
@@ -626,7 +672,10 @@ void reverse(
 
             case SubpvOp:
             CPPAD_ASSERT_UNKNOWN( size_t(arg[0]) < num_par );
-            reverse_subpv_op(
+            if( d == 0 ) reverse_subpv_op_0(
+                i_var, arg, parameter, J, Taylor, K, Partial
+            );
+            else reverse_subpv_op(
                 d, i_var, arg, parameter, J, Taylor, K, Partial
             );
             break;
@@ -634,7 +683,10 @@ void reverse(
 
             case SubvpOp:
             CPPAD_ASSERT_UNKNOWN( size_t(arg[1]) < num_par );
-            reverse_subvp_op(
+            if( d == 0 ) reverse_subvp_op_0(
+                i_var, arg, parameter, J, Taylor, K, Partial
+            );
+            else reverse_subvp_op(
                 d, i_var, arg, parameter, J, Taylor, K, Partial
             );
             break;
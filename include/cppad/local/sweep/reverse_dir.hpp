@@ -0,0 +1,737 @@
+# ifndef CPPAD_LOCAL_SWEEP_REVERSE_DIR_HPP
+# define CPPAD_LOCAL_SWEEP_REVERSE_DIR_HPP
+/* --------------------------------------------------------------------------
+CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-21 Bradley M. Bell
+
+CppAD is distributed under the terms of the
+             Eclipse Public License Version 2.0.
+
+This Source Code may also be made available under the following
+Secondary License when the conditions for such availability set forth
+in the Eclipse Public License, Version 2.0 are satisfied:
+      GNU General Public License, Version 2.0 or later.
+---------------------------------------------------------------------------- */
+
+
+# include <cppad/local/play/atom_op_info.hpp>
+# include <cppad/utility/small_vector.hpp>
+
+// BEGIN_CPPAD_LOCAL_SWEEP_NAMESPACE
+namespace CppAD { namespace local { namespace sweep {
+/*!
+\file sweep/reverse_dir.hpp
+Compute first order derivatives for multiple weight vectors in one sweep.
+*/
+
+/*!
+Compute the derivative of zero order forward mode results
+for multiple weight vectors.
+
+\tparam Base
+this operation sequence was recorded using AD<Base>
+and computations by this routine are done using type Base.
+
+\param n
+is the number of independent variables on the tape.
+
+\param numvar
+is the total number of variables on the tape.
+This is also equal to the number of rows in the matrix Taylor; i.e.,
+play->num_var_rec().
+
+\param play
+The information stored in play
+is a recording of the operations corresponding to the function
+\f[
+    F : {\bf R}^n \rightarrow {\bf R}^m
+\f]
+
+\param J
+Is the number of columns in the coefficient matrix Taylor.
+This must be greater than or equal one.
+
+\param Taylor
+For i = 1 , ... , numvar,
+ Taylor [ i * J + 0 ]
+is the zero order Taylor coefficient corresponding to
+variable with index i on the tape.
+
+\param r
+is the number of weight vectors (directions) being differentiated.
+
+\param Partial
+\b Input:
+For each dependent variable index i and for ell = 0 , ... , r-1,
+<code>Partial [ i * r + ell ]</code>
+is the weight for the corresponding dependent variable in direction ell.
+All the other elements of Partial are zero.
+\n
+\n
+\b Temporary:
+For i = n+1 , ... , numvar - 1 and for ell = 0 , ... , r-1,
+the value of Partial [ i * r + ell ] is used for temporary work space
+and its output value is not defined.
+\n
+\n
+\b Output:
+For j = 1 , ... , n and for ell = 0 , ... , r-1,
+ Partial [ j * r + ell ]
+is the partial derivative of the sum over the dependent variables
+of the weights in direction ell times the dependent variables
+with respect to the j-th independent variable.
+
+\param cskip_op
+Is a vector with size play->num_op_rec().
+If cskip_op[i] is true, the operator index i in the recording
+does not affect any of the dependent variable (given the value
+of the independent variables).
+
+\param load_op2var
+is a vector with size play->num_var_load_rec().
+It contains the variable index corresponding to each load instruction.
+In the case where the index is zero,
+the instruction corresponds to a parameter (not variable).
+
+\param not_used_rec_base
+Specifies RecBase for this call.
+
+\par Method
+For each operator, the first order reverse mode routine for that operator
+(the same routine used by sweep::reverse) is evaluated once with a unit
+weight for its result. This gives the partial of the result with
+respect to each of its variable arguments.
+These partials are then combined with the r weights for the result;
+i.e., the dispatch and the evaluation of the partials for each operator
+is done once for all r directions.
+*/
+template <class Addr, class Base, class RecBase>
+void reverse_dir(
+    size_t                      n,
+    size_t                      numvar,
+    const local::player<Base>*  play,
+    size_t                      J,
+    const Base*                 Taylor,
+    size_t                      r,
+    Base*                       Partial,
+    bool*                       cskip_op,
+    const pod_vector<Addr>&     load_op2var,
+    const RecBase&              not_used_rec_base
+)
+{
+    // check numvar argument
+    CPPAD_ASSERT_UNKNOWN( play->num_var_rec() == numvar );
+    CPPAD_ASSERT_UNKNOWN( numvar > 0 );
+    CPPAD_ASSERT_UNKNOWN( r > 0 );
+
+    // length of the parameter vector (used by CppAD assert macros)
+    const size_t num_par = play->num_par_rec();
+
+    // pointer to the beginning of the parameter vector
+    CPPAD_ASSERT_UNKNOWN( num_par > 0 )
+    const Base* parameter = play->GetPar();
+
+    // order and number of orders for zero order reverse mode
+    const size_t d  = 0;
+    const size_t K  = 1;
+
+    // partials of each result with respect to its arguments
+    // (all elements are zero between operators)
+    pod_vector_maybe<Base> scratch_vec(numvar);
+    for(size_t i = 0; i < numvar; ++i)
+        scratch_vec[i] = Base(0.0);
+    Base* scratch = scratch_vec.data();
+
+    // which arguments are variables
+    pod_vector<bool> is_variable;
+
+    // work space used by AFunOp.
+    vector<Base>         atom_par_x;    // argument parameter values
+    vector<ad_type_enum> atom_type_x;   // argument type
+    small_vector<size_t, 8> atom_ix;    // variable indices for argument vector
+    small_vector<size_t, 8> atom_iy;    // variable indices for result vector
+    vector<Base>         atom_tx;       // argument vector Taylor coefficients
+    vector<Base>         atom_ty;       // result vector Taylor coefficients
+    vector<Base>         atom_px;       // partials w.r.t argument vector
+    vector<Base>         atom_py;       // partials w.r.t. result vector
+    //
+    // information defined by atomic forward
+    size_t atom_index=0, atom_old=0, atom_m=0, atom_n=0, atom_i=0, atom_j=0;
+    enum_atom_state atom_state = end_atom; // proper initialization
+
+    // A vector with unspecified contents declared here so that operator
+    // routines do not need to re-allocate it
+    // (no allocation when it has four or fewer elements)
+    small_vector<Base, 4> work;
+
+    OpCode        op;
+    const Addr*   arg;
+    size_t        i_var;
+    play::const_sequential_iterator play_itr = play->end();
+    play_itr.op_info(op, arg, i_var);
+    CPPAD_ASSERT_UNKNOWN( op == EndOp );
+    while(op != BeginOp )
+    {   bool flag; // temporary for use in switch cases
+        //
+        // next op
+        (--play_itr).op_info(op, arg, i_var);
+
+        // check if we are skipping this operation
+        size_t i_op = play_itr.op_index();
+        while( cskip_op[i_op] )
+        {   if( op == AFunOp )
+            {   // get information for this atomic function call
+                CPPAD_ASSERT_UNKNOWN( atom_state == end_atom );
+                play::atom_op_info<Base>(
+                    op, arg, atom_index, atom_old, atom_m, atom_n
+                );
+                //
+                // skip to the first AFunOp
+                for(size_t i = 0; i < atom_m + atom_n + 1; ++i)
+                    --play_itr;
+                play_itr.op_info(op, arg, i_var);
+                CPPAD_ASSERT_UNKNOWN( op == AFunOp );
+            }
+            (--play_itr).op_info(op, arg, i_var);
+            i_op = play_itr.op_index();
+        }
+        //
+        // partials for the result of this operator
+        Base* pz = Partial + i_var * r;
+        //
+        // true if the first order reverse routine for this operator
+        // is used to compute the partials of its result
+        bool use_scratch = NumRes(op) > 0;
+        if( use_scratch )
+        {   flag = false;
+            for(size_t ell = 0; ell < r; ++ell)
+                flag |= ! IdenticalZero( pz[ell] );
+            if( flag )
+                scratch[i_var] = Base(1.0);
+        }
+        else
+            flag = false;
+        //
+        switch( op )
+        {
+            case AbsOp:
+            if( flag ) reverse_abs_op(
+                d, i_var, size_t(arg[0]), J, Taylor, K, scratch
+            );
+            break;
+            // --------------------------------------------------
+
+            case AcosOp:
+            if( flag ) reverse_acos_op(
+                d, i_var, size_t(arg[0]), J, Taylor, K, scratch
+            );
+            break;
+            // --------------------------------------------------
+
+            case AcoshOp:
+            if( flag ) reverse_acosh_op(
+                d, i_var, size_t(arg[0]), J, Taylor, K, scratch
+            );
+            break;
+            // --------------------------------------------------
+
+            case AddvvOp:
+            if( flag ) reverse_addvv_op(
+                d, i_var, arg, parameter, J, Taylor, K, scratch
+            );
+            break;
+            // --------------------------------------------------
+
+            case AddpvOp:
+            if( flag ) reverse_addpv_op(
+                d, i_var, arg, parameter, J, Taylor, K, scratch
+            );
+            break;
+            // --------------------------------------------------
+
+            case AsinOp:
+            if( flag ) reverse_asin_op(
+                d, i_var, size_t(arg[0]), J, Taylor, K, scratch
+            );
+            break;
+            // --------------------------------------------------
+
+            case AsinhOp:
+            if( flag ) reverse_asinh_op(
+                d, i_var, size_t(arg[0]), J, Taylor, K, scratch
+            );
+            break;
+            // --------------------------------------------------
+
+            case AtanOp:
+            if( flag ) reverse_atan_op(
+                d, i_var, size_t(arg[0]), J, Taylor, K, scratch
+            );
+            break;
+            // -------------------------------------------------
+
+            case AtanhOp:
+            if( flag ) reverse_atanh_op(
+                d, i_var, size_t(arg[0]), J, Taylor, K, scratch
+            );
+            break;
+            // -------------------------------------------------
+
+            case BeginOp:
+            CPPAD_ASSERT_NARG_NRES(op, 1, 1);
+            CPPAD_ASSERT_UNKNOWN( i_op == 0 );
+            use_scratch = false;
+            break;
+            // --------------------------------------------------
+
+            case CSkipOp:
+            // CSkipOp has a zero order forward action.
+            play_itr.correct_after_decrement(arg);
+            break;
+            // -------------------------------------------------
+
+            case CSumOp:
+            // the partials are plus and minus one so scratch is not used
+            play_itr.correct_after_decrement(arg);
+            use_scratch = false;
+            scratch[i_var] = Base(0.0);
+            if( flag )
+            {   for(size_t i = 5; i < size_t(arg[1]); ++i)
+                {   Base* px = Partial + size_t(arg[i]) * r;
+                    for(size_t ell = 0; ell < r; ++ell)
+                        px[ell] += pz[ell];
+                }
+                for(size_t i = size_t(arg[1]); i < size_t(arg[2]); ++i)
+                {   Base* px = Partial + size_t(arg[i]) * r;
+                    for(size_t ell = 0; ell < r; ++ell)
+                        px[ell] -= pz[ell];
+                }
+            }
+            break;
+            // -------------------------------------------------
+
+            case CExpOp:
+            if( flag ) reverse_cond_op(
+                d, i_var, arg, num_par, parameter, J, Taylor, K, scratch
+            );
+            break;
+            // --------------------------------------------------
+
+            case CosOp:
+            if( flag ) reverse_cos_op(
+                d, i_var, size_t(arg[0]), J, Taylor, K, scratch
+            );
+            break;
+            // --------------------------------------------------
+
+            case CoshOp:
+            if( flag ) reverse_cosh_op(
+                d, i_var, size_t(arg[0]), J, Taylor, K, scratch
+            );
+            break;
+            // --------------------------------------------------
+
+            case DisOp:
+            // Derivative of discrete operation is zero so no
+            // contribution passes through this operation.
+            use_scratch    = false;
+            scratch[i_var] = Base(0.0);
+            break;
+            // --------------------------------------------------
+
+            case DivvvOp:
+            if( flag ) reverse_divvv_op(
+                d, i_var, arg, parameter, J, Taylor, K, scratch
+            );
+            break;
+            // --------------------------------------------------
+
+            case DivpvOp:
+            if( flag ) reverse_divpv_op(
+                d, i_var, arg, parameter, J, Taylor, K, scratch
+            );
+            break;
+            // --------------------------------------------------
+
+            case DivvpOp:
+            if( flag ) reverse_divvp_op(
+                d, i_var, arg, parameter, J, Taylor, K, scratch
+            );
+            break;
+            // --------------------------------------------------
+
+            case EndOp:
+            CPPAD_ASSERT_UNKNOWN(
+                i_op == play->num_op_rec() - 1
+            );
+            break;
+            // --------------------------------------------------
+
+            case ErfOp:
+            case ErfcOp:
+            if( flag ) reverse_erf_op(
+                op, d, i_var, arg, parameter, J, Taylor, K, scratch
+            );
+            break;
+            // --------------------------------------------------
+
+            case ExpOp:
+            if( flag ) reverse_exp_op(
+                d, i_var, size_t(arg[0]), J, Taylor, K, scratch
+            );
+            break;
+            // --------------------------------------------------
+
+            case Expm1Op:
+            if( flag ) reverse_expm1_op(
+                d, i_var, size_t(arg[0]), J, Taylor, K, scratch
+            );
+            break;
+            // --------------------------------------------------
+
+            case InvOp:
+            case ParOp:
+            use_scratch    = false;
+            scratch[i_var] = Base(0.0);
+            break;
+            // --------------------------------------------------
+
+            case LdpOp:
+            case LdvOp:
+            // the partial is one w.r.t. the variable that was loaded
+            use_scratch    = false;
+            scratch[i_var] = Base(0.0);
+            if( flag )
+            {   size_t i_load = size_t( load_op2var[ arg[2] ] );
+                CPPAD_ASSERT_UNKNOWN( i_load < i_var );
+                if( i_load > 0 )
+                {   Base* px = Partial + i_load * r;
+                    for(size_t ell = 0; ell < r; ++ell)
+                        px[ell] += pz[ell];
+                }
+            }
+            break;
+            // --------------------------------------------------
+
+            case EqppOp:
+            case EqpvOp:
+            case EqvvOp:
+            case LtppOp:
+            case LtpvOp:
+            case LtvpOp:
+            case LtvvOp:
+            case LeppOp:
+            case LepvOp:
+            case LevpOp:
+            case LevvOp:
+            case NeppOp:
+            case NepvOp:
+            case NevvOp:
+            break;
+            // -------------------------------------------------
+
+            case LogOp:
+            if( flag ) reverse_log_op(
+                d, i_var, size_t(arg[0]), J, Taylor, K, scratch
+            );
+            break;
+            // --------------------------------------------------
+
+            case Log1pOp:
+            if( flag ) reverse_log1p_op(
+                d, i_var, size_t(arg[0]), J, Taylor, K, scratch
+            );
+            break;
+            // --------------------------------------------------
+
+            case MulpvOp:
+            if( flag ) reverse_mulpv_op(
+                d, i_var, arg, parameter, J, Taylor, K, scratch
+            );
+            break;
+            // --------------------------------------------------
+
+            case MulvvOp:
+            if( flag ) reverse_mulvv_op(
+                d, i_var, arg, parameter, J, Taylor, K, scratch
+            );
+            break;
+            // -------------------------------------------------
+
+            case NegOp:
+            if( flag ) reverse_neg_op(
+                d, i_var, size_t(arg[0]), J, Taylor, K, scratch
+            );
+            break;
+            // --------------------------------------------------
+
+            case PowvpOp:
+            if( flag ) reverse_powvp_op(
+                d, i_var, arg, parameter, J, Taylor, K, scratch, work
+            );
+            break;
+            // -------------------------------------------------
+
+            case PowpvOp:
+            if( flag ) reverse_powpv_op(
+                d, i_var, arg, parameter, J, Taylor, K, scratch
+            );
+            break;
+            // -------------------------------------------------
+
+            case PowvvOp:
+            if( flag ) reverse_powvv_op(
+                d, i_var, arg, parameter, J, Taylor, K, scratch
+            );
+            break;
+            // --------------------------------------------------
+
+            case PriOp:
+            // no result so nothing to do
+            break;
+            // --------------------------------------------------
+
+            case SignOp:
+            if( flag ) reverse_sign_op(
+                d, i_var, size_t(arg[0]), J, Taylor, K, scratch
+            );
+            break;
+            // -------------------------------------------------
+
+            case SinOp:
+            if( flag ) reverse_sin_op(
+                d, i_var, size_t(arg[0]), J, Taylor, K, scratch
+            );
+            break;
+            // -------------------------------------------------
+
+            case SinhOp:
+            if( flag ) reverse_sinh_op(
+                d, i_var, size_t(arg[0]), J, Taylor, K, scratch
+            );
+            break;
+            // --------------------------------------------------
+
+            case SqrtOp:
+            if( flag ) reverse_sqrt_op(
+                d, i_var, size_t(arg[0]), J, Taylor, K, scratch
+            );
+            break;
+            // --------------------------------------------------
+
+            case StppOp:
+            case StpvOp:
+            case StvpOp:
+            case StvvOp:
+            break;
+            // --------------------------------------------------
+
+            case SubvvOp:
+            if( flag ) reverse_subvv_op(
+                d, i_var, arg, parameter, J, Taylor, K, scratch
+            );
+            break;
+            // --------------------------------------------------
+
+            case SubpvOp:
+            if( flag ) reverse_subpv_op(
+                d, i_var, arg, parameter, J, Taylor, K, scratch
+            );
+            break;
+            // --------------------------------------------------
+
+            case SubvpOp:
+            if( flag ) reverse_subvp_op(
+                d, i_var, arg, parameter, J, Taylor, K, scratch
+            );
+            break;
+            // -------------------------------------------------
+
+            case TanOp:
+            if( flag ) reverse_tan_op(
+                d, i_var, size_t(arg[0]), J, Taylor, K, scratch
+            );
+            break;
+            // -------------------------------------------------
+
+            case TanhOp:
+            if( flag ) reverse_tanh_op(
+                d, i_var, size_t(arg[0]), J, Taylor, K, scratch
+            );
+            break;
+            // --------------------------------------------------
+
+            case AFunOp:
+            // start or end an atomic function call
+            flag = atom_state == end_atom;
+            play::atom_op_info<RecBase>(
+                op, arg, atom_index, atom_old, atom_m, atom_n
+            );
+            if( flag )
+            {   atom_state = ret_atom;
+                atom_i     = atom_m;
+                atom_j     = atom_n;
+                //
+                atom_ix.resize(atom_n);
+                atom_iy.resize(atom_m);
+                atom_par_x.resize(atom_n);
+                atom_type_x.resize(atom_n);
+                atom_tx.resize(atom_n);
+                atom_px.resize(atom_n);
+                atom_ty.resize(atom_m);
+                atom_py.resize(atom_m);
+            }
+            else
+            {   CPPAD_ASSERT_UNKNOWN( atom_i == 0 );
+                CPPAD_ASSERT_UNKNOWN( atom_j == 0  );
+                atom_state = end_atom;
+                //
+                // call atomic function once for each direction
+                for(size_t ell = 0; ell < r; ++ell)
+                {   flag = false;
+                    for(size_t i = 0; i < atom_m; ++i)
+                    {   if( atom_iy[i] > 0 )
+                            atom_py[i] = Partial[atom_iy[i] * r + ell];
+                        else
+                            atom_py[i] = Base(0.0);
+                        flag |= ! IdenticalZero( atom_py[i] );
+                    }
+                    if( flag )
+                    {   call_atomic_reverse<Base, RecBase>(
+                            atom_par_x,
+                            atom_type_x,
+                            d,
+                            atom_index,
+                            atom_old,
+                            atom_tx,
+                            atom_ty,
+                            atom_px,
+                            atom_py
+                        );
+                        for(size_t j = 0; j < atom_n; ++j)
+                            if( atom_ix[j] > 0 )
+                                Partial[atom_ix[j] * r + ell] += atom_px[j];
+                    }
+                }
+            }
+            break;
+
+            case FunapOp:
+            // parameter argument in an atomic operation sequence
+            CPPAD_ASSERT_UNKNOWN( NumArg(op) == 1 );
+            CPPAD_ASSERT_UNKNOWN( atom_state == arg_atom );
+            CPPAD_ASSERT_UNKNOWN( atom_i == 0 );
+            CPPAD_ASSERT_UNKNOWN( atom_j <= atom_n );
+            CPPAD_ASSERT_UNKNOWN( size_t( arg[0] ) < num_par );
+            //
+            --atom_j;
+            atom_ix[atom_j]               = 0;
+            if( play->dyn_par_is()[ arg[0] ] )
+                atom_type_x[atom_j]       = dynamic_enum;
+            else
+                atom_type_x[atom_j]       = constant_enum;
+            atom_par_x[atom_j]            = parameter[ arg[0] ];
+            atom_tx[atom_j]               = parameter[ arg[0] ];
+            //
+            if( atom_j == 0 )
+                atom_state = start_atom;
+            break;
+
+            case FunavOp:
+            // variable argument in an atomic operation sequence
+            CPPAD_ASSERT_UNKNOWN( NumArg(op) == 1 );
+            CPPAD_ASSERT_UNKNOWN( atom_state == arg_atom );
+            CPPAD_ASSERT_UNKNOWN( atom_i == 0 );
+            CPPAD_ASSERT_UNKNOWN( atom_j <= atom_n );
+            //
+            --atom_j;
+            atom_ix[atom_j]     = size_t( arg[0] );
+            atom_type_x[atom_j] = variable_enum;
+            atom_par_x[atom_j] = CppAD::numeric_limits<Base>::quiet_NaN();
+            atom_tx[atom_j]     = Taylor[ size_t(arg[0]) * J ];
+            //
+            if( atom_j == 0 )
+                atom_state = start_atom;
+            break;
+
+            case FunrpOp:
+            // parameter result for a atomic function
+            CPPAD_ASSERT_NARG_NRES(op, 1, 0);
+            CPPAD_ASSERT_UNKNOWN( atom_state == ret_atom );
+            CPPAD_ASSERT_UNKNOWN( atom_i <= atom_m );
+            CPPAD_ASSERT_UNKNOWN( atom_j == atom_n );
+            CPPAD_ASSERT_UNKNOWN( size_t( arg[0] ) < num_par );
+            //
+            --atom_i;
+            atom_iy[atom_i] = 0;
+            atom_ty[atom_i] = parameter[ arg[0] ];
+            //
+            if( atom_i == 0 )
+                atom_state = arg_atom;
+            break;
+
+            case FunrvOp:
+            // variable result for a atomic function
+            CPPAD_ASSERT_NARG_NRES(op, 0, 1);
+            CPPAD_ASSERT_UNKNOWN( atom_state == ret_atom );
+            CPPAD_ASSERT_UNKNOWN( atom_i <= atom_m );
+            CPPAD_ASSERT_UNKNOWN( atom_j == atom_n );
+            //
+            use_scratch     = false;
+            scratch[i_var]  = Base(0.0);
+            --atom_i;
+            atom_iy[atom_i] = i_var;
+            atom_ty[atom_i] = Taylor[i_var * J];
+            if( atom_i == 0 )
+                atom_state = arg_atom;
+            break;
+            // ------------------------------------------------------------
+
+            case ZmulpvOp:
+            if( flag ) reverse_zmulpv_op(
+                d, i_var, arg, parameter, J, Taylor, K, scratch
+            );
+            break;
+            // --------------------------------------------------
+
+            case ZmulvpOp:
+            if( flag ) reverse_zmulvp_op(
+                d, i_var, arg, parameter, J, Taylor, K, scratch
+            );
+            break;
+            // --------------------------------------------------
+
+            case ZmulvvOp:
+            if( flag ) reverse_zmulvv_op(
+                d, i_var, arg, parameter, J, Taylor, K, scratch
+            );
+            break;
+            // --------------------------------------------------
+
+            default:
+            CPPAD_ASSERT_UNKNOWN(false);
+        }
+        if( use_scratch && flag )
+        {   // propagate all the directions using the partials in scratch
+            arg_is_variable(op, arg, is_variable);
+            for(size_t j = 0; j < is_variable.size(); ++j) if( is_variable[j] )
+            {   size_t i_x = size_t( arg[j] );
+                CPPAD_ASSERT_UNKNOWN( i_x < i_var );
+                Base c      = scratch[i_x];
+                scratch[i_x] = Base(0.0);
+                if( ! IdenticalZero(c) )
+                {   Base* px = Partial + i_x * r;
+                    for(size_t ell = 0; ell < r; ++ell)
+                        px[ell] += azmul(pz[ell], c);
+                }
+            }
+            // results of this operator
+            for(size_t k = 0; k < NumRes(op); ++k)
+                scratch[i_var - k] = Base(0.0);
+        }
+    }
+    CPPAD_ASSERT_UNKNOWN( atom_state == end_atom );
+}
+
+} } } // END_CPPAD_LOCAL_SWEEP_NAMESPACE
+
+# endif
@@ -0,0 +1,765 @@
+# ifndef CPPAD_LOCAL_SWEEP_REVERSE_HES_DIR_HPP
+# define CPPAD_LOCAL_SWEEP_REVERSE_HES_DIR_HPP
+/* --------------------------------------------------------------------------
+CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-21 Bradley M. Bell
+
+CppAD is distributed under the terms of the
+             Eclipse Public License Version 2.0.
+
+This Source Code may also be made available under the following
+Secondary License when the conditions for such availability set forth
+in the Eclipse Public License, Version 2.0 are satisfied:
+      GNU General Public License, Version 2.0 or later.
+---------------------------------------------------------------------------- */
+
+
+# include <cppad/local/play/atom_op_info.hpp>
+# include <cppad/utility/small_vector.hpp>
+
+// BEGIN_CPPAD_LOCAL_SWEEP_NAMESPACE
+namespace CppAD { namespace local { namespace sweep {
+/*!
+\file sweep/reverse_hes_dir.hpp
+Compute second order derivatives for multiple directions in one sweep.
+*/
+
+/*!
+Compute the derivative of first order forward mode results
+for multiple directions.
+
+\tparam Base
+this operation sequence was recorded using AD<Base>
+and computations by this routine are done using type Base.
+
+\param n
+is the number of independent variables on the tape.
+
+\param numvar
+is the total number of variables on the tape.
+This is also equal to the number of rows in the matrix taylor; i.e.,
+play->num_var_rec().
+
+\param play
+The information stored in play
+is a recording of the operations corresponding to the function
+\f[
+    F : {\bf R}^n \rightarrow {\bf R}^m
+\f]
+
+\param r
+is the number of directions.
+
+\param taylor
+For i = 1 , ... , numvar, ell = 0 , ... , r-1, and k = 0 , 1,
+<code>taylor [ i * 2 * r + 2 * ell + k ]</code>
+is the k-th order Taylor coefficient corresponding to
+variable with index i on the tape and direction ell.
+Note that the zero order coefficients are the same for all directions.
+
+\param partial
+\b Input:
+For each dependent variable index i and for ell = 0 , ... , r-1,
+<code>partial [ i * 2 * r + 2 * ell + 1 ]</code>
+is the weight for the corresponding dependent variable.
+All the other elements of partial are zero.
+\n
+\n
+\b Temporary:
+For i = n+1 , ... , numvar - 1,
+the value of partial [ i * 2 * r + 2 * ell + k ] is used for temporary
+work space and its output value is not defined.
+\n
+\n
+\b Output:
+For j = 1 , ... , n, ell = 0 , ... , r-1, and k = 0 , 1,
+<code>partial [ j * 2 * r + 2 * ell + k ]</code>
+is the partial derivative of the weighted sum of the first order
+Taylor coefficients of the dependent variables in direction ell,
+with respect to the k-th order Taylor coefficient for the
+j-th independent variable in direction ell.
+In other words, for k = 0, it is the Hessian of the weighted sum
+times the direction ell.
+
+\param cskip_op
+Is a vector with size play->num_op_rec().
+If cskip_op[i] is true, the operator index i in the recording
+does not affect any of the dependent variable (given the value
+of the independent variables).
+
+\param load_op2var
+is a vector with size play->num_var_load_rec().
+It contains the variable index corresponding to each load instruction.
+In the case where the index is zero,
+the instruction corresponds to a parameter (not variable).
+
+\param not_used_rec_base
+Specifies RecBase for this call.
+
+\par Method
+The Taylor coefficients and partials for direction ell, at stride 2 * r,
+have the same layout as is used by sweep::reverse with d equal to one.
+For each operator, the second order reverse mode routine for that operator
+(the same routine used by sweep::reverse) is evaluated once for each
+direction; i.e., the operation sequence is only played back once
+for all r directions.
+*/
+template <class Addr, class Base, class RecBase>
+void reverse_hes_dir(
+    size_t                      n,
+    size_t                      numvar,
+    const local::player<Base>*  play,
+    size_t                      r,
+    const Base*                 taylor,
+    Base*                       partial,
+    bool*                       cskip_op,
+    const pod_vector<Addr>&     load_op2var,
+    const RecBase&              not_used_rec_base
+)
+{
+    // check numvar argument
+    CPPAD_ASSERT_UNKNOWN( play->num_var_rec() == numvar );
+    CPPAD_ASSERT_UNKNOWN( numvar > 0 );
+    CPPAD_ASSERT_UNKNOWN( r > 0 );
+
+    // length of the parameter vector (used by CppAD assert macros)
+    const size_t num_par = play->num_par_rec();
+
+    // pointer to the beginning of the parameter vector
+    CPPAD_ASSERT_UNKNOWN( num_par > 0 )
+    const Base* parameter = play->GetPar();
+
+    // highest order we are differentiating
+    const size_t d = 1;
+
+    // number of columns in taylor and partial matrices
+    const size_t J = 2 * r;
+    const size_t K = 2 * r;
+
+    // work space used by AFunOp.
+    vector<Base>         atom_par_x;    // argument parameter values
+    vector<ad_type_enum> atom_type_x;   // argument type
+    small_vector<size_t, 8> atom_ix;    // variable indices for argument vector
+    small_vector<size_t, 8> atom_iy;    // variable indices for result vector
+    vector<Base>         atom_tx;       // argument vector Taylor coefficients
+    vector<Base>         atom_ty;       // result vector Taylor coefficients
+    vector<Base>         atom_px;       // partials w.r.t argument vector
+    vector<Base>         atom_py;       // partials w.r.t. result vector
+    //
+    // information defined by atomic forward
+    size_t atom_index=0, atom_old=0, atom_m=0, atom_n=0, atom_i=0, atom_j=0;
+    enum_atom_state atom_state = end_atom; // proper initialization
+
+    // A vector with unspecified contents declared here so that operator
+    // routines do not need to re-allocate it
+    // (no allocation when it has four or fewer elements)
+    small_vector<Base, 4> work;
+
+    OpCode        op;
+    const Addr*   arg;
+    size_t        i_var;
+    play::const_sequential_iterator play_itr = play->end();
+    play_itr.op_info(op, arg, i_var);
+    CPPAD_ASSERT_UNKNOWN( op == EndOp );
+    while(op != BeginOp )
+    {   bool flag; // temporary for use in switch cases
+        //
+        // next op
+        (--play_itr).op_info(op, arg, i_var);
+
+        // check if we are skipping this operation
+        size_t i_op = play_itr.op_index();
+        while( cskip_op[i_op] )
+        {   if( op == AFunOp )
+            {   // get information for this atomic function call
+                CPPAD_ASSERT_UNKNOWN( atom_state == end_atom );
+                play::atom_op_info<Base>(
+                    op, arg, atom_index, atom_old, atom_m, atom_n
+                );
+                //
+                // skip to the first AFunOp
+                for(size_t i = 0; i < atom_m + atom_n + 1; ++i)
+                    --play_itr;
+                play_itr.op_info(op, arg, i_var);
+                CPPAD_ASSERT_UNKNOWN( op == AFunOp );
+            }
+            (--play_itr).op_info(op, arg, i_var);
+            i_op = play_itr.op_index();
+        }
+        //
+        // operators that are evaluated once for all the directions
+        bool each_direction = true;
+        switch( op )
+        {
+            case CSkipOp:
+            // CSkipOp has a zero order forward action.
+            play_itr.correct_after_decrement(arg);
+            each_direction = false;
+            break;
+            // -------------------------------------------------
+
+            case CSumOp:
+            // reverse_csum_op is evaluated for each direction below
+            play_itr.correct_after_decrement(arg);
+            break;
+            // -------------------------------------------------
+
+            case AFunOp:
+            // start or end an atomic function call
+            flag = atom_state == end_atom;
+            play::atom_op_info<RecBase>(
+                op, arg, atom_index, atom_old, atom_m, atom_n
+            );
+            if( flag )
+            {   atom_state = ret_atom;
+                atom_i     = atom_m;
+                atom_j     = atom_n;
+                //
+                atom_ix.resize(atom_n);
+                atom_iy.resize(atom_m);
+                atom_par_x.resize(atom_n);
+                atom_type_x.resize(atom_n);
+                atom_tx.resize(atom_n * 2);
+                atom_px.resize(atom_n * 2);
+                atom_ty.resize(atom_m * 2);
+                atom_py.resize(atom_m * 2);
+            }
+            else
+            {   CPPAD_ASSERT_UNKNOWN( atom_i == 0 );
+                CPPAD_ASSERT_UNKNOWN( atom_j == 0  );
+                atom_state = end_atom;
+                //
+                // call atomic function once for each direction
+                for(size_t ell = 0; ell < r; ++ell)
+                {   for(size_t j = 0; j < atom_n; ++j)
+                    {   if( atom_ix[j] > 0 )
+                        {   size_t index = atom_ix[j] * J + 2 * ell;
+                            atom_tx[j * 2 + 0] = taylor[index + 0];
+                            atom_tx[j * 2 + 1] = taylor[index + 1];
+                        }
+                        else
+                        {   atom_tx[j * 2 + 0] = atom_par_x[j];
+                            atom_tx[j * 2 + 1] = Base(0.0);
+                        }
+                    }
+                    for(size_t i = 0; i < atom_m; ++i)
+                    {   if( atom_iy[i] > 0 )
+                        {   size_t index = atom_iy[i] * J + 2 * ell;
+                            atom_ty[i * 2 + 0] = taylor[index + 0];
+                            atom_ty[i * 2 + 1] = taylor[index + 1];
+                            atom_py[i * 2 + 0] = partial[index + 0];
+                            atom_py[i * 2 + 1] = partial[index + 1];
+                        }
+                    }
+                    call_atomic_reverse<Base, RecBase>(
+                        atom_par_x,
+                        atom_type_x,
+                        d,
+                        atom_index,
+                        atom_old,
+                        atom_tx,
+                        atom_ty,
+                        atom_px,
+                        atom_py
+                    );
+                    for(size_t j = 0; j < atom_n; ++j) if( atom_ix[j] > 0 )
+                    {   size_t index = atom_ix[j] * K + 2 * ell;
+                        partial[index + 0] += atom_px[j * 2 + 0];
+                        partial[index + 1] += atom_px[j * 2 + 1];
+                    }
+                }
+            }
+            each_direction = false;
+            break;
+
+            case FunapOp:
+            // parameter argument in an atomic operation sequence
+            CPPAD_ASSERT_UNKNOWN( NumArg(op) == 1 );
+            CPPAD_ASSERT_UNKNOWN( atom_state == arg_atom );
+            CPPAD_ASSERT_UNKNOWN( atom_i == 0 );
+            CPPAD_ASSERT_UNKNOWN( atom_j <= atom_n );
+            CPPAD_ASSERT_UNKNOWN( size_t( arg[0] ) < num_par );
+            //
+            --atom_j;
+            atom_ix[atom_j]               = 0;
+            if( play->dyn_par_is()[ arg[0] ] )
+                atom_type_x[atom_j]       = dynamic_enum;
+            else
+                atom_type_x[atom_j]       = constant_enum;
+            atom_par_x[atom_j]            = parameter[ arg[0] ];
+            //
+            if( atom_j == 0 )
+                atom_state = start_atom;
+            each_direction = false;
+            break;
+
+            case FunavOp:
+            // variable argument in an atomic operation sequence
+            CPPAD_ASSERT_UNKNOWN( NumArg(op) == 1 );
+            CPPAD_ASSERT_UNKNOWN( atom_state == arg_atom );
+            CPPAD_ASSERT_UNKNOWN( atom_i == 0 );
+            CPPAD_ASSERT_UNKNOWN( atom_j <= atom_n );
+            //
+            --atom_j;
+            atom_ix[atom_j]     = size_t( arg[0] );
+            atom_type_x[atom_j] = variable_enum;
+            atom_par_x[atom_j] = CppAD::numeric_limits<Base>::quiet_NaN();
+            //
+            if( atom_j == 0 )
+                atom_state = start_atom;
+            each_direction = false;
+            break;
+
+            case FunrpOp:
+            // parameter result for a atomic function
+            CPPAD_ASSERT_NARG_NRES(op, 1, 0);
+            CPPAD_ASSERT_UNKNOWN( atom_state == ret_atom );
+            CPPAD_ASSERT_UNKNOWN( atom_i <= atom_m );
+            CPPAD_ASSERT_UNKNOWN( atom_j == atom_n );
+            CPPAD_ASSERT_UNKNOWN( size_t( arg[0] ) < num_par );
+            //
+            --atom_i;
+            atom_iy[atom_i]         = 0;
+            atom_ty[atom_i * 2 + 0] = parameter[ arg[0] ];
+            atom_ty[atom_i * 2 + 1] = Base(0.0);
+            atom_py[atom_i * 2 + 0] = Base(0.0);
+            atom_py[atom_i * 2 + 1] = Base(0.0);
+            //
+            if( atom_i == 0 )
+                atom_state = arg_atom;
+            each_direction = false;
+            break;
+
+            case FunrvOp:
+            // variable result for a atomic function
+            CPPAD_ASSERT_NARG_NRES(op, 0, 1);
+            CPPAD_ASSERT_UNKNOWN( atom_state == ret_atom );
+            CPPAD_ASSERT_UNKNOWN( atom_i <= atom_m );
+            CPPAD_ASSERT_UNKNOWN( atom_j == atom_n );
+            //
+            --atom_i;
+            atom_iy[atom_i] = i_var;
+            if( atom_i == 0 )
+                atom_state = arg_atom;
+            each_direction = false;
+            break;
+            // ------------------------------------------------------------
+
+            default:
+            break;
+        }
+        //
+        // operators that are evaluated once for each direction
+        if( each_direction ) for(size_t ell = 0; ell < r; ++ell)
+        {   // Taylor coefficients and partials for this direction
+            const Base* Taylor  = taylor  + 2 * ell;
+            Base*       Partial = partial + 2 * ell;
+            //
+            switch( op )
+            {
+                case AbsOp:
+                reverse_abs_op(
+                    d, i_var, size_t(arg[0]), J, Taylor, K, Partial
+                );
+                break;
+                // --------------------------------------------------
+
+                case AcosOp:
+                // sqrt(1 - x * x), acos(x)
+                CPPAD_ASSERT_UNKNOWN( i_var < numvar );
+                reverse_acos_op(
+                    d, i_var, size_t(arg[0]), J, Taylor, K, Partial
+                );
+                break;
+                // --------------------------------------------------
+
+                case AcoshOp:
+                // sqrt(x * x - 1), acosh(x)
+                CPPAD_ASSERT_UNKNOWN( i_var < numvar );
+                reverse_acosh_op(
+                    d, i_var, size_t(arg[0]), J, Taylor, K, Partial
+                );
+                break;
+                // --------------------------------------------------
+
+                case AddvvOp:
+                reverse_addvv_op(
+                    d, i_var, arg, parameter, J, Taylor, K, Partial
+                );
+                break;
+                // --------------------------------------------------
+
+                case AddpvOp:
+                CPPAD_ASSERT_UNKNOWN( size_t(arg[0]) < num_par );
+                reverse_addpv_op(
+                    d, i_var, arg, parameter, J, Taylor, K, Partial
+                );
+                break;
+                // --------------------------------------------------
+
+                case AsinOp:
+                // sqrt(1 - x * x), asin(x)
+                CPPAD_ASSERT_UNKNOWN( i_var < numvar );
+                reverse_asin_op(
+                    d, i_var, size_t(arg[0]), J, Taylor, K, Partial
+                );
+                break;
+                // --------------------------------------------------
+
+                case AsinhOp:
+                // sqrt(1 + x * x), asinh(x)
+                CPPAD_ASSERT_UNKNOWN( i_var < numvar );
+                reverse_asinh_op(
+                    d, i_var, size_t(arg[0]), J, Taylor, K, Partial
+                );
+                break;
+                // --------------------------------------------------
+
+                case AtanOp:
+                // 1 + x * x, atan(x)
+                CPPAD_ASSERT_UNKNOWN( i_var < numvar );
+                reverse_atan_op(
+                    d, i_var, size_t(arg[0]), J, Taylor, K, Partial
+                );
+                break;
+                // -------------------------------------------------
+
+                case AtanhOp:
+                // 1 - x * x, atanh(x)
+                CPPAD_ASSERT_UNKNOWN( i_var < numvar );
+                reverse_atanh_op(
+                    d, i_var, size_t(arg[0]), J, Taylor, K, Partial
+                );
+                break;
+                // -------------------------------------------------
+
+                case BeginOp:
+                CPPAD_ASSERT_NARG_NRES(op, 1, 1);
+                CPPAD_ASSERT_UNKNOWN( i_op == 0 );
+                break;
+                // --------------------------------------------------
+
+                case CSkipOp:
+                // CSkipOp has a zero order forward action.
+                break;
+                // -------------------------------------------------
+
+                case CSumOp:
+                reverse_csum_op(
+                    d, i_var, arg, K, Partial
+                );
+                // end of a cumulative summation
+                break;
+                // -------------------------------------------------
+
+                case CExpOp:
+                reverse_cond_op(
+                    d,
+                    i_var,
+                    arg,
+                    num_par,
+                    parameter,
+                    J,
+                    Taylor,
+                    K,
+                    Partial
+                );
+                break;
+                // --------------------------------------------------
+
+                case CosOp:
+                CPPAD_ASSERT_UNKNOWN( i_var < numvar );
+                reverse_cos_op(
+                    d, i_var, size_t(arg[0]), J, Taylor, K, Partial
+                );
+                break;
+                // --------------------------------------------------
+
+                case CoshOp:
+                CPPAD_ASSERT_UNKNOWN( i_var < numvar );
+                reverse_cosh_op(
+                    d, i_var, size_t(arg[0]), J, Taylor, K, Partial
+                );
+                break;
+                // --------------------------------------------------
+
+                case DisOp:
+                // Derivative of discrete operation is zero so no
+                // contribution passes through this operation.
+                break;
+                // --------------------------------------------------
+
+                case DivvvOp:
+                reverse_divvv_op(
+                    d, i_var, arg, parameter, J, Taylor, K, Partial
+                );
+                break;
+                // --------------------------------------------------
+
+                case DivpvOp:
+                CPPAD_ASSERT_UNKNOWN( size_t(arg[0]) < num_par );
+                reverse_divpv_op(
+                    d, i_var, arg, parameter, J, Taylor, K, Partial
+                );
+                break;
+                // --------------------------------------------------
+
+                case DivvpOp:
+                CPPAD_ASSERT_UNKNOWN( size_t(arg[1]) < num_par );
+                reverse_divvp_op(
+                    d, i_var, arg, parameter, J, Taylor, K, Partial
+                );
+                break;
+                // --------------------------------------------------
+                case EndOp:
+                CPPAD_ASSERT_UNKNOWN(
+                    i_op == play->num_op_rec() - 1
+                );
+                break;
+
+                // --------------------------------------------------
+
+                case ErfOp:
+                case ErfcOp:
+                reverse_erf_op(
+                    op, d, i_var, arg, parameter, J, Taylor, K, Partial
+                );
+                break;
+                // --------------------------------------------------
+
+                case ExpOp:
+                reverse_exp_op(
+                    d, i_var, size_t(arg[0]), J, Taylor, K, Partial
+                );
+                break;
+                // --------------------------------------------------
+
+                case Expm1Op:
+                reverse_expm1_op(
+                    d, i_var, size_t(arg[0]), J, Taylor, K, Partial
+                );
+                break;
+                // --------------------------------------------------
+
+                case InvOp:
+                break;
+                // --------------------------------------------------
+
+                case LdpOp:
+                reverse_load_op(
+                op, d, i_var, arg, J, Taylor, K, Partial, load_op2var.data()
+                );
+                break;
+                // -------------------------------------------------
+
+                case LdvOp:
+                reverse_load_op(
+                op, d, i_var, arg, J, Taylor, K, Partial, load_op2var.data()
+                );
+                break;
+                // --------------------------------------------------
+
+                case EqppOp:
+                case EqpvOp:
+                case EqvvOp:
+                case LtppOp:
+                case LtpvOp:
+                case LtvpOp:
+                case LtvvOp:
+                case LeppOp:
+                case LepvOp:
+                case LevpOp:
+                case LevvOp:
+                case NeppOp:
+                case NepvOp:
+                case NevvOp:
+                break;
+                // -------------------------------------------------
+
+                case LogOp:
+                reverse_log_op(
+                    d, i_var, size_t(arg[0]), J, Taylor, K, Partial
+                );
+                break;
+                // --------------------------------------------------
+
+                case Log1pOp:
+                reverse_log1p_op(
+                    d, i_var, size_t(arg[0]), J, Taylor, K, Partial
+                );
+                break;
+                // --------------------------------------------------
+
+                case MulpvOp:
+                CPPAD_ASSERT_UNKNOWN( size_t(arg[0]) < num_par );
+                reverse_mulpv_op(
+                    d, i_var, arg, parameter, J, Taylor, K, Partial
+                );
+                break;
+                // --------------------------------------------------
+
+                case MulvvOp:
+                reverse_mulvv_op(
+                    d, i_var, arg, parameter, J, Taylor, K, Partial
+                );
+                break;
+                // -------------------------------------------------
+
+                case NegOp:
+                reverse_neg_op(
+                    d, i_var, size_t(arg[0]), J, Taylor, K, Partial
+                );
+                break;
+                // --------------------------------------------------
+
+                case ParOp:
+                break;
+                // --------------------------------------------------
+
+                case PowvpOp:
+                CPPAD_ASSERT_UNKNOWN( size_t(arg[1]) < num_par );
+                reverse_powvp_op(
+                    d, i_var, arg, parameter, J, Taylor, K, Partial, work
+                );
+                break;
+                // -------------------------------------------------
+
+                case PowpvOp:
+                CPPAD_ASSERT_UNKNOWN( size_t(arg[0]) < num_par );
+                reverse_powpv_op(
+                    d, i_var, arg, parameter, J, Taylor, K, Partial
+                );
+                break;
+                // -------------------------------------------------
+
+                case PowvvOp:
+                reverse_powvv_op(
+                    d, i_var, arg, parameter, J, Taylor, K, Partial
+                );
+                break;
+                // --------------------------------------------------
+
+                case PriOp:
+                // no result so nothing to do
+                break;
+                // --------------------------------------------------
+
+                case SignOp:
+                CPPAD_ASSERT_UNKNOWN( i_var < numvar );
+                reverse_sign_op(
+                    d, i_var, size_t(arg[0]), J, Taylor, K, Partial
+                );
+                break;
+                // -------------------------------------------------
+
+                case SinOp:
+                CPPAD_ASSERT_UNKNOWN( i_var < numvar );
+                reverse_sin_op(
+                    d, i_var, size_t(arg[0]), J, Taylor, K, Partial
+                );
+                break;
+                // -------------------------------------------------
+
+                case SinhOp:
+                CPPAD_ASSERT_UNKNOWN( i_var < numvar );
+                reverse_sinh_op(
+                    d, i_var, size_t(arg[0]), J, Taylor, K, Partial
+                );
+                break;
+                // --------------------------------------------------
+
+                case SqrtOp:
+                reverse_sqrt_op(
+                    d, i_var, size_t(arg[0]), J, Taylor, K, Partial
+                );
+                break;
+                // --------------------------------------------------
+
+                case StppOp:
+                break;
+                // --------------------------------------------------
+
+                case StpvOp:
+                break;
+                // -------------------------------------------------
+
+                case StvpOp:
+                break;
+                // -------------------------------------------------
+
+                case StvvOp:
+                break;
+                // --------------------------------------------------
+
+                case SubvvOp:
+                reverse_subvv_op(
+                    d, i_var, arg, parameter, J, Taylor, K, Partial
+                );
+                break;
+                // --------------------------------------------------
+
+                case SubpvOp:
+                CPPAD_ASSERT_UNKNOWN( size_t(arg[0]) < num_par );
+                reverse_subpv_op(
+                    d, i_var, arg, parameter, J, Taylor, K, Partial
+                );
+                break;
+                // --------------------------------------------------
+
+                case SubvpOp:
+                CPPAD_ASSERT_UNKNOWN( size_t(arg[1]) < num_par );
+                reverse_subvp_op(
+                    d, i_var, arg, parameter, J, Taylor, K, Partial
+                );
+                break;
+                // -------------------------------------------------
+
+                case TanOp:
+                CPPAD_ASSERT_UNKNOWN( i_var < numvar );
+                reverse_tan_op(
+                    d, i_var, size_t(arg[0]), J, Taylor, K, Partial
+                );
+                break;
+                // -------------------------------------------------
+
+                case TanhOp:
+                CPPAD_ASSERT_UNKNOWN( i_var < numvar );
+                reverse_tanh_op(
+                    d, i_var, size_t(arg[0]), J, Taylor, K, Partial
+                );
+                break;
+                // --------------------------------------------------
+
+                case ZmulpvOp:
+                CPPAD_ASSERT_UNKNOWN( size_t(arg[0]) < num_par );
+                reverse_zmulpv_op(
+                    d, i_var, arg, parameter, J, Taylor, K, Partial
+                );
+                break;
+                // --------------------------------------------------
+
+                case ZmulvpOp:
+                CPPAD_ASSERT_UNKNOWN( size_t(arg[1]) < num_par );
+                reverse_zmulvp_op(
+                    d, i_var, arg, parameter, J, Taylor, K, Partial
+                );
+                break;
+                // --------------------------------------------------
+
+                case ZmulvvOp:
+                reverse_zmulvv_op(
+                    d, i_var, arg, parameter, J, Taylor, K, Partial
+                );
+                break;
+                // --------------------------------------------------
+
+                default:
+                CPPAD_ASSERT_UNKNOWN(false);
+            }
+        }
+    }
+    CPPAD_ASSERT_UNKNOWN( atom_state == end_atom );
+}
+
+} } } // END_CPPAD_LOCAL_SWEEP_NAMESPACE
+
+# endif
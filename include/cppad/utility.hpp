@@ -34,6 +34,7 @@ in the Eclipse Public License, Version 2.0 are satisfied:
 # include <cppad/utility/rosen_34.hpp>
 # include <cppad/utility/runge_45.hpp>
 # include <cppad/utility/set_union.hpp>
+# include <cppad/utility/small_vector.hpp>
 # include <cppad/utility/sparse_rc.hpp>
 # include <cppad/utility/sparse_rcv.hpp>
 # include <cppad/utility/speed_test.hpp>
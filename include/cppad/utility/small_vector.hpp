@@ -0,0 +1,364 @@
+# ifndef CPPAD_UTILITY_SMALL_VECTOR_HPP
+# define CPPAD_UTILITY_SMALL_VECTOR_HPP
+/* --------------------------------------------------------------------------
+CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-21 Bradley M. Bell
+
+CppAD is distributed under the terms of the
+             Eclipse Public License Version 2.0.
+
+This Source Code may also be made available under the following
+Secondary License when the conditions for such availability set forth
+in the Eclipse Public License, Version 2.0 are satisfied:
+      GNU General Public License, Version 2.0 or later.
+---------------------------------------------------------------------------- */
+/*
+$begin small_vector$$
+$spell
+    const
+    vec
+    resize
+    thread_alloc
+    cppad.hpp
+    std
+$$
+
+$section A Vector That Stores Short Vectors Without Allocating Memory$$
+
+$head Syntax$$
+$codei%# include <cppad/utility/small_vector.hpp>
+%$$
+$codei%CppAD::small_vector<%Scalar%, %N%> %vec%, %other%
+%$$
+$icode%cap% = %vec%.capacity()
+%$$
+$icode%inline% = %vec%.is_inline()
+%$$
+$icode%ptr% = %vec%.data()
+%$$
+$icode%vec%.push_back(%element%)
+%$$
+$icode%vec%.clear()
+%$$
+
+$head Purpose$$
+A $cref/CppAD::vector/CppAD_vector/$$ obtains memory from $cref thread_alloc$$
+for every vector that is not empty.
+Vectors with only a few elements, e.g., the argument and result vectors
+for a scalar function, can be created and destroyed many times.
+The $code small_vector$$ template class stores the first $icode N$$
+elements inside of the $icode vec$$ object.
+No memory is allocated unless the size of the vector exceeds $icode N$$.
+
+$head SimpleVector$$
+The class $codei%small_vector<%Scalar%, %N%>%$$ satisfies all the
+requirements for a $cref SimpleVector$$ with elements of type $icode Scalar$$.
+(Because it has two template parameters, it cannot be used for
+a template vector class; e.g., the $cref/VectorSet/sparsity_pattern/$$
+argument to a function.)
+As with $code CppAD::vector$$,
+if $code NDEBUG$$ is not defined, the index $icode i$$ in
+$icode%vec%[%i%]%$$ is checked to make sure it is less than the size
+of the vector.
+
+$head N$$
+This is a $code size_t$$ constant greater than zero.
+It is the number of elements that are stored inside of $icode vec$$.
+These elements are default constructed when $icode vec$$ is constructed.
+
+$head Heap Memory$$
+If the size of $icode vec$$ exceeds $icode N$$, its elements are stored in
+memory obtained from $cref thread_alloc$$.
+This memory is aligned to a 64 byte boundary (the size of a cache line
+on most systems).
+As with $code CppAD::vector$$,
+all of the elements up to the capacity of $icode vec$$ are constructed,
+and the memory is not returned when the size of $icode vec$$ decreases.
+
+$head capacity$$
+The return value $icode cap$$ has prototype
+$codei%
+    size_t %cap%
+%$$
+It is the number of elements that $icode vec$$ can hold without allocating
+more memory. It is greater than or equal $icode N$$.
+
+$head is_inline$$
+The return value $icode inline$$ has prototype
+$codei%
+    bool %inline%
+%$$
+It is true if the elements of $icode vec$$ are stored inside of $icode vec$$
+(and false if they are stored in heap memory).
+
+$head data$$
+The return value $icode ptr$$ has prototype
+$codei%
+    const %Scalar%* %ptr%
+%$$
+(not $code const$$ if $icode vec$$ is not $code const$$).
+It is a pointer to the first element of $icode vec$$.
+
+$head push_back$$
+The argument $icode element$$ has prototype
+$codei%
+    const %Scalar%& %element%
+%$$
+It is added to the end of $icode vec$$.
+If more memory is required, the capacity is at least doubled so that
+a sequence of $code push_back$$ operations allocates
+a logarithmic number of times.
+
+$head clear$$
+This sets the size of $icode vec$$ to zero and returns its heap memory
+(if any) to $code thread_alloc$$.
+
+$head Assignment$$
+The assignment $icode%vec% = %other%$$ resizes $icode vec$$
+to the size of $icode other$$ and copies its elements.
+The assignment $icode%vec% = std::move(%other%)%$$
+takes the heap memory from $icode other$$ (when $icode other$$ is not inline)
+so it does not copy the elements.
+
+$head Memory and Parallel Mode$$
+See $cref/CppAD::vector/CppAD_vector/Memory and Parallel Mode/$$.
+
+$head Example$$
+$children%
+    example/utility/small_vector.cpp
+%$$
+The file $cref small_vector.cpp$$
+contains an example and test of this class.
+
+$end
+*/
+# include <cstddef>
+# include <cstdint>
+# include <new>
+# include <utility>
+# include <iostream>
+# include <cppad/core/cppad_assert.hpp>
+# include <cppad/utility/thread_alloc.hpp>
+
+/// alignment, in bytes, of the heap memory used by small_vector
+# define CPPAD_SMALL_VECTOR_ALIGN 64
+
+namespace CppAD { // BEGIN_CPPAD_NAMESPACE
+
+template <class Type, size_t N> class small_vector {
+    static_assert( N > 0, "small_vector: N is zero" );
+private:
+    /// number of elements in data_ that have been constructed
+    size_t capacity_;
+    /// number of elements currently in this vector
+    size_t length_;
+    /// pointer to inline_ or to aligned heap memory
+    Type*  data_;
+    /// memory obtained from thread_alloc (nullptr when data_ == inline_)
+    void*  heap_;
+    /// storage for the first N elements
+    Type   inline_[N];
+    // -----------------------------------------------------------------------
+    /*!
+    Allocate aligned heap memory and construct its elements.
+
+    \param n [in]
+    minimum number of elements.
+
+    \param cap [out]
+    is the number of elements that were constructed (cap >= n).
+
+    \param raw [out]
+    is the memory that must be returned to thread_alloc.
+
+    \return
+    is the 64 byte aligned pointer to the first element.
+    */
+    static Type* new_heap(size_t n, size_t& cap, void*& raw)
+    {   size_t align     = CPPAD_SMALL_VECTOR_ALIGN;
+        size_t min_bytes = n * sizeof(Type) + align - 1;
+        size_t cap_bytes;
+        raw = thread_alloc::get_memory(min_bytes, cap_bytes);
+        //
+        std::uintptr_t address = reinterpret_cast<std::uintptr_t>(raw);
+        address = (address + align - 1) & ~ std::uintptr_t(align - 1);
+        Type* array = reinterpret_cast<Type*>(address);
+        //
+        size_t offset = size_t(address - reinterpret_cast<std::uintptr_t>(raw));
+        cap           = (cap_bytes - offset) / sizeof(Type);
+        CPPAD_ASSERT_UNKNOWN( n <= cap );
+        for(size_t i = 0; i < cap; ++i)
+            new(array + i) Type();
+        return array;
+    }
+    /// destroy the elements in heap memory and return the memory
+    static void delete_heap(Type* array, size_t cap, void* raw)
+    {   for(size_t i = 0; i < cap; ++i)
+            (array + i)->~Type();
+        thread_alloc::return_memory(raw);
+    }
+    /// change to heap memory with capacity at least n, keep the elements
+    void reserve(size_t n)
+    {   CPPAD_ASSERT_UNKNOWN( capacity_ < n );
+        size_t cap;
+        void*  raw;
+        Type*  array = new_heap(n, cap, raw);
+        for(size_t i = 0; i < length_; ++i)
+            array[i] = data_[i];
+        if( heap_ != nullptr )
+            delete_heap(data_, capacity_, heap_);
+        capacity_ = cap;
+        data_     = array;
+        heap_     = raw;
+    }
+public:
+    /// type of the elements in the vector
+    typedef Type value_type;
+    // -----------------------------------------------------------------------
+    /// default constructor
+    small_vector(void)
+    : capacity_(N), length_(0), data_(inline_), heap_(nullptr)
+    { }
+    /// sizing constructor
+    small_vector(size_t n)
+    : capacity_(N), length_(0), data_(inline_), heap_(nullptr)
+    {   resize(n); }
+    /// sizing constructor (so that small_vector(3) is not ambiguous)
+    small_vector(int n)
+    : capacity_(N), length_(0), data_(inline_), heap_(nullptr)
+    {   CPPAD_ASSERT_KNOWN(
+            n >= 0,
+            "small_vector: attempt to create a vector with a negative size."
+        );
+        resize( size_t(n) );
+    }
+    /// copy constructor
+    small_vector(const small_vector& other)
+    : capacity_(N), length_(0), data_(inline_), heap_(nullptr)
+    {   resize(other.length_);
+        for(size_t i = 0; i < length_; ++i)
+            data_[i] = other.data_[i];
+    }
+    /// move semantics constructor
+    small_vector(small_vector&& other)
+    : capacity_(N), length_(0), data_(inline_), heap_(nullptr)
+    {   *this = std::move(other); }
+    /// destructor
+    ~small_vector(void)
+    {   if( heap_ != nullptr )
+            delete_heap(data_, capacity_, heap_);
+    }
+    // -----------------------------------------------------------------------
+    /// number of elements that can be stored without allocating memory
+    size_t capacity(void) const
+    {   return capacity_; }
+    /// number of elements in the vector
+    size_t size(void) const
+    {   return length_; }
+    /// are the elements stored in this object
+    bool is_inline(void) const
+    {   return heap_ == nullptr; }
+    /// pointer to the first element
+    Type* data(void)
+    {   return data_; }
+    /// const pointer to the first element
+    const Type* data(void) const
+    {   return data_; }
+    // -----------------------------------------------------------------------
+    /// change the number of elements (the first elements are not changed)
+    void resize(size_t n)
+    {   if( capacity_ < n )
+            reserve(n);
+        length_ = n;
+    }
+    /// set the size to zero and return the heap memory
+    void clear(void)
+    {   if( heap_ != nullptr )
+            delete_heap(data_, capacity_, heap_);
+        capacity_ = N;
+        length_   = 0;
+        data_     = inline_;
+        heap_     = nullptr;
+    }
+    /// add an element to the end of the vector
+    void push_back(const Type& element)
+    {   if( length_ == capacity_ )
+        {   // element may be in this vector
+            Type copy = element;
+            reserve( 2 * capacity_ );
+            data_[length_++] = copy;
+            return;
+        }
+        data_[length_++] = element;
+    }
+    // -----------------------------------------------------------------------
+    /// assignment
+    small_vector& operator=(const small_vector& other)
+    {   if( this == &other )
+            return *this;
+        // avoid copying old elements
+        resize(0);
+        resize(other.length_);
+        for(size_t i = 0; i < length_; ++i)
+            data_[i] = other.data_[i];
+        return *this;
+    }
+    /// move semantics assignment
+    small_vector& operator=(small_vector&& other)
+    {   if( this == &other )
+            return *this;
+        if( other.heap_ == nullptr )
+            return *this = other;
+        // take the heap memory from other
+        if( heap_ != nullptr )
+            delete_heap(data_, capacity_, heap_);
+        capacity_ = other.capacity_;
+        length_   = other.length_;
+        data_     = other.data_;
+        heap_     = other.heap_;
+        //
+        other.capacity_ = N;
+        other.length_   = 0;
+        other.data_     = other.inline_;
+        other.heap_     = nullptr;
+        return *this;
+    }
+    // -----------------------------------------------------------------------
+    /// const element access
+    const Type& operator[](size_t i) const
+    {   CPPAD_ASSERT_KNOWN( i < length_,
+            "small_vector: index greater than or equal vector size"
+        );
+        return data_[i];
+    }
+    /// element access
+    Type& operator[](size_t i)
+    {   CPPAD_ASSERT_KNOWN( i < length_,
+            "small_vector: index greater than or equal vector size"
+        );
+        return data_[i];
+    }
+    /// const element access with other index types
+    template <class Index> const Type& operator[](Index i) const
+    {   return (*this)[size_t(i)]; }
+    /// element access with other index types
+    template <class Index> Type& operator[](Index i)
+    {   return (*this)[size_t(i)]; }
+};
+
+/// output a small_vector
+template <class Type, size_t N>
+std::ostream& operator << (std::ostream& os, const small_vector<Type, N>& vec)
+{   os << "{ ";
+    for(size_t i = 0; i < vec.size(); ++i)
+    {   os << vec[i];
+        if( i + 1 < vec.size() )
+            os << ", ";
+    }
+    os << " }";
+    return os;
+}
+
+} // END_CPPAD_NAMESPACE
+
+# undef CPPAD_SMALL_VECTOR_ALIGN
+# endif
@@ -15,6 +15,35 @@ in the Eclipse Public License, Version 2.0 are satisfied:
 # include <sstream>
 # include <limits>
 # include <memory>
+# include <atomic>
+# include <algorithm>
+# include <cstdint>
+
+# if defined(__linux__)
+# include <sys/mman.h>
+# include <sys/syscall.h>
+# include <unistd.h>
+/*!
+\def CPPAD_THREAD_ALLOC_MMAP
+If this is one, large blocks in aligned mode are obtained using mmap
+and advised to use transparent huge pages.
+*/
+# define CPPAD_THREAD_ALLOC_MMAP 1
+# else
+# define CPPAD_THREAD_ALLOC_MMAP 0
+# endif
+
+/*!
+\def CPPAD_THREAD_ALLOC_NUMA
+If this is one, the NUMA memory policy system calls are available
+(they are used directly so that there is no dependence on libnuma).
+*/
+# if CPPAD_THREAD_ALLOC_MMAP && defined(SYS_mbind) && \
+    defined(SYS_getcpu) && defined(SYS_get_mempolicy)
+# define CPPAD_THREAD_ALLOC_NUMA 1
+# else
+# define CPPAD_THREAD_ALLOC_NUMA 0
+# endif
 
 
 # ifdef _MSC_VER
@@ -36,9 +65,11 @@ File used to define the CppAD multi-threading allocator class
 /*!
 \def CPPAD_MAX_NUM_CAPACITY
 Maximum number of different capacities the allocator will attempt.
-This must be larger than the log base two of numeric_limit<size_t>::max().
+This must be larger than the number of standard capacities
+(log base 3/2 of numeric_limit<size_t>::max()) plus the number of
+aligned capacities (four times log base two of numeric_limit<size_t>::max()).
 */
-# define CPPAD_MAX_NUM_CAPACITY 100
+# define CPPAD_MAX_NUM_CAPACITY 350
 
 /*!
 \def CPPAD_MIN_DOUBLE_CAPACITY
@@ -46,6 +77,27 @@ Minimum number of double values that will fit in an allocation.
 */
 # define CPPAD_MIN_DOUBLE_CAPACITY 16
 
+/*!
+\def CPPAD_ALIGNED_BYTES
+Alignment, and spacing of the small capacities, in aligned mode.
+*/
+# define CPPAD_ALIGNED_BYTES 64
+
+/*!
+\def CPPAD_ALIGNED_SMALL_BYTES
+In aligned mode, the capacities less than or equal this value are
+multiples of CPPAD_ALIGNED_BYTES. Above this value there are four
+capacities between each power of two.
+*/
+# define CPPAD_ALIGNED_SMALL_BYTES 1024
+
+/*!
+\def CPPAD_HUGE_PAGE_BYTES
+Large blocks in aligned mode that are at least this size start on a multiple
+of this many bytes (the size of a transparent huge page on x86_64 Linux).
+*/
+# define CPPAD_HUGE_PAGE_BYTES 2097152
+
 /*!
 \def CPPAD_TRACE_CAPACITY
 If NDEBUG is not defined, print all calls to get_memory and return_memory
@@ -86,6 +138,9 @@ private:
     public:
         /// number of capacity values actually used
         size_t number;
+        /// number of standard capacity values; i.e., the capacities
+        /// value[c] for c >= number_standard are used by aligned mode
+        size_t number_standard;
         /// the different capacity values
         size_t value[CPPAD_MAX_NUM_CAPACITY];
         /// ctor
@@ -96,31 +151,82 @@ private:
             //    "parallel mode and parallel_setup not yet called."
             // );
             number           = 0;
+            size_t max_value = std::numeric_limits<size_t>::max() / 2;
             size_t capacity  = CPPAD_MIN_DOUBLE_CAPACITY * sizeof(double);
-            while( capacity < std::numeric_limits<size_t>::max() / 2 )
+            while( capacity < max_value )
             {   CPPAD_ASSERT_UNKNOWN( number < CPPAD_MAX_NUM_CAPACITY );
                 value[number++] = capacity;
                 // next capactiy is 3/2 times the current one
                 capacity        = 3 * ( (capacity + 1) / 2 );
             }
             CPPAD_ASSERT_UNKNOWN( number > 0 );
+            number_standard = number;
+            //
+            // aligned capacities: multiples of CPPAD_ALIGNED_BYTES
+            capacity = CPPAD_ALIGNED_BYTES;
+            while( capacity <= CPPAD_ALIGNED_SMALL_BYTES )
+            {   CPPAD_ASSERT_UNKNOWN( number < CPPAD_MAX_NUM_CAPACITY );
+                value[number++] = capacity;
+                capacity       += CPPAD_ALIGNED_BYTES;
+            }
+            // aligned capacities: four between each power of two
+            size_t power = CPPAD_ALIGNED_SMALL_BYTES;
+            while( power < max_value / 2 )
+            {   size_t step = power / 4;
+                for(size_t k = 1; k <= 4; k++)
+                {   CPPAD_ASSERT_UNKNOWN( number < CPPAD_MAX_NUM_CAPACITY );
+                    value[number++] = power + k * step;
+                }
+                power *= 2;
+            }
         }
     };
 
     class block_t {
     public:
-        /// extra information (currently used by create and delete array)
-        size_t             extra_;
+        union {
+            /// extra information (currently used by create and delete array)
+            size_t         extra_;
+            /// pointer to the next block in a remote free list
+            /// (extra_ is not used after the block is returned and
+            /// next_ is used by the inuse list while the block is in use)
+            void*          remote_next_;
+        };
         /// an index that uniquely idenfifies both thread and capacity
-        size_t             tc_index_;
+        std::uint32_t      tc_index_;
+        /// true if there is a raw_block_t directly before this header
+        bool               has_raw_;
         /// pointer to the next memory allocation with the same tc_index_
         void*              next_;
-        // -----------------------------------------------------------------
-        /// make default constructor private. It is only used by constructor
-        /// for `root arrays below.
-        block_t(void) : extra_(0), tc_index_(0), next_(nullptr)
-        { }
+        /// number of bytes requested by get_memory for this block
+        size_t             request_;
+    };
+    /*!
+    Information for a block that is aligned or was obtained using mmap.
+    This is stored directly before the block_t header so that the header
+    for the other blocks (standard mode) does not need these fields.
+    */
+    class raw_block_t {
+    public:
+        /// pointer returned by the system when this block was allocated
+        void*              raw_;
+        /// if non-zero, raw_ was obtained using mmap with this many bytes
+        size_t             map_bytes_;
+        /// true if raw_ starts on a huge page boundary and was advised
+        /// to use huge pages
+        bool               huge_;
     };
+    /// raw information for a block that has it
+    static raw_block_t* raw_block(block_t* node)
+    {   CPPAD_ASSERT_UNKNOWN( node->has_raw_ );
+        return reinterpret_cast<raw_block_t*>(node) - 1;
+    }
+    /// number of bytes obtained using mmap for a block (zero if not mapped)
+    static size_t block_map_bytes(block_t* node)
+    {   if( ! node->has_raw_ )
+            return 0;
+        return raw_block(node)->map_bytes_;
+    }
 
     // ---------------------------------------------------------------------
     /// Vector of fixed capacity values for this allocator
@@ -130,21 +236,59 @@ private:
         return &capacity;
     }
     // ---------------------------------------------------------------------
+    /// Counts for one capacity and one thread
+    struct capacity_count_t {
+        /// value of count_use_ for this thread the last time this capacity
+        /// was obtained or returned
+        size_t last_use_;
+        /// number of blocks that are in use
+        size_t num_inuse_;
+        /// number of blocks that are available
+        size_t num_available_;
+        /// number of get_memory calls that used an available block
+        size_t num_reuse_;
+        /// number of get_memory calls that obtained a block from the system
+        size_t num_new_;
+        /// number of available blocks returned to the system by trimming
+        size_t num_trim_;
+    };
+    // ---------------------------------------------------------------------
     /// Structure of information for each thread
     struct thread_alloc_info {
         /// count of available bytes for this thread
         size_t  count_inuse_;
         /// count of inuse bytes for this thread
         size_t  count_available_;
-        /// root of available list for this thread and each capacity
-        block_t root_available_[CPPAD_MAX_NUM_CAPACITY];
+        /// count of bytes requested for the inuse memory for this thread
+        size_t  count_requested_;
+        /// count of bytes obtained using mmap (inuse and available)
+        size_t  count_mapped_;
+        /// count of bytes obtained using mmap that are available
+        size_t  count_mapped_available_;
+        /// count of bytes obtained using mmap that are advised to use
+        /// huge pages (inuse and available)
+        size_t  count_huge_;
+        /// number of times a block was obtained or returned by this thread
+        /// (used to determine the least recently used capacity)
+        size_t  count_use_;
+        /*!
+        Lock-free stack of blocks, allocated by this thread, that were
+        returned by other threads during parallel execution.
+        Other threads only push onto this stack.
+        This thread removes the entire stack with one exchange.
+        */
+        std::atomic<void*> remote_free_;
+        /// first block in available list for this thread and each capacity
+        void* root_available_[CPPAD_MAX_NUM_CAPACITY];
         /*!
-        root of inuse list for this thread and each capacity
+        first block in inuse list for this thread and each capacity
         If NDEBUG or CPPAD_DEBUG_AND_RELEASE is defined, this memory is not
         used, but it still helps to separate this structure from the structure
         for the next thread.
         */
-        block_t root_inuse_[CPPAD_MAX_NUM_CAPACITY];
+        void* root_inuse_[CPPAD_MAX_NUM_CAPACITY];
+        /// counts for this thread and each capacity
+        capacity_count_t capacity_count_[CPPAD_MAX_NUM_CAPACITY];
     };
     // ---------------------------------------------------------------------
     /*!
@@ -168,6 +312,185 @@ private:
     }
     // ---------------------------------------------------------------------
     /*!
+    Set and Get aligned memory flag.
+
+    \param set [in]
+    if true, the value returned by this return is changed.
+
+    \param new_value [in]
+    if set is true, this is the new value returned by this routine.
+    Otherwise, new_value is ignored.
+
+    \return
+    the current setting for this routine (which is initially false).
+    */
+    static bool set_get_aligned_memory(bool set, bool new_value = false)
+    {   static bool value = false;
+        if( set )
+            value = new_value;
+        return value;
+    }
+    // ---------------------------------------------------------------------
+    /*!
+    Set and Get minimum capacity for large blocks in aligned mode.
+
+    \param set [in]
+    if true, the value returned by this return is changed.
+
+    \param new_value [in]
+    if set is true, this is the new value returned by this routine.
+    Otherwise, new_value is ignored.
+
+    \return
+    the current setting for this routine (which is initially 2 MB).
+    */
+    static size_t set_get_large_min(bool set, size_t new_value = 0)
+    {   static size_t value = 2 * 1024 * 1024;
+        if( set )
+            value = new_value;
+        return value;
+    }
+    // ---------------------------------------------------------------------
+    /*!
+    Set and Get maximum number of large block bytes held as available
+    (per thread).
+
+    \param set [in]
+    if true, the value returned by this return is changed.
+
+    \param new_value [in]
+    if set is true, this is the new value returned by this routine.
+    Otherwise, new_value is ignored.
+
+    \return
+    the current setting for this routine
+    (which is initially the maximum size_t value).
+    */
+    static size_t set_get_large_max(bool set, size_t new_value = 0)
+    {   static size_t value = std::numeric_limits<size_t>::max();
+        if( set )
+            value = new_value;
+        return value;
+    }
+    // ---------------------------------------------------------------------
+    /*!
+    Set and Get maximum number of bytes held as available (per thread).
+
+    \param set [in]
+    if true, the value returned by this return is changed.
+
+    \param new_value [in]
+    if set is true, this is the new value returned by this routine.
+    Otherwise, new_value is ignored.
+
+    \return
+    the current setting for this routine
+    (which is initially the maximum size_t value).
+    */
+    static size_t set_get_max_available(bool set, size_t new_value = 0)
+    {   static size_t value = std::numeric_limits<size_t>::max();
+        if( set )
+            value = new_value;
+        return value;
+    }
+    // ---------------------------------------------------------------------
+    /*!
+    Set and Get NUMA memory flag.
+
+    \param set [in]
+    if true, the value returned by this return is changed.
+
+    \param new_value [in]
+    if set is true, this is the new value returned by this routine.
+    Otherwise, new_value is ignored.
+
+    \return
+    the current setting for this routine (which is initially false).
+    */
+    static bool set_get_numa_memory(bool set, bool new_value = false)
+    {   static bool value = false;
+        if( set )
+            value = new_value;
+        return value;
+    }
+    // ---------------------------------------------------------------------
+    /*!
+    Set the NUMA memory policy for a range of pages.
+
+    \param v_ptr [in]
+    is the beginning of the range and must be a multiple of the page size.
+
+    \param num_bytes [in]
+    is the number of bytes in the range.
+
+    \param interleave [in]
+    If true, the pages are interleaved across all the nodes that this
+    process can use. Otherwise, the node for the cpu that is currently
+    executing this thread is preferred for the pages.
+
+    \param move [in]
+    If true, pages that have already been touched are moved to conform
+    with the policy. Otherwise, the policy only affects pages that have
+    not yet been touched.
+
+    \return
+    is true if the policy was successfully set and false otherwise
+    (for example, if the system does not support NUMA policies).
+    */
+    static bool numa_policy(
+        void* v_ptr, size_t num_bytes, bool interleave, bool move
+    )
+    {
+# if CPPAD_THREAD_ALLOC_NUMA
+        // values in <linux/mempolicy.h>
+        const int           mpol_preferred      = 1;
+        const int           mpol_interleave     = 3;
+        const unsigned long mpol_mf_move        = 1 << 1;
+        const unsigned long mpol_f_mems_allowed = 1 << 2;
+        //
+        // node mask with room for 1024 nodes
+        const size_t  n_bit  = size_t( std::numeric_limits<unsigned long>::digits );
+        const size_t  n_long = 1024 / n_bit;
+        unsigned long mask[1024 / std::numeric_limits<unsigned long>::digits];
+        for(size_t i = 0; i < n_long; ++i)
+            mask[i] = 0;
+        //
+        int mode;
+        if( interleave )
+        {   // all the nodes this process can use
+            int policy;
+            long flag = syscall(SYS_get_mempolicy,
+                &policy, mask, n_bit * n_long, nullptr, mpol_f_mems_allowed
+            );
+            if( flag != 0 )
+                return false;
+            mode = mpol_interleave;
+        }
+        else
+        {   // node for the cpu currently executing this thread
+            unsigned cpu, node;
+            long flag = syscall(SYS_getcpu, &cpu, &node, nullptr);
+            if( flag != 0 || n_bit * n_long <= size_t(node) )
+                return false;
+            mask[node / n_bit] = 1ul << (node % n_bit);
+            mode = mpol_preferred;
+        }
+        unsigned long flags = move ? mpol_mf_move : 0;
+        long flag = syscall(SYS_mbind,
+            v_ptr, num_bytes, mode, mask, n_bit * n_long + 1, flags
+        );
+        return flag == 0;
+# else
+        // NUMA policies are not supported on this system
+        (void) v_ptr;
+        (void) num_bytes;
+        (void) interleave;
+        (void) move;
+        return false;
+# endif
+    }
+    // ---------------------------------------------------------------------
+    /*!
     Get pointer to the information for this thread.
 
     \param thread [in]
@@ -188,8 +511,8 @@ private:
     <code>info->count_available == 0</code>.
     In addition,
     for <code>c = 0 , ... , CPPAD_MAX_NUM_CAPACITY-1</code>
-    <code>info->root_inuse_[c].next_ == nullptr</code> and
-    <code>info->root_available_[c].next_ == nullptr</code>.
+    <code>info->root_inuse_[c] == nullptr</code> and
+    <code>info->root_available_[c] == nullptr</code>.
     */
     static thread_alloc_info* thread_info(
         size_t             thread          ,
@@ -208,12 +531,16 @@ private:
 # ifndef NDEBUG
                 CPPAD_ASSERT_UNKNOWN(
                     info->count_inuse_     == 0 &&
-                    info->count_available_ == 0
+                    info->count_available_ == 0 &&
+                    info->count_requested_ == 0 &&
+                    info->count_mapped_    == 0 &&
+                    info->count_huge_      == 0 &&
+                    info->remote_free_.load() == nullptr
                 );
                 for(size_t c = 0; c < CPPAD_MAX_NUM_CAPACITY; c++)
                 {   CPPAD_ASSERT_UNKNOWN(
-                        info->root_inuse_[c].next_     == nullptr &&
-                        info->root_available_[c].next_ == nullptr
+                        info->root_inuse_[c]     == nullptr &&
+                        info->root_available_[c] == nullptr
                     );
                 }
 # endif
@@ -235,11 +562,25 @@ private:
 
             // initialize the information record
             for(size_t c = 0; c < CPPAD_MAX_NUM_CAPACITY; c++)
-            {   info->root_inuse_[c].next_       = nullptr;
-                info->root_available_[c].next_   = nullptr;
+            {   info->root_inuse_[c]       = nullptr;
+                info->root_available_[c]   = nullptr;
+                //
+                capacity_count_t& count = info->capacity_count_[c];
+                count.last_use_      = 0;
+                count.num_inuse_     = 0;
+                count.num_available_ = 0;
+                count.num_reuse_     = 0;
+                count.num_new_       = 0;
+                count.num_trim_      = 0;
             }
-            info->count_inuse_     = 0;
-            info->count_available_ = 0;
+            info->count_inuse_            = 0;
+            info->count_available_        = 0;
+            info->count_requested_        = 0;
+            info->count_mapped_           = 0;
+            info->count_mapped_available_ = 0;
+            info->count_huge_             = 0;
+            info->count_use_              = 0;
+            info->remote_free_.store(nullptr);
         }
         return info;
     }
@@ -338,93 +679,429 @@ private:
         info->count_available_ =  info->count_available_ - dec;
     }
 
-    // ----------------------------------------------------------------------
+    // -----------------------------------------------------------------------
     /*!
-    Set and get the number of threads that are sharing memory.
+    Return a block to the thread that allocated it.
+    If hold_memory is false, the memory is returned to the system.
+    Otherwise, it is added to the available list for this thread.
 
-    \param number_new
-    If number is zero, we are only retreiving the current maximum
-    number of threads. Otherwise, we are setting and retreiving
-    maximum number of threads.
+    \param node [in]
+    is the header for the memory that is being returned.
 
-    \return
-    the number of threads that are sharing memory.
-    If number_new is non-zero, the return value is equal to
-    number_new.
+    \par
+    We must either be in sequential (not parallel) execution mode,
+    or the current thread must be the same as for the corresponding call
+    to get_memory.
     */
-    static size_t set_get_num_threads(size_t number_new)
-    {   static size_t number_user = 1;
-
-        CPPAD_ASSERT_UNKNOWN( number_new <= CPPAD_MAX_NUM_THREADS );
-        CPPAD_ASSERT_UNKNOWN( ! in_parallel() || (number_new == 0) );
+    static void return_block(block_t* node)
+    {   size_t num_cap   = capacity_info()->number;
 
-        // case where we are changing the number of threads
-        if( number_new != 0 )
-            number_user = number_new;
+        size_t tc_index  = node->tc_index_;
+        size_t thread    = tc_index / num_cap;
+        size_t c_index   = tc_index % num_cap;
+        size_t capacity  = capacity_info()->value[c_index];
 
-        return number_user;
-    }
-    /*!
-    Set and call the routine that determine the current thread number.
+        CPPAD_ASSERT_UNKNOWN( thread < CPPAD_MAX_NUM_THREADS );
+        CPPAD_ASSERT_UNKNOWN( thread == thread_num() || (! in_parallel()) );
 
-    \return
-    returns value for the most recent setting for thread_num_new.
-    If set is true,
-    or the most recent setting is nullptr (its initial value),
-    the return value is zero.
-    Otherwise the routine corresponding to the most recent setting
-    is called and its value returned by set_get_thread_num.
+        thread_alloc_info* info = thread_info(thread);
+        info->count_requested_ -= node->request_;
+# ifndef NDEBUG
+        // pointer that was returned by get_memory
+        void* v_ptr          = reinterpret_cast<void*>(node + 1);
+# ifndef CPPAD_DEBUG_AND_RELEASE
+        // remove node from inuse list
+        void* v_node         = reinterpret_cast<void*>(node);
+        void** previous      = info->root_inuse_ + c_index;
+        while( (*previous != nullptr) & (*previous != v_node) )
+            previous = &( reinterpret_cast<block_t*>(*previous)->next_ );
 
-    \param thread_num_new [in]
-    If set is false, thread_num_new it is not used.
-    Otherwise, the current value of thread_num_new becomes the
-    most recent setting for thread_num.
+        // check that v_ptr is valid
+        if( *previous != v_node )
+        {   using std::endl;
+            std::ostringstream oss;
+            oss << "return_memory: attempt to return memory not in use";
+            oss << endl;
+            oss << "v_ptr    = " << v_ptr    << endl;
+            oss << "thread   = " << thread   << endl;
+            oss << "capacity = " << capacity << endl;
+            oss << "See CPPAD_TRACE_THREAD & CPPAD_TRACE_CAPACITY in";
+            oss << endl << "# include <cppad/utility/thread_alloc.hpp>" << endl;
+            // oss.str() returns a string object with a copy of the current
+            // contents in the stream buffer.
+            std::string msg_str       = oss.str();
+            // msg_str.c_str() returns a pointer to the c-string
+            // representation of the string object's value.
+            const char* msg_char_star = msg_str.c_str();
+            CPPAD_ASSERT_KNOWN(false, msg_char_star );
+        }
+        // remove v_ptr from inuse list
+        *previous        = node->next_;
+# endif
+        // trace option
+        if( capacity==CPPAD_TRACE_CAPACITY && thread==CPPAD_TRACE_THREAD )
+        {   std::cout << "return_memory: v_ptr = " << v_ptr << std::endl; }
 
-    \param set
-    If set is true, then thread_num_new is becomes the most
-    recent setting for this set_get_thread_num.
-    */
-    static size_t set_get_thread_num(
-        size_t (*thread_num_new)(void)  ,
-        bool set = false                )
-    {   static size_t (*thread_num_user)(void) = nullptr;
+# endif
+        // capacity bytes are removed from the inuse pool
+        dec_inuse(capacity, thread);
+        capacity_count_t& count = info->capacity_count_[c_index];
+        --count.num_inuse_;
 
-        if( set )
-        {   thread_num_user = thread_num_new;
-            return 0;
+        // check for case where we just return the memory to the system
+        if( ! set_get_hold_memory(false) )
+        {   free_block(node, thread);
+            return;
         }
 
-        if( thread_num_user == nullptr )
-            return 0;
+        // check for large block that would exceed the available watermark
+        size_t node_map_bytes = block_map_bytes(node);
+        if( node_map_bytes != 0 )
+        {   size_t large_max = set_get_large_max(false);
+            size_t mapped    = info->count_mapped_available_;
+            if( large_max < mapped || large_max - mapped < node_map_bytes )
+            {   free_block(node, thread);
+                return;
+            }
+            info->count_mapped_available_ += node_map_bytes;
+        }
 
-        size_t thread = thread_num_user();
-        CPPAD_ASSERT_KNOWN(
-            thread < set_get_num_threads(0) ,
-            "parallel_setup: thread_num() >= num_threads"
-        );
-        return thread;
-    }
-// ============================================================================
-public:
-/*
-$begin ta_parallel_setup$$
-$spell
-    alloc
-    num
-    bool
-$$
-$section Setup thread_alloc For Use in Multi-Threading Environment$$
+        // add this node to available list for this thread and capacity
+        node->next_                      = info->root_available_[c_index];
+        info->root_available_[c_index]   = reinterpret_cast<void*>(node);
 
+        // capacity bytes are added to the available pool
+        inc_available(capacity, thread);
+        ++count.num_available_;
+        count.last_use_ = ++info->count_use_;
 
+        // check for exceeding the maximum available bytes for this thread
+        size_t max_available = set_get_max_available(false);
+        if( max_available < info->count_available_ )
+            trim_thread(thread, max_available);
+    }
+    // -----------------------------------------------------------------------
+    /*!
+    Return available blocks to the system, least recently used capacity first.
 
+    \param thread [in]
+    is the thread that owns the blocks.
+    We must either be in sequential (not parallel) execution mode,
+    or this must be the current thread.
 
-$head Syntax$$
-$codei%thread_alloc::parallel_setup(%num_threads%, %in_parallel%, %thread_num%)
-%$$
+    \param target_bytes [in]
+    Blocks are returned until the number of available bytes for this
+    thread is less than or equal target_bytes.
 
-$head Purpose$$
-By default there is only one thread and all execution is in sequential mode,
-i.e., multiple threads are not sharing the same memory; i.e.
+    \return
+    is the number of bytes (capacity) that were returned to the system.
+    */
+    static size_t trim_thread(size_t thread, size_t target_bytes)
+    {   size_t num_cap              = capacity_info()->number;
+        const size_t* capacity_vec  = capacity_info()->value;
+        thread_alloc_info* info     = thread_info(thread);
+        size_t num_bytes            = 0;
+        while( target_bytes < info->count_available_ )
+        {   // least recently used capacity that has available blocks
+            size_t c_lru = num_cap;
+            for(size_t c_index = 0; c_index < num_cap; ++c_index)
+            {   const capacity_count_t& count = info->capacity_count_[c_index];
+                if( count.num_available_ > 0 )
+                {   bool older = c_lru == num_cap;
+                    if( ! older ) older =
+                        count.last_use_ < info->capacity_count_[c_lru].last_use_;
+                    if( older )
+                        c_lru = c_index;
+                }
+            }
+            CPPAD_ASSERT_UNKNOWN( c_lru < num_cap );
+            //
+            // return available blocks with this capacity to the system
+            size_t capacity         = capacity_vec[c_lru];
+            capacity_count_t& count = info->capacity_count_[c_lru];
+            void** available_root   = info->root_available_ + c_lru;
+            while( *available_root != nullptr &&
+                target_bytes < info->count_available_ )
+            {   block_t* node   = reinterpret_cast<block_t*>(*available_root);
+                *available_root = node->next_;
+                info->count_mapped_available_ -= block_map_bytes(node);
+                free_block(node, thread);
+                //
+                dec_available(capacity, thread);
+                --count.num_available_;
+                ++count.num_trim_;
+                num_bytes += capacity;
+            }
+        }
+        return num_bytes;
+    }
+    // -----------------------------------------------------------------------
+    /*!
+    Obtain a new block from the system.
+
+    \param cap_bytes [in]
+    is the capacity, in bytes, for the memory that follows the block header.
+
+    \param aligned [in]
+    If this is false, the header is at the front of memory obtained using
+    operator new. Otherwise, the memory following the header is
+    aligned to CPPAD_ALIGNED_BYTES bytes and,
+    if CPPAD_THREAD_ALLOC_MMAP is one and cap_bytes is greater than or equal
+    set_get_large_min, the memory is obtained using mmap.
+    In this case, if cap_bytes is at least CPPAD_HUGE_PAGE_BYTES,
+    the mapping starts on a multiple of CPPAD_HUGE_PAGE_BYTES
+    so that it can be backed by transparent huge pages.
+
+    \param thread [in]
+    is the thread that will own the block.
+
+    \return
+    is the header for the new block.
+    The has_raw_ field, and the raw_block_t information before the header
+    (when has_raw_ is true), are set by this routine.
+
+    \par NUMA
+    If set_get_numa_memory is true, blocks that are at least one page
+    are also obtained using mmap and the node for the current cpu is
+    preferred for their pages.
+    */
+    static block_t* new_block(size_t cap_bytes, bool aligned, size_t thread)
+    {   static_assert(
+            sizeof(raw_block_t) + sizeof(block_t) <= CPPAD_ALIGNED_BYTES,
+            "thread_alloc: block headers do not fit in CPPAD_ALIGNED_BYTES"
+        );
+        void*    raw       = nullptr;
+        size_t   map_bytes = 0;
+        bool     huge      = false;
+        block_t* node      = nullptr;
+# if CPPAD_THREAD_ALLOC_MMAP
+        // large blocks in aligned mode, and blocks that are at least one page
+        // in NUMA mode, are obtained using mmap
+        size_t page = size_t( sysconf(_SC_PAGESIZE) );
+        bool   numa = set_get_numa_memory(false);
+        bool   map  = aligned && cap_bytes >= set_get_large_min(false);
+        map         = map || ( numa && cap_bytes >= page );
+        if( map )
+        {   // pages are aligned and the header fits in the first
+            // CPPAD_ALIGNED_BYTES bytes
+            map_bytes   = CPPAD_ALIGNED_BYTES + cap_bytes;
+            map_bytes   = ( (map_bytes + page - 1) / page ) * page;
+            // extra bytes so the mapping can start on a huge page boundary
+            size_t extra = 0;
+            if( aligned && cap_bytes >= CPPAD_HUGE_PAGE_BYTES )
+                extra = CPPAD_HUGE_PAGE_BYTES;
+            raw         = mmap(
+                nullptr,
+                map_bytes + extra,
+                PROT_READ | PROT_WRITE,
+                MAP_PRIVATE | MAP_ANONYMOUS,
+                -1,
+                0
+            );
+            if( raw == MAP_FAILED )
+            {   // use operator new below
+                raw       = nullptr;
+                map_bytes = 0;
+            }
+            else
+            {   if( extra > 0 )
+                {   // unmap the pages before and after the aligned mapping
+                    char* low  = reinterpret_cast<char*>(raw);
+                    std::uintptr_t address =
+                        reinterpret_cast<std::uintptr_t>(raw) + extra - 1;
+                    address   -= address % CPPAD_HUGE_PAGE_BYTES;
+                    char* start = reinterpret_cast<char*>(address);
+                    size_t head = size_t(start - low);
+                    if( head > 0 )
+                        munmap(low, head);
+                    if( extra - head > 0 )
+                        munmap(start + map_bytes, extra - head);
+                    raw = reinterpret_cast<void*>(start);
+                }
+# ifdef MADV_HUGEPAGE
+                if( aligned )
+                {   madvise(raw, map_bytes, MADV_HUGEPAGE);
+                    huge = true;
+                }
+# endif
+                // prefer the node for this thread when pages are first touched
+                if( numa )
+                    numa_policy(raw, map_bytes, false, false);
+                //
+                char* v_ptr = reinterpret_cast<char*>(raw) + CPPAD_ALIGNED_BYTES;
+                node        = reinterpret_cast<block_t*>(v_ptr) - 1;
+                thread_info(thread)->count_mapped_ += map_bytes;
+                if( huge )
+                    thread_info(thread)->count_huge_ += map_bytes;
+            }
+        }
+# endif
+        if( node == nullptr && ! aligned )
+        {   // standard mode header (no raw_block_t information)
+            raw            = ::operator new(sizeof(block_t) + cap_bytes);
+            node           = reinterpret_cast<block_t*>(raw);
+            node->has_raw_ = false;
+            return node;
+        }
+        if( node == nullptr )
+        {   size_t header = sizeof(raw_block_t) + sizeof(block_t);
+            raw = ::operator new(header + CPPAD_ALIGNED_BYTES - 1 + cap_bytes);
+            std::uintptr_t address = reinterpret_cast<std::uintptr_t>(raw);
+            address += header + CPPAD_ALIGNED_BYTES - 1;
+            address -= address % CPPAD_ALIGNED_BYTES;
+            node     = reinterpret_cast<block_t*>(address) - 1;
+        }
+        CPPAD_ASSERT_UNKNOWN( raw != nullptr );
+        node->has_raw_         = true;
+        raw_block_t* raw_info  = raw_block(node);
+        raw_info->raw_         = raw;
+        raw_info->map_bytes_   = map_bytes;
+        raw_info->huge_        = huge;
+        return node;
+    }
+    // -----------------------------------------------------------------------
+    /*!
+    Return a block to the system.
+
+    \param node [in]
+    is the header for the block. It must have been created by new_block
+    and it must not be in the inuse or available lists.
+
+    \param thread [in]
+    is the thread that owns the block.
+    */
+    static void free_block(block_t* node, size_t thread)
+    {   if( ! node->has_raw_ )
+        {   ::operator delete( reinterpret_cast<void*>(node) );
+            return;
+        }
+        raw_block_t* raw_info = raw_block(node);
+# if CPPAD_THREAD_ALLOC_MMAP
+        size_t node_map_bytes = raw_info->map_bytes_;
+        if( node_map_bytes != 0 )
+        {   thread_info(thread)->count_mapped_ -= node_map_bytes;
+            if( raw_info->huge_ )
+                thread_info(thread)->count_huge_ -= node_map_bytes;
+            munmap(raw_info->raw_, node_map_bytes);
+            return;
+        }
+# else
+        (void) thread;
+# endif
+        ::operator delete(raw_info->raw_);
+    }
+    // -----------------------------------------------------------------------
+    /*!
+    Return the blocks, allocated by a thread, that other threads returned
+    during parallel execution.
+
+    \param thread [in]
+    is the thread that allocated the blocks.
+    We must either be in sequential (not parallel) execution mode,
+    or this must be the current thread.
+    */
+    static void drain_remote(size_t thread)
+    {   thread_alloc_info* info = thread_info(thread);
+        if( info->remote_free_.load(std::memory_order_relaxed) == nullptr )
+            return;
+        // take the entire list so there is no contention with other threads
+        void* v_node = info->remote_free_.exchange(
+            nullptr, std::memory_order_acquire
+        );
+        while( v_node != nullptr )
+        {   block_t* node = reinterpret_cast<block_t*>(v_node);
+            v_node        = node->remote_next_;
+            return_block(node);
+        }
+    }
+
+    // ----------------------------------------------------------------------
+    /*!
+    Set and get the number of threads that are sharing memory.
+
+    \param number_new
+    If number is zero, we are only retreiving the current maximum
+    number of threads. Otherwise, we are setting and retreiving
+    maximum number of threads.
+
+    \return
+    the number of threads that are sharing memory.
+    If number_new is non-zero, the return value is equal to
+    number_new.
+    */
+    static size_t set_get_num_threads(size_t number_new)
+    {   static size_t number_user = 1;
+
+        CPPAD_ASSERT_UNKNOWN( number_new <= CPPAD_MAX_NUM_THREADS );
+        CPPAD_ASSERT_UNKNOWN( ! in_parallel() || (number_new == 0) );
+
+        // case where we are changing the number of threads
+        if( number_new != 0 )
+            number_user = number_new;
+
+        return number_user;
+    }
+    /*!
+    Set and call the routine that determine the current thread number.
+
+    \return
+    returns value for the most recent setting for thread_num_new.
+    If set is true,
+    or the most recent setting is nullptr (its initial value),
+    the return value is zero.
+    Otherwise the routine corresponding to the most recent setting
+    is called and its value returned by set_get_thread_num.
+
+    \param thread_num_new [in]
+    If set is false, thread_num_new it is not used.
+    Otherwise, the current value of thread_num_new becomes the
+    most recent setting for thread_num.
+
+    \param set
+    If set is true, then thread_num_new is becomes the most
+    recent setting for this set_get_thread_num.
+    */
+    static size_t set_get_thread_num(
+        size_t (*thread_num_new)(void)  ,
+        bool set = false                )
+    {   static size_t (*thread_num_user)(void) = nullptr;
+
+        if( set )
+        {   thread_num_user = thread_num_new;
+            return 0;
+        }
+
+        if( thread_num_user == nullptr )
+            return 0;
+
+        size_t thread = thread_num_user();
+        CPPAD_ASSERT_KNOWN(
+            thread < set_get_num_threads(0) ,
+            "parallel_setup: thread_num() >= num_threads"
+        );
+        return thread;
+    }
+// ============================================================================
+public:
+/*
+$begin ta_parallel_setup$$
+$spell
+    alloc
+    num
+    bool
+$$
+$section Setup thread_alloc For Use in Multi-Threading Environment$$
+
+
+
+
+$head Syntax$$
+$codei%thread_alloc::parallel_setup(%num_threads%, %in_parallel%, %thread_num%)
+%$$
+
+$head Purpose$$
+By default there is only one thread and all execution is in sequential mode,
+i.e., multiple threads are not sharing the same memory; i.e.
 not in parallel mode.
 
 $head Speed$$
@@ -685,7 +1362,9 @@ $section Get At Least A Specified Amount of Memory$$
 
 
 $head Syntax$$
-$icode%v_ptr% = thread_alloc::get_memory(%min_bytes%, %cap_bytes%)%$$
+$icode%v_ptr% = thread_alloc::get_memory(%min_bytes%, %cap_bytes%)
+%$$
+$icode%v_ptr% = thread_alloc::get_huge_memory(%min_bytes%, %cap_bytes%)%$$
 
 $head Purpose$$
 Use $cref thread_alloc$$ to obtain a minimum number of bytes of memory
@@ -737,6 +1416,17 @@ We call a memory allocation aligned if the address is a multiple
 of the number of bytes in a $code size_t$$ value.
 If the system $code new$$ allocator is aligned, then $icode v_ptr$$
 pointer is also aligned.
+In $cref/aligned mode/ta_aligned_memory/Aligned Mode/$$,
+$icode v_ptr$$ is a multiple of 64 bytes.
+
+$head get_huge_memory$$
+This routine is the same as $code get_memory$$ except that it always uses
+the $cref/aligned mode/ta_aligned_memory/Aligned Mode/$$.
+Hence the
+$cref/large blocks/ta_aligned_memory/Aligned Mode/Large Blocks/$$
+it returns are advised to use transparent huge pages.
+This can be used for a few large arrays, that are accessed often,
+without changing the mode for all the other allocations.
 
 $head Example$$
 $cref thread_alloc.cpp$$
@@ -762,6 +1452,39 @@ $end
     pointer to the beginning of the memory allocated for use.
     */
     static void* get_memory(size_t min_bytes, size_t& cap_bytes)
+    {   bool aligned = set_get_aligned_memory(false);
+        return get_memory_mode(min_bytes, cap_bytes, aligned);
+    }
+    /*!
+    Use thread_alloc to get a specified amount of memory in aligned mode
+    (large blocks are advised to use huge pages).
+
+    \copydetails get_memory
+    */
+    static void* get_huge_memory(size_t min_bytes, size_t& cap_bytes)
+    {   bool aligned = true;
+        return get_memory_mode(min_bytes, cap_bytes, aligned);
+    }
+private:
+    /*!
+    Use thread_alloc to get a specified amount of memory in a specified mode.
+
+    \param min_bytes [in]
+    The minimum number of bytes of memory to be obtained for use.
+
+    \param cap_bytes [out]
+    The actual number of bytes of memory obtained for use.
+
+    \param aligned [in]
+    If true, the aligned mode is used for this allocation.
+    Otherwise the standard mode is used.
+
+    \return
+    pointer to the beginning of the memory allocated for use.
+    */
+    static void* get_memory_mode(
+        size_t min_bytes, size_t& cap_bytes, bool aligned
+    )
     {   // see first_trace below
         CPPAD_ASSERT_FIRST_CALL_NOT_PARALLEL;
 
@@ -778,17 +1501,39 @@ $end
         // determine the capacity for this request
         size_t c_index   = 0;
         const size_t* capacity_vec = capacity_info()->value;
-        while( capacity_vec[c_index] < min_bytes )
-        {   ++c_index;
-            CPPAD_ASSERT_UNKNOWN(c_index < num_cap );
+        size_t num_standard        = capacity_info()->number_standard;
+        if( aligned )
+        {   const size_t* ptr = std::lower_bound(
+                capacity_vec + num_standard, capacity_vec + num_cap, min_bytes
+            );
+            c_index = size_t(ptr - capacity_vec);
+            // use the standard capacities for very large requests
+            aligned = c_index < num_cap;
+            if( ! aligned )
+                c_index = 0;
+        }
+        if( ! aligned )
+        {   while( capacity_vec[c_index] < min_bytes )
+            {   ++c_index;
+                CPPAD_ASSERT_UNKNOWN(c_index < num_standard );
+            }
         }
         cap_bytes = capacity_vec[c_index];
 
         // determine the thread, capacity, and info for this thread
+        static_assert(
+            size_t(CPPAD_MAX_NUM_THREADS) * CPPAD_MAX_NUM_CAPACITY <=
+            size_t( std::numeric_limits<std::uint32_t>::max() ),
+            "thread_alloc: tc_index does not fit in block_t::tc_index_"
+        );
         size_t thread            = thread_num();
         size_t tc_index          = thread * num_cap + c_index;
         thread_alloc_info* info  = thread_info(thread);
 
+        // memory returned by other threads can now be used by this thread
+        if( info->remote_free_.load(std::memory_order_relaxed) != nullptr )
+            drain_remote(thread);
+
 # ifndef NDEBUG
         // trace allocation
         static bool first_trace = true;
@@ -804,27 +1549,33 @@ $end
 # ifndef CPPAD_DEBUG_AND_RELEASE
         // Root nodes for both lists. Note these are different for different
         // threads because tc_index is different for different threads.
-        block_t* inuse_root     = info->root_inuse_ + c_index;
+        void** inuse_root       = info->root_inuse_ + c_index;
 # endif
 # endif
-        block_t* available_root = info->root_available_ + c_index;
+        void** available_root   = info->root_available_ + c_index;
 
         // check if we already have a node we can use
-        void* v_node              = available_root->next_;
+        void* v_node              = *available_root;
         block_t* node             = reinterpret_cast<block_t*>(v_node);
         if( node != nullptr )
         {   CPPAD_ASSERT_UNKNOWN( node->tc_index_ == tc_index );
 
             // remove node from available list
-            available_root->next_ = node->next_;
+            *available_root       = node->next_;
+            info->count_mapped_available_ -= block_map_bytes(node);
+            capacity_count_t& count = info->capacity_count_[c_index];
+            --count.num_available_;
+            ++count.num_inuse_;
+            ++count.num_reuse_;
+            count.last_use_ = ++info->count_use_;
 
             // return value for get_memory
             void* v_ptr = reinterpret_cast<void*>(node + 1);
 # ifndef NDEBUG
 # ifndef CPPAD_DEBUG_AND_RELEASE
             // add node to inuse list
-            node->next_           = inuse_root->next_;
-            inuse_root->next_     = v_node;
+            node->next_           = *inuse_root;
+            *inuse_root           = v_node;
 # endif
 
             // trace allocation
@@ -836,6 +1587,8 @@ $end
             // adjust counts
             inc_inuse(cap_bytes, thread);
             dec_available(cap_bytes, thread);
+            node->request_          = min_bytes;
+            info->count_requested_ += min_bytes;
 
             // return pointer to memory, do not inclue thread_alloc information
             return v_ptr;
@@ -844,17 +1597,22 @@ $end
         // Create a new node with thread_alloc information at front.
         // This uses the system allocator, which is thread safe, but slower,
         // because the thread might wait for a lock on the allocator.
-        v_node          = ::operator new(sizeof(block_t) + cap_bytes);
-        CPPAD_ASSERT_UNKNOWN( v_node != nullptr );
-        node            = reinterpret_cast<block_t*>(v_node);
-        node->tc_index_ = tc_index;
+        node            = new_block(cap_bytes, aligned, thread);
+        v_node          = reinterpret_cast<void*>(node);
+        node->tc_index_ = std::uint32_t( tc_index );
+        node->request_  = min_bytes;
         void* v_ptr     = reinterpret_cast<void*>(node + 1);
+        info->count_requested_ += min_bytes;
+        capacity_count_t& count = info->capacity_count_[c_index];
+        ++count.num_inuse_;
+        ++count.num_new_;
+        count.last_use_ = ++info->count_use_;
 
 # ifndef NDEBUG
 # ifndef CPPAD_DEBUG_AND_RELEASE
         // add node to inuse list
-        node->next_       = inuse_root->next_;
-        inuse_root->next_ = v_node;
+        node->next_       = *inuse_root;
+        *inuse_root       = v_node;
 # endif
 
         // trace allocation
@@ -868,6 +1626,7 @@ $end
 
         return v_ptr;
     }
+public:
 
 /* -----------------------------------------------------------------------
 $begin ta_return_memory$$
@@ -899,10 +1658,20 @@ obtained by a previous call to
 $cref/get_memory/ta_get_memory/$$ and not yet returned.
 
 $head Thread$$
-Either the $cref/current thread/ta_thread_num/$$ must be the same as during
+The memory can be returned by any thread.
+
+$subhead Remote Free$$
+If the current execution mode is $cref/parallel/ta_in_parallel/$$ and the
+$cref/current thread/ta_thread_num/$$ is not the same as during
 the corresponding call to $cref/get_memory/ta_get_memory/$$,
-or the current execution mode must be sequential
-(not $cref/parallel/ta_in_parallel/$$).
+the memory is pushed onto a lock-free list for the thread that allocated it.
+That thread processes its list, as if it had called $code return_memory$$,
+during its next call to $cref/get_memory/ta_get_memory/$$,
+$cref/free_available/ta_free_available/$$,
+$cref/inuse/ta_inuse/$$, or $cref/available/ta_available/$$.
+Until then, the memory is counted as in use by the thread that allocated it.
+This enables memory to be allocated by one thread and returned by another,
+as is common for task based schedulers, without any locking.
 
 $head NDEBUG$$
 If $code NDEBUG$$ is defined, $icode v_ptr$$ is not checked (this is faster).
@@ -926,79 +1695,31 @@ $end
     After this call, this pointer will available (and not in use).
 
     \par
-    We must either be in sequential (not parallel) execution mode,
-    or the current thread must be the same as for the corresponding call
-    to get_memory.
+    If we are in parallel execution mode and the current thread is not
+    the same as for the corresponding call to get_memory, the memory is
+    pushed onto the remote free list for the thread that allocated it.
     */
     static void return_memory(void* v_ptr)
     {   size_t num_cap   = capacity_info()->number;
 
         block_t* node    = reinterpret_cast<block_t*>(v_ptr) - 1;
-        size_t tc_index  = node->tc_index_;
-        size_t thread    = tc_index / num_cap;
-        size_t c_index   = tc_index % num_cap;
-        size_t capacity  = capacity_info()->value[c_index];
-
+        size_t thread    = node->tc_index_ / num_cap;
         CPPAD_ASSERT_UNKNOWN( thread < CPPAD_MAX_NUM_THREADS );
-        CPPAD_ASSERT_KNOWN(
-            thread == thread_num() || (! in_parallel()),
-            "Attempt to return memory for a different thread "
-            "while in parallel mode"
-        );
-
-        thread_alloc_info* info = thread_info(thread);
-# ifndef NDEBUG
-# ifndef CPPAD_DEBUG_AND_RELEASE
-        // remove node from inuse list
-        void* v_node         = reinterpret_cast<void*>(node);
-        block_t* inuse_root  = info->root_inuse_ + c_index;
-        block_t* previous    = inuse_root;
-        while( (previous->next_ != nullptr) & (previous->next_ != v_node) )
-            previous = reinterpret_cast<block_t*>(previous->next_);
-
-        // check that v_ptr is valid
-        if( previous->next_ != v_node )
-        {   using std::endl;
-            std::ostringstream oss;
-            oss << "return_memory: attempt to return memory not in use";
-            oss << endl;
-            oss << "v_ptr    = " << v_ptr    << endl;
-            oss << "thread   = " << thread   << endl;
-            oss << "capacity = " << capacity << endl;
-            oss << "See CPPAD_TRACE_THREAD & CPPAD_TRACE_CAPACITY in";
-            oss << endl << "# include <cppad/utility/thread_alloc.hpp>" << endl;
-            // oss.str() returns a string object with a copy of the current
-            // contents in the stream buffer.
-            std::string msg_str       = oss.str();
-            // msg_str.c_str() returns a pointer to the c-string
-            // representation of the string object's value.
-            const char* msg_char_star = msg_str.c_str();
-            CPPAD_ASSERT_KNOWN(false, msg_char_star );
-        }
-        // remove v_ptr from inuse list
-        previous->next_  = node->next_;
-# endif
-        // trace option
-        if( capacity==CPPAD_TRACE_CAPACITY && thread==CPPAD_TRACE_THREAD )
-        {   std::cout << "return_memory: v_ptr = " << v_ptr << std::endl; }
-
-# endif
-        // capacity bytes are removed from the inuse pool
-        dec_inuse(capacity, thread);
 
-        // check for case where we just return the memory to the system
-        if( ! set_get_hold_memory(false) )
-        {   ::operator delete( reinterpret_cast<void*>(node) );
+        // memory allocated by a different thread during parallel execution
+        if( in_parallel() && thread != thread_num() )
+        {   // push this node onto the remote free list for its thread
+            thread_alloc_info* info = thread_info(thread);
+            void* v_node = reinterpret_cast<void*>(node);
+            void* head   = info->remote_free_.load(std::memory_order_relaxed);
+            do
+                node->remote_next_ = head;
+            while( ! info->remote_free_.compare_exchange_weak(
+                head, v_node, std::memory_order_release, std::memory_order_relaxed
+            ) );
             return;
         }
-
-        // add this node to available list for this thread and capacity
-        block_t* available_root = info->root_available_ + c_index;
-        node->next_             = available_root->next_;
-        available_root->next_   = reinterpret_cast<void*>(node);
-
-        // capacity bytes are added to the available pool
-        inc_available(capacity, thread);
+        return_block(node);
     }
 /* -----------------------------------------------------------------------
 $begin ta_free_available$$
@@ -1065,22 +1786,24 @@ $end
         size_t num_cap = capacity_info()->number;
         if( num_cap == 0 )
             return;
+        drain_remote(thread);
         const size_t*     capacity_vec  = capacity_info()->value;
         size_t c_index;
         thread_alloc_info* info = thread_info(thread);
         for(c_index = 0; c_index < num_cap; c_index++)
         {   size_t capacity = capacity_vec[c_index];
-            block_t* available_root = info->root_available_ + c_index;
-            void* v_ptr             = available_root->next_;
+            void* v_ptr             = info->root_available_[c_index];
             while( v_ptr != nullptr )
             {   block_t* node = reinterpret_cast<block_t*>(v_ptr);
                 void* next    = node->next_;
-                ::operator delete(v_ptr);
+                info->count_mapped_available_ -= block_map_bytes(node);
+                free_block(node, thread);
                 v_ptr         = next;
 
                 dec_available(capacity, thread);
             }
-            available_root->next_ = nullptr;
+            info->root_available_[c_index] = nullptr;
+            info->capacity_count_[c_index].num_available_ = 0;
         }
         CPPAD_ASSERT_UNKNOWN( available(thread) == 0 );
         if( inuse(thread) == 0 )
@@ -1133,6 +1856,362 @@ $end
         set_get_hold_memory(set, value);
     }
 
+/* -----------------------------------------------------------------------
+$begin ta_trim$$
+$spell
+    alloc
+    num
+$$
+
+$section Bound and Trim the Memory Held For Future Use$$
+
+$head Syntax$$
+$codei%thread_alloc::max_available(%max_bytes%)
+%$$
+$icode%num_bytes% = thread_alloc::trim(%target_bytes%)%$$
+
+$head Purpose$$
+If $cref/hold_memory/ta_hold_memory/$$ is true, all the memory returned
+by a thread is held for future use by that thread.
+After a peak in memory use, a long running program may hold a large amount
+of $cref/available/ta_available/$$ memory that is never used again.
+On the other hand,
+$cref/free_available/ta_free_available/$$ returns all of the available memory
+to the system, so the following allocations are slower.
+These routines keep the most useful part of the available memory.
+
+$head Least Recently Used$$
+Available memory is returned to the system one
+$cref/capacity/ta_capacity_stat/stat/capacity/$$ at a time.
+The capacity that was least recently obtained or returned by the thread
+is chosen first.
+
+$head max_bytes$$
+This argument has prototype
+$codei%
+    size_t %max_bytes%
+%$$
+It is the maximum number of bytes that each thread holds as available.
+If a thread returns memory and its available memory
+would exceed this value,
+the least recently used available memory is returned to the system
+until it is less than or equal $icode max_bytes$$.
+By default (when $code max_available$$ has not been called)
+$icode max_bytes$$ is the maximum $code size_t$$ value.
+This routine cannot be called in
+$cref/parallel/ta_in_parallel/$$ execution mode.
+
+$head target_bytes$$
+This argument has prototype
+$codei%
+    size_t %target_bytes%
+%$$
+The least recently used available memory is returned to the system
+until the available memory is less than or equal $icode target_bytes$$.
+In $cref/parallel/ta_in_parallel/$$ execution mode,
+only the memory available for the current thread is trimmed.
+Otherwise the memory available for each of the
+$cref/num_threads/ta_num_threads/$$ threads is trimmed.
+There is no background thread that trims the memory;
+a long running program can call $code trim$$ when it is idle,
+or after a peak in memory use.
+
+$head num_bytes$$
+The return value has prototype
+$codei%
+    size_t %num_bytes%
+%$$
+It is the number of bytes that were returned to the system by this call.
+
+$head Statistics$$
+See $cref ta_capacity_stat$$ for the number of blocks
+that were trimmed for each capacity.
+
+$head Example$$
+$cref thread_alloc.cpp$$
+
+$end
+*/
+    /*!
+    Change the maximum number of bytes held as available by each thread.
+
+    \param max_bytes [in]
+    New value for the maximum number of available bytes.
+    */
+    static void max_available(size_t max_bytes)
+    {   CPPAD_ASSERT_KNOWN(
+            ! in_parallel() ,
+            "thread_alloc::max_available: in parallel mode."
+        );
+        bool set = true;
+        set_get_max_available(set, max_bytes);
+    }
+    /*!
+    Return the least recently used available memory to the system.
+
+    \param target_bytes [in]
+    Memory is returned until the available memory for each thread that is
+    trimmed is less than or equal target_bytes.
+
+    \return
+    is the number of bytes that were returned to the system.
+    */
+    static size_t trim(size_t target_bytes)
+    {   size_t num_bytes = 0;
+        if( in_parallel() )
+        {   size_t thread = thread_num();
+            drain_remote(thread);
+            num_bytes += trim_thread(thread, target_bytes);
+            return num_bytes;
+        }
+        size_t n_thread = num_threads();
+        for(size_t thread = 0; thread < n_thread; ++thread)
+        {   drain_remote(thread);
+            num_bytes += trim_thread(thread, target_bytes);
+        }
+        return num_bytes;
+    }
+
+/* -----------------------------------------------------------------------
+$begin ta_aligned_memory$$
+$spell
+    alloc
+    num
+    mmap
+    madvise
+    SIMD
+$$
+
+$section Control Size Classes, Alignment, and Large Blocks$$
+
+$head Syntax$$
+$codei%thread_alloc::aligned_memory(%value%)
+%$$
+$codei%thread_alloc::large_memory(%min_bytes%, %max_available%)
+%$$
+
+$head Purpose$$
+By default $cref/get_memory/ta_get_memory/$$ rounds each request
+up to a capacity in a sequence where each capacity is about 3/2 times
+the previous one. This can waste up to one third of the memory
+and the alignment is the same as for the system $code new$$ operator.
+The aligned mode uses finer capacities, returns memory that is
+aligned for SIMD instructions, and can get large blocks directly
+from the operating system.
+
+$head value$$
+If $icode value$$ is true, future calls to
+$cref/get_memory/ta_get_memory/$$ use the aligned mode.
+If it is false, future calls use the standard mode.
+By default (when $code aligned_memory$$ has not been called)
+the standard mode is used.
+Memory obtained in either mode can be returned in either mode.
+
+$head Aligned Mode$$
+
+$subhead Capacities$$
+The capacities less than or equal 1024 bytes are multiples of 64 bytes.
+Above 1024 there are four capacities between each power of two;
+e.g., 1280, 1536, 1792, 2048, 2560, ... .
+Hence the memory wasted by rounding up is at most
+25 percent of the capacity.
+
+$subhead Alignment$$
+The address returned by $code get_memory$$ is a multiple of 64 bytes.
+
+$subhead Large Blocks$$
+On Linux systems,
+blocks with capacity greater than or equal $icode min_bytes$$
+are obtained using $code mmap$$ and are advised to use
+transparent huge pages (using $code madvise$$).
+If a block is at least two megabytes, its mapping starts on a
+multiple of two megabytes so that it can be completely covered by huge pages.
+On other systems they are obtained using the $code new$$ operator.
+
+$head min_bytes$$
+This is the minimum capacity, in bytes, for a large block.
+By default (when $code large_memory$$ has not been called)
+it is two megabytes.
+
+$head max_available$$
+If $cref/hold_memory/ta_hold_memory/$$ is true and a large block is
+returned, it is kept in the $cref/available/ta_available/$$ pool
+as long as the mapped bytes available for the thread do not exceed
+$icode max_available$$.
+Otherwise the large block is returned to the operating system.
+By default (when $code large_memory$$ has not been called)
+$icode max_available$$ is the maximum $code size_t$$ value.
+
+$head Restrictions$$
+These routines cannot be called in
+$cref/parallel/ta_in_parallel/$$ execution mode.
+
+$head Statistics$$
+See $cref ta_requested$$ for the statistics that show
+the fragmentation and the large block usage.
+
+$head Example$$
+$cref thread_alloc.cpp$$
+
+$end
+*/
+    /*!
+    Change the thread_alloc aligned memory setting.
+
+    \param value [in]
+    New value for the thread_alloc aligned memory setting.
+    */
+    static void aligned_memory(bool value)
+    {   CPPAD_ASSERT_KNOWN(
+            ! in_parallel() ,
+            "thread_alloc::aligned_memory: in parallel mode."
+        );
+        bool set = true;
+        set_get_aligned_memory(set, value);
+    }
+    /*!
+    Change the thread_alloc large block settings.
+
+    \param min_bytes [in]
+    Minimum capacity for blocks that are obtained using mmap.
+
+    \param max_available [in]
+    Maximum number of mapped bytes held as available for each thread.
+    */
+    static void large_memory(size_t min_bytes, size_t max_available)
+    {   CPPAD_ASSERT_KNOWN(
+            ! in_parallel() ,
+            "thread_alloc::large_memory: in parallel mode."
+        );
+        bool set = true;
+        set_get_large_min(set, min_bytes);
+        set_get_large_max(set, max_available);
+    }
+
+/* -----------------------------------------------------------------------
+$begin ta_numa_memory$$
+$spell
+    alloc
+    num
+    mmap
+    mbind
+    libnuma
+    ptr
+    cpu
+    Taylor
+$$
+
+$section Non-Uniform Memory Access (NUMA) Placement$$
+
+$head Syntax$$
+$codei%thread_alloc::numa_memory(%value%)
+%$$
+$icode%num_interleave% = thread_alloc::numa_interleave(%v_ptr%, %num_bytes%)%$$
+
+$head Purpose$$
+On systems with more than one NUMA node (e.g., more than one socket),
+memory that is on a different node than the cpu using it is slower.
+These routines use the Linux $code mbind$$ system call directly
+(there is no dependence on the $code libnuma$$ library).
+On other systems they have no effect.
+
+$head numa_memory$$
+If $icode value$$ is true, future blocks that are at least one page
+are obtained using $code mmap$$ and the node for the cpu
+that is executing the allocating thread is preferred for their pages.
+The pages are placed when they are first touched,
+so memory used for Taylor coefficients and other per thread work space
+is local to the thread that uses it
+(as long as the thread does not migrate to another node).
+By default (when $code numa_memory$$ has not been called)
+this placement is not done.
+This routine cannot be called in
+$cref/parallel/ta_in_parallel/$$ execution mode.
+
+$head numa_interleave$$
+This routine interleaves the pages in the specified memory
+across all the nodes that this process can use.
+Pages that have already been touched are moved.
+This is useful for memory that is read, but not written, by threads
+on different nodes; e.g., see $cref numa_interleave$$.
+
+$subhead v_ptr$$
+This argument has prototype
+$codei%
+    void* %v_ptr%
+%$$
+It is the beginning of the memory.
+
+$subhead num_bytes$$
+This argument has prototype
+$codei%
+    size_t %num_bytes%
+%$$
+It is the number of bytes in the memory.
+
+$subhead num_interleave$$
+The return value has prototype
+$codei%
+    size_t %num_interleave%
+%$$
+It is the number of bytes that were interleaved.
+Only the pages that are completely inside the specified memory are
+interleaved, so this is less than $icode num_bytes$$.
+It is zero if the system does not support NUMA policies.
+
+$head Example$$
+$cref numa_interleave.cpp$$
+
+$end
+*/
+    /*!
+    Change the thread_alloc NUMA memory setting.
+
+    \param value [in]
+    New value for the thread_alloc NUMA memory setting.
+    */
+    static void numa_memory(bool value)
+    {   CPPAD_ASSERT_KNOWN(
+            ! in_parallel() ,
+            "thread_alloc::numa_memory: in parallel mode."
+        );
+        bool set = true;
+        set_get_numa_memory(set, value);
+    }
+    /*!
+    Interleave the pages in a range of memory across the NUMA nodes.
+
+    \param v_ptr [in]
+    is the beginning of the memory.
+
+    \param num_bytes [in]
+    is the number of bytes in the memory.
+
+    \return
+    is the number of bytes in the pages that are inside the memory
+    and were interleaved.
+    */
+    static size_t numa_interleave(void* v_ptr, size_t num_bytes)
+    {
+# if CPPAD_THREAD_ALLOC_NUMA
+        size_t page         = size_t( sysconf(_SC_PAGESIZE) );
+        std::uintptr_t low  = reinterpret_cast<std::uintptr_t>(v_ptr);
+        std::uintptr_t high = low + num_bytes;
+        low                 = ( (low + page - 1) / page ) * page;
+        high                = ( high / page ) * page;
+        if( high <= low )
+            return 0;
+        void* v_low = reinterpret_cast<void*>(low);
+        if( ! numa_policy(v_low, size_t(high - low), true, true) )
+            return 0;
+        return size_t(high - low);
+# else
+        (void) v_ptr;
+        (void) num_bytes;
+        return 0;
+# endif
+    }
+
 /* -----------------------------------------------------------------------
 $begin ta_inuse$$
 $spell
@@ -1168,6 +2247,9 @@ $codei%
     size_t %num_bytes%
 %$$
 It is the number of bytes currently in use by the specified thread.
+Memory allocated by this thread, and returned by other threads
+(see $cref/remote free/ta_return_memory/Thread/Remote Free/$$),
+is processed before this value is determined.
 
 $head Example$$
 $cref thread_alloc.cpp$$
@@ -1192,6 +2274,7 @@ $end
         CPPAD_ASSERT_UNKNOWN(
             thread == thread_num() || (! in_parallel())
         );
+        drain_remote(thread);
         thread_alloc_info* info = thread_info(thread);
         return info->count_inuse_;
     }
@@ -1246,10 +2329,264 @@ $end
         CPPAD_ASSERT_UNKNOWN(
             thread == thread_num() || (! in_parallel())
         );
+        drain_remote(thread);
         thread_alloc_info* info = thread_info(thread);
         return info->count_available_;
     }
 /* -----------------------------------------------------------------------
+$begin ta_requested$$
+$spell
+    num
+    inuse
+    thread_alloc
+    mmap
+    meminfo
+    proc
+    Anon
+$$
+
+$section Memory Statistics for a Thread$$
+
+$head Syntax$$
+$icode%num_bytes% = thread_alloc::requested(%thread%)
+%$$
+$icode%num_bytes% = thread_alloc::mapped(%thread%)
+%$$
+$icode%num_bytes% = thread_alloc::huge(%thread%)%$$
+
+$head Purpose$$
+These functions report how well the memory managed by
+$cref thread_alloc$$ is being used.
+
+$head thread$$
+This argument has prototype
+$codei%
+    size_t %thread%
+%$$
+Either $cref/thread_num/ta_thread_num/$$ must be the same as $icode thread$$,
+or the current execution mode must be sequential
+(not $cref/parallel/ta_in_parallel/$$).
+
+$head requested$$
+The return value is the sum of the $icode min_bytes$$ arguments
+to $cref/get_memory/ta_get_memory/$$
+for the memory currently in use by the specified thread.
+The difference
+$codei%
+    thread_alloc::inuse(%thread%) - thread_alloc::requested(%thread%)
+%$$
+is the number of bytes lost to fragmentation; i.e.,
+to rounding requests up to a capacity.
+
+$head mapped$$
+The return value is the number of bytes, for the specified thread,
+that were obtained using $code mmap$$
+(see $cref/large blocks/ta_aligned_memory/Aligned Mode/Large Blocks/$$
+and $cref/numa_memory/ta_numa_memory/numa_memory/$$).
+This includes memory that is in use and memory that is available.
+
+$head huge$$
+The return value is the number of bytes, in the $icode mapped$$ memory,
+that start on a huge page boundary and were advised to use
+transparent huge pages
+(see $cref/get_huge_memory/ta_get_memory/get_huge_memory/$$).
+Whether the operating system actually uses huge pages for this memory
+depends on its configuration; e.g., on Linux see the
+$code AnonHugePages$$ entry in $code /proc/meminfo$$.
+
+$head Example$$
+$cref thread_alloc.cpp$$
+
+$end
+*/
+    /*!
+    Determine the amount of memory requested for the memory inuse.
+
+    \copydetails inuse
+    */
+    static size_t requested(size_t thread)
+    {
+        CPPAD_ASSERT_UNKNOWN( thread < CPPAD_MAX_NUM_THREADS);
+        CPPAD_ASSERT_UNKNOWN(
+            thread == thread_num() || (! in_parallel())
+        );
+        drain_remote(thread);
+        thread_alloc_info* info = thread_info(thread);
+        return info->count_requested_;
+    }
+    /*!
+    Determine the amount of memory obtained using mmap.
+
+    \copydetails inuse
+    */
+    static size_t mapped(size_t thread)
+    {
+        CPPAD_ASSERT_UNKNOWN( thread < CPPAD_MAX_NUM_THREADS);
+        CPPAD_ASSERT_UNKNOWN(
+            thread == thread_num() || (! in_parallel())
+        );
+        drain_remote(thread);
+        thread_alloc_info* info = thread_info(thread);
+        return info->count_mapped_;
+    }
+    /*!
+    Determine the amount of memory obtained using mmap that is advised
+    to use huge pages.
+
+    \copydetails inuse
+    */
+    static size_t huge(size_t thread)
+    {
+        CPPAD_ASSERT_UNKNOWN( thread < CPPAD_MAX_NUM_THREADS);
+        CPPAD_ASSERT_UNKNOWN(
+            thread == thread_num() || (! in_parallel())
+        );
+        drain_remote(thread);
+        thread_alloc_info* info = thread_info(thread);
+        return info->count_huge_;
+    }
+/* -----------------------------------------------------------------------
+$begin ta_capacity_stat$$
+$spell
+    num
+    inuse
+    thread_alloc
+    stat
+$$
+
+$section Memory Statistics for Each Capacity$$
+
+$head Syntax$$
+$icode%n_capacity% = thread_alloc::num_capacity()
+%$$
+$icode%stat% = thread_alloc::capacity_stat(%thread%, %index%)%$$
+
+$head Purpose$$
+The $cref/get_memory/ta_get_memory/$$ routine rounds each request
+up to one of a fixed set of capacities.
+These functions report the use of the memory for each capacity.
+
+$head n_capacity$$
+The return value has prototype
+$codei%
+    size_t %n_capacity%
+%$$
+It is the number of different capacities.
+
+$head thread$$
+This argument has prototype
+$codei%
+    size_t %thread%
+%$$
+Either $cref/thread_num/ta_thread_num/$$ must be the same as $icode thread$$,
+or the current execution mode must be sequential
+(not $cref/parallel/ta_in_parallel/$$).
+
+$head index$$
+This argument has prototype
+$codei%
+    size_t %index%
+%$$
+and is less than $icode n_capacity$$.
+It specifies the capacity for the statistics.
+
+$head stat$$
+The return value has prototype
+$codei%
+    thread_alloc::capacity_stat_t %stat%
+%$$
+It has the following $code size_t$$ fields,
+for the specified thread and capacity:
+
+$subhead capacity$$
+The number of bytes in each block with this capacity.
+This does not depend on $icode thread$$.
+The $cref/aligned mode/ta_aligned_memory/$$ uses a different set of
+capacities, with larger indices, so the same number of bytes may
+correspond to two values of $icode index$$.
+
+$subhead num_inuse$$
+The number of blocks that are in use.
+
+$subhead num_available$$
+The number of blocks that are available.
+
+$subhead num_reuse$$
+The number of $code get_memory$$ calls that used an available block.
+
+$subhead num_new$$
+The number of $code get_memory$$ calls that obtained a block from the system.
+
+$subhead num_trim$$
+The number of available blocks that were returned to the system
+by $cref/max_available/ta_trim/max_bytes/$$ and $cref/trim/ta_trim/$$.
+
+$head Reset$$
+The $icode num_available$$ statistic is set to zero when
+$cref/free_available/ta_free_available/$$ returns the available memory
+for a thread to the system.
+The other statistics are only reset to zero when
+$code free_available$$ is called and
+$cref/inuse/ta_inuse/$$ for the thread is zero; i.e.,
+when all of the memory information for the thread is cleared.
+
+$head Example$$
+$cref thread_alloc.cpp$$
+
+$end
+*/
+    /// statistics for one capacity and one thread; see ta_capacity_stat
+    struct capacity_stat_t {
+        /// number of bytes in each block with this capacity
+        size_t capacity;
+        /// number of blocks that are in use
+        size_t num_inuse;
+        /// number of blocks that are available
+        size_t num_available;
+        /// number of get_memory calls that used an available block
+        size_t num_reuse;
+        /// number of get_memory calls that obtained a block from the system
+        size_t num_new;
+        /// number of available blocks returned to the system by trimming
+        size_t num_trim;
+    };
+    /// number of different capacities
+    static size_t num_capacity(void)
+    {   return capacity_info()->number; }
+    /*!
+    Statistics for one capacity and one thread.
+
+    \param thread [in]
+    Thread for which we are determining the statistics.
+
+    \param index [in]
+    Index of the capacity (must be less than num_capacity()).
+
+    \return
+    the statistics for this thread and capacity.
+    */
+    static capacity_stat_t capacity_stat(size_t thread, size_t index)
+    {   CPPAD_ASSERT_UNKNOWN( thread < CPPAD_MAX_NUM_THREADS);
+        CPPAD_ASSERT_UNKNOWN(
+            thread == thread_num() || (! in_parallel())
+        );
+        CPPAD_ASSERT_KNOWN(
+            index < num_capacity(),
+            "thread_alloc::capacity_stat: index >= num_capacity()"
+        );
+        drain_remote(thread);
+        const capacity_count_t& count =
+            thread_info(thread)->capacity_count_[index];
+        capacity_stat_t stat;
+        stat.capacity      = capacity_info()->value[index];
+        stat.num_inuse     = count.num_inuse_;
+        stat.num_available = count.num_available_;
+        stat.num_reuse     = count.num_reuse_;
+        stat.num_new       = count.num_new_;
+        stat.num_trim      = count.num_trim_;
+        return stat;
+    }
+/* -----------------------------------------------------------------------
 $begin ta_create_array$$
 $spell
     inuse
@@ -1509,7 +2846,12 @@ $end
 } // END_CPPAD_NAMESPACE
 
 // preprocessor symbols local to this file
+# undef CPPAD_ALIGNED_BYTES
+# undef CPPAD_ALIGNED_SMALL_BYTES
+# undef CPPAD_HUGE_PAGE_BYTES
 # undef CPPAD_MAX_NUM_CAPACITY
+# undef CPPAD_THREAD_ALLOC_MMAP
+# undef CPPAD_THREAD_ALLOC_NUMA
 # undef CPPAD_MIN_DOUBLE_CAPACITY
 # undef CPPAD_TRACE_CAPACITY
 # undef CPPAD_TRACE_THREAD
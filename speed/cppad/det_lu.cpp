@@ -56,7 +56,7 @@ bool link_det_lu(
 
     // --------------------------------------------------------------------
     // check global options
-    const char* valid[] = { "memory", "optimize"};
+    const char* valid[] = { "memory", "hugepage", "optimize", "fused"};
     size_t n_valid = sizeof(valid) / sizeof(valid[0]);
     typedef std::map<std::string, bool>::iterator iterator;
     //
@@ -90,6 +90,9 @@ bool link_det_lu(
     CppAD::vector<double> w(1);
     w[0] = 1.;
 
+    // determinant value (used when fused is present)
+    CppAD::vector<double> y(1);
+
     // do not even record comparison operators
     size_t abort_op_index = 0;
     bool record_compare   = false;
@@ -111,10 +114,16 @@ bool link_det_lu(
         f.Dependent(A, detA);
         if( global_option["optimize"] )
             f.optimize(optimize_options);
+        if( global_option["hugepage"] )
+            f.huge_page(true);
 
         // evaluate and return gradient using reverse mode
-        f.Forward(0, matrix);
-        gradient = f.Reverse(1, w);
+        if( global_option["fused"] )
+            f.value_and_gradient(matrix, w, y, gradient);
+        else
+        {   f.Forward(0, matrix);
+            gradient = f.Reverse(1, w);
+        }
     }
     size_t thread                   = CppAD::thread_alloc::thread_num();
     global_cppad_thread_alloc_inuse = CppAD::thread_alloc::inuse(thread);
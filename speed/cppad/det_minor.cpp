@@ -86,6 +86,10 @@ namespace {
                 "no_conditional_skip no_compare_op no_print_for_op";
             f.optimize(optimize_options);
         }
+        //
+        // huge page allocation policy
+        if( global_option["hugepage"] )
+            f.huge_page(true);
 
     }
 
@@ -101,7 +105,9 @@ bool link_det_minor(
 
     // --------------------------------------------------------------------
     // check global options
-    const char* valid[] = { "memory", "onetape", "optimize"};
+    const char* valid[] = {
+        "memory", "hugepage", "onetape", "optimize", "fused"
+    };
     size_t n_valid = sizeof(valid) / sizeof(valid[0]);
     typedef std::map<std::string, bool>::iterator iterator;
     //
@@ -129,6 +135,9 @@ bool link_det_minor(
     CppAD::vector<double> w(1);
     w[0] = 1.;
     //
+    // determinant value (used when fused is present)
+    CppAD::vector<double> y(1);
+    //
     // onetape
     bool onetape = global_option["onetape"];
     // -----------------------------------------------------------------------
@@ -162,8 +171,12 @@ bool link_det_minor(
         CppAD::uniform_01(nx, matrix);
 
         // evaluate the gradient
-        static_f.Forward(0, matrix);
-        gradient = static_f.Reverse(1, w);
+        if( global_option["fused"] )
+            static_f.value_and_gradient(matrix, w, y, gradient);
+        else
+        {   static_f.Forward(0, matrix);
+            gradient = static_f.Reverse(1, w);
+        }
     }
     size_t thread                   = CppAD::thread_alloc::thread_num();
     global_cppad_thread_alloc_inuse = CppAD::thread_alloc::inuse(thread);
@@ -57,7 +57,9 @@ bool link_mat_mul(
 
     // --------------------------------------------------------------------
     // check global options
-    const char* valid[] = { "memory", "onetape", "optimize", "atomic"};
+    const char* valid[] = {
+        "memory", "hugepage", "onetape", "optimize", "atomic"
+    };
     size_t n_valid = sizeof(valid) / sizeof(valid[0]);
     typedef std::map<std::string, bool>::iterator iterator;
     //
@@ -131,6 +133,8 @@ bool link_mat_mul(
 
         if( global_option["optimize"] )
             f.optimize(optimize_options);
+        if( global_option["hugepage"] )
+            f.huge_page(true);
 
         // skip comparison operators
         f.compare_change_count(0);
@@ -168,6 +172,8 @@ bool link_mat_mul(
 
         if( global_option["optimize"] )
             f.optimize(optimize_options);
+        if( global_option["hugepage"] )
+            f.huge_page(true);
 
         // skip comparison operators
         f.compare_change_count(0);
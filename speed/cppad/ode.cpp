@@ -58,7 +58,7 @@ bool link_ode(
 
     // --------------------------------------------------------------------
     // check global options
-    const char* valid[] = { "memory", "onetape", "optimize"};
+    const char* valid[] = { "memory", "hugepage", "onetape", "optimize"};
     size_t n_valid = sizeof(valid) / sizeof(valid[0]);
     typedef std::map<std::string, bool>::iterator iterator;
     //
@@ -112,6 +112,8 @@ bool link_ode(
 
         if( global_option["optimize"] )
             f.optimize(optimize_options);
+        if( global_option["hugepage"] )
+            f.huge_page(true);
 
         // skip comparison operators
         f.compare_change_count(0);
@@ -135,6 +137,8 @@ bool link_ode(
 
         if( global_option["optimize"] )
             f.optimize(optimize_options);
+        if( global_option["hugepage"] )
+            f.huge_page(true);
 
         // skip comparison operators
         f.compare_change_count(0);
@@ -63,7 +63,7 @@ bool link_poly(
 
     // --------------------------------------------------------------------
     // check global options
-    const char* valid[] = { "memory", "onetape", "optimize"};
+    const char* valid[] = { "memory", "hugepage", "onetape", "optimize"};
     size_t n_valid = sizeof(valid) / sizeof(valid[0]);
     typedef std::map<std::string, bool>::iterator iterator;
     //
@@ -129,6 +129,8 @@ bool link_poly(
 
         if( global_option["optimize"] )
             f.optimize(optimize_options);
+        if( global_option["hugepage"] )
+            f.huge_page(true);
 
         // skip comparison operators
         f.compare_change_count(0);
@@ -163,6 +165,8 @@ bool link_poly(
 
         if( global_option["optimize"] )
             f.optimize(optimize_options);
+        if( global_option["hugepage"] )
+            f.huge_page(true);
 
         // skip comparison operators
         f.compare_change_count(0);
@@ -103,6 +103,8 @@ namespace {
             //
             if( global_option["optimize"] )
                 fun.optimize(optimize_options);
+            if( global_option["hugepage"] )
+                fun.huge_page(true);
             //
             // skip comparison operators
             fun.compare_change_count(0);
@@ -138,6 +140,8 @@ namespace {
         //
         if( global_option["optimize"] )
             fun.optimize(optimize_options);
+        if( global_option["hugepage"] )
+            fun.huge_page(true);
         //
         // skip comparison operators
         fun.compare_change_count(0);
@@ -302,7 +306,8 @@ bool link_sparse_hessian(
     // --------------------------------------------------------------------
     // check global options
     const char* valid[] = {
-        "memory", "onetape", "optimize", "hes2jac", "subgraph",
+        "memory", "hugepage", "onetape", "optimize", "hes2jac",
+        "subgraph",
         "boolsparsity", "revsparsity", "symmetric"
 # if CPPAD_HAS_COLPACK
         , "colpack"
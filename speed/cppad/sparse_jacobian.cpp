@@ -148,6 +148,8 @@ namespace {
         //
         if( global_option["optimize"] )
             f.optimize(optimize_options);
+        if( global_option["hugepage"] )
+            f.huge_page(true);
         //
         // coloring method
         std::string coloring = "cppad";
@@ -207,7 +209,7 @@ bool link_sparse_jacobian(
     // --------------------------------------------------------------------
     // check global options
     const char* valid[] = {
-        "memory", "onetape", "optimize", "subgraph",
+        "memory", "hugepage", "onetape", "optimize", "subgraph",
         "boolsparsity", "revsparsity", "subsparsity"
 # if CPPAD_HAS_COLPACK
         , "colpack"
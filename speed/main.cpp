@@ -80,6 +80,9 @@ $spell
     lu
     Jacobian
     cppadcg
+    hugepage
+    Taylor
+    dTLB
 $$
 
 
@@ -206,6 +209,16 @@ If it is not present, CppAD will used standard memory allocation.
 Another package might use this option for a different
 memory allocation method.
 
+$subhead hugepage$$
+If this option is present, the $cref huge_page$$ allocation policy
+is turned on for the $code ADFun$$ objects used by the CppAD speed tests.
+Hence their large arrays
+(the operation sequence and Taylor coefficients)
+are advised to use transparent huge pages.
+Running a test with and without this option, using a program
+that reads the hardware counters (e.g., $code perf stat -e dTLB-load-misses$$),
+shows the change in the TLB misses.
+
 $subhead optimize$$
 If this option is present,
 CppAD will $cref optimize$$
@@ -239,6 +252,16 @@ test is implemented for this option.
 In addition, the CppAD $cref/sparse_hessian/link_sparse_hessian/$$
 test is implemented for this option when $code hes2jac$$ is present.
 
+$subhead fused$$
+If this option is present,
+$cref speed_cppad$$ will compute the function value and gradient using
+$cref value_and_gradient$$ instead of
+$cref/Forward(0, x)/forward_zero/$$ followed by
+$cref/Reverse(1, w)/reverse_one/$$.
+So far, CppAD has only implemented
+the $cref/det_lu/link_det_lu/$$ and $cref/det_minor/link_det_minor/$$
+tests in this manner.
+
 $head Sparsity Options$$
 The following options only apply to the
 $cref/sparse_jacobian/link_sparse_jacobian/$$ and
@@ -387,11 +410,13 @@ namespace {
     using std::endl;
     const char* option_list[] = {
         "memory",
+        "hugepage",
         "onetape",
         "optimize",
         "atomic",
         "hes2jac",
         "subgraph",
+        "fused",
         "boolsparsity",
         "revsparsity",
         "subsparsity",
@@ -84,11 +84,121 @@ bool adfun_swap(void)
     return ok;
 }
 
+// f(x) = sum_{k=0}^{N-1} (x[0] + k) * x[1]
+bool adfun_arg_byte_case(size_t N, size_t arg_byte)
+{   bool ok = true;
+    using CppAD::AD;
+    double eps = 100. * std::numeric_limits<double>::epsilon();
+    //
+    // Independent variables
+    CPPAD_TESTVECTOR( AD<double> ) ax(2);
+    ax[0] = 1.0;
+    ax[1] = 2.0;
+    CppAD::Independent(ax);
+    //
+    // Dependent variables
+    CPPAD_TESTVECTOR( AD<double> ) ay(1);
+    ay[0] = 0.0;
+    for(size_t k = 0; k < N; ++k)
+        ay[0] += (ax[0] + double(k)) * ax[1];
+    CppAD::ADFun<double> f(ax, ay);
+    ok &= f.size_op_arg_byte() == sizeof(CPPAD_TAPE_ADDR_TYPE);
+    //
+    // arguments are only packed when requested
+    f.pack_arg(true);
+    ok &= f.size_op_arg_byte() == arg_byte;
+    //
+    // check results before and after optimization (which uses CSumOp)
+    // and with and without compression
+    for(size_t i_case = 0; i_case < 4; ++i_case)
+    {   if( i_case == 2 )
+        {   f.decompress();
+            ok &= f.size_op_arg_byte() == arg_byte;
+            f.optimize();
+            ok &= f.size_op_arg_byte() <= arg_byte;
+        }
+        if( i_case % 2 == 1 )
+        {   size_t size_op_seq = f.size_op_seq();
+            f.compress();
+            ok &= f.compressed();
+            ok &= f.size_op_seq() < size_op_seq;
+            ok &= f.size_op_seq_decompressed() == size_op_seq;
+        }
+        CPPAD_TESTVECTOR(double) x(2), y(1), w(1), dw(2);
+        x[0] = 3.0;
+        x[1] = 4.0;
+        y    = f.Forward(0, x);
+        w[0] = 1.0;
+        dw   = f.Reverse(1, w);
+        double sum_k = double(N * (N - 1) / 2);
+        double check = double(N) * x[0] * x[1] + sum_k * x[1];
+        ok &= CppAD::NearEqual(y[0], check, eps, eps);
+        check = double(N) * x[1];
+        ok &= CppAD::NearEqual(dw[0], check, eps, eps);
+        check = double(N) * x[0] + sum_k;
+        ok &= CppAD::NearEqual(dw[1], check, eps, eps);
+        //
+        // sparsity patterns
+        CPPAD_TESTVECTOR(bool) r(4), s(1), pattern(2);
+        r[0] = r[3] = true;
+        r[1] = r[2] = false;
+        pattern = f.ForSparseJac(2, r);
+        ok &= pattern[0] && pattern[1];
+        s[0] = true;
+        pattern = f.RevSparseJac(1, s);
+        ok &= pattern[0] && pattern[1];
+        //
+        // subgraph_reverse uses random access to the arguments
+        CPPAD_TESTVECTOR(bool) select_domain(2);
+        select_domain[0] = true;
+        select_domain[1] = true;
+        f.subgraph_reverse(select_domain);
+        CPPAD_TESTVECTOR(size_t) col;
+        f.subgraph_reverse(1, 0, col, dw);
+        check = double(N) * x[1];
+        ok &= col.size() == 2;
+        ok &= CppAD::NearEqual(dw[col[0]], check, eps, eps);
+        f.clear_subgraph();
+    }
+    // undo the packing
+    f.pack_arg(false);
+    ok &= f.size_op_arg_byte() == sizeof(CPPAD_TAPE_ADDR_TYPE);
+    CPPAD_TESTVECTOR(double) x(2), y(1);
+    x[0] = 3.0;
+    x[1] = 4.0;
+    y    = f.Forward(0, x);
+    double sum_k = double(N * (N - 1) / 2);
+    double check = double(N) * x[0] * x[1] + sum_k * x[1];
+    ok &= CppAD::NearEqual(y[0], check, eps, eps);
+    //
+    return ok;
+}
+
+// argument indices use the smallest type that can represent them
+bool adfun_arg_byte(void)
+{   bool ok = true;
+    size_t addr_byte = sizeof(CPPAD_TAPE_ADDR_TYPE);
+    //
+    // all argument indices are less than 2^16
+    size_t N        = 10;
+    size_t arg_byte = std::min(sizeof(unsigned short), addr_byte);
+    ok &= adfun_arg_byte_case(N, arg_byte);
+    //
+    // variable indices are greater than 2^16
+    if( sizeof(unsigned int) <= addr_byte )
+    {   N        = 40000;
+        arg_byte = sizeof(unsigned int);
+        ok &= adfun_arg_byte_case(N, arg_byte);
+    }
+    return ok;
+}
+
 } // END_EMPTY_NAMESPACE
 
 bool adfun(void)
 {   bool ok = true;
     ok     &= adfun_empty();
     ok     &= adfun_swap();
+    ok     &= adfun_arg_byte();
     return ok;
 }
@@ -1,5 +1,5 @@
 /* --------------------------------------------------------------------------
-CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-20 Bradley M. Bell
+CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-21 Bradley M. Bell
 
 CppAD is distributed under the terms of the
              Eclipse Public License Version 2.0.
@@ -42,6 +42,13 @@ namespace {
         thread_all_[thread_num].x.resize(1);
         thread_all_[thread_num].x[0]=static_cast<double>(thread_num);
     }
+    // function that frees the memory allocated by a different thread
+    void remote_worker(void)
+    {
+        size_t thread_num = thread_number();
+        size_t other      = (thread_num + 1) % NUMBER_THREADS;
+        thread_all_[other].x.clear();
+    }
 }
 
 // Test routine called by the master thread (thread_num = 0).
@@ -50,6 +57,10 @@ bool alloc_openmp(void)
 
     int num_threads = NUMBER_THREADS;
 
+    // use this many threads even if there are fewer processors
+    omp_set_dynamic(0);
+    omp_set_num_threads(num_threads);
+
     // call setup for using thread_alloc in parallel mode.
     thread_alloc::parallel_setup(
         size_t(num_threads), in_parallel, thread_number
@@ -74,5 +85,35 @@ bool alloc_openmp(void)
         thread_all_[thread_num].x.clear();
     }
 
+    // memory in use by each thread before the remote free test
+    size_t inuse_before[NUMBER_THREADS];
+    for(thread_num = 0; thread_num < num_threads; thread_num++)
+        inuse_before[thread_num] = thread_alloc::inuse(size_t(thread_num));
+
+    // test having each thread free memory allocated by a different thread
+    // while in parallel mode
+    thread_alloc::parallel_setup(
+        size_t(num_threads), in_parallel, thread_number
+    );
+    thread_alloc::hold_memory(true);
+# pragma omp parallel for
+    for(thread_num = 0; thread_num < num_threads; thread_num++)
+        worker();
+// end omp parallel for
+# pragma omp parallel for
+    for(thread_num = 0; thread_num < num_threads; thread_num++)
+        remote_worker();
+// end omp parallel for
+    thread_alloc::parallel_setup(1, nullptr, nullptr);
+    thread_alloc::hold_memory(false);
+
+    // the remote frees are processed by inuse
+    for(thread_num = 0; thread_num < num_threads; thread_num++)
+    {   size_t thread = size_t(thread_num);
+        ok &= thread_alloc::inuse(thread) == inuse_before[thread_num];
+        thread_alloc::free_available(thread);
+        ok &= thread_alloc::available(thread) == 0;
+    }
+
     return ok;
 }
@@ -74,6 +74,7 @@ extern bool Forward(void);
 extern bool FromBase(void);
 extern bool FunCheck(void);
 extern bool cpp_graph(void);
+extern bool hes_dir(void);
 extern bool hes_sparsity(void);
 extern bool ipopt_solve(void);
 extern bool jacobian(void);
@@ -192,6 +193,7 @@ int main(void)
     Run( FromBase,        "FromBase"       );
     Run( FunCheck,        "FunCheck"       );
     Run( cpp_graph,       "cpp_graph"      );
+    Run( hes_dir,         "hes_dir"        );
     Run( hes_sparsity,    "hes_sparsity"   );
     Run( jacobian,        "jacobian"       );
     Run( json_graph,      "json_graph"     );
@@ -0,0 +1,151 @@
+/* --------------------------------------------------------------------------
+CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-21 Bradley M. Bell
+
+CppAD is distributed under the terms of the
+             Eclipse Public License Version 2.0.
+
+This Source Code may also be made available under the following
+Secondary License when the conditions for such availability set forth
+in the Eclipse Public License, Version 2.0 are satisfied:
+      GNU General Public License, Version 2.0 or later.
+---------------------------------------------------------------------------- */
+// Test hes_dir for operators that example/general/hes_dir.cpp does not use.
+
+# include <cppad/cppad.hpp>
+
+namespace {
+    using CppAD::AD;
+    using CppAD::vector;
+    using CppAD::NearEqual;
+    // -----------------------------------------------------------------------
+    // check hes_dir against Forward(1, v_ell) followed by Reverse(2, w)
+    bool check_hes_dir(CppAD::ADFun<double>& f, const vector<double>& x)
+    {   bool ok = true;
+        double eps99 = 99.0 * std::numeric_limits<double>::epsilon();
+        size_t n = f.Domain();
+        size_t m = f.Range();
+        //
+        vector<double> w(m);
+        for(size_t i = 0; i < m; ++i)
+            w[i] = double(i + 1);
+        //
+        size_t r = 3;
+        vector<double> v(n * r), hv(n * r);
+        for(size_t j = 0; j < n; ++j)
+            for(size_t ell = 0; ell < r; ++ell)
+                v[j * r + ell] = double(j + ell + 1) / double(n + r);
+        //
+        f.Forward(0, x);
+        f.hes_dir(r, w, v, hv);
+        //
+        vector<double> v_ell(n), dw(2 * n);
+        for(size_t ell = 0; ell < r; ++ell)
+        {   for(size_t j = 0; j < n; ++j)
+                v_ell[j] = v[j * r + ell];
+            f.Forward(1, v_ell);
+            dw = f.Reverse(2, w);
+            for(size_t j = 0; j < n; ++j)
+            {   double check = dw[j * 2 + 1];
+                ok &= NearEqual(hv[j * r + ell], check, eps99, eps99);
+            }
+        }
+        return ok;
+    }
+    // -----------------------------------------------------------------------
+    // atomic function used by test_atomic
+    void g_algo(const vector< AD<double> >& au, vector< AD<double> >& av)
+    {   av[0] = au[0] * au[1];
+        av[1] = sin( au[0] ) + exp( au[1] );
+    }
+    // operators used inside and outside of an atomic function
+    bool test_atomic(void)
+    {   bool ok = true;
+        //
+        // create the atomic function
+        vector< AD<double> > au(2), av(2);
+        au[0] = 1.0;
+        au[1] = 2.0;
+        CppAD::Independent(au);
+        g_algo(au, av);
+        CppAD::ADFun<double> g_fun(au, av);
+        bool internal_bool    = false;
+        bool use_hes_sparsity = true;
+        bool use_base2ad      = false;
+        bool use_in_parallel  = false;
+        CppAD::chkpoint_two<double> g_check(g_fun, "g_check",
+            internal_bool, use_hes_sparsity, use_base2ad, use_in_parallel
+        );
+        //
+        // record f
+        size_t n = 3;
+        vector< AD<double> > ax(n), ay(2);
+        for(size_t j = 0; j < n; ++j)
+            ax[j] = double(j + 1);
+        CppAD::Independent(ax);
+        //
+        // variable and parameter arguments to the atomic function
+        au[0] = ax[0] * ax[2];
+        au[1] = 2.0;
+        g_check(au, av);
+        ay[0] = av[0] * av[1] + ax[1];
+        //
+        au[0] = ax[1];
+        au[1] = ax[2] / ax[0];
+        g_check(au, av);
+        ay[1] = av[1] * ax[0];
+        CppAD::ADFun<double> f(ax, ay);
+        //
+        vector<double> x(n);
+        x[0] = 0.3;
+        x[1] = 0.5;
+        x[2] = 0.7;
+        ok &= check_hes_dir(f, x);
+        //
+        return ok;
+    }
+    // -----------------------------------------------------------------------
+    // VecAD, conditional expressions, pow, and cumulative summation
+    bool test_other(void)
+    {   bool ok = true;
+        //
+        size_t n = 3;
+        vector< AD<double> > ax(n), ay(2);
+        for(size_t j = 0; j < n; ++j)
+            ax[j] = double(j + 1);
+        CppAD::Independent(ax);
+        //
+        CppAD::VecAD<double> av(2);
+        AD<double> zero(0.0), one(1.0);
+        av[zero] = ax[0] * ax[1];
+        av[one]  = ax[2];
+        AD<double> index = CondExpLt(ax[0], ax[1], zero, one);
+        AD<double> sum   = ax[0] + ax[1] - ax[2] + av[index] * av[zero];
+        //
+        ay[0] = pow(ax[0], ax[1]) + sum * sum;
+        ay[1] = CondExpGt(ax[2], ax[0], ax[2] * ax[2] * ax[1], cos(ax[0]));
+        CppAD::ADFun<double> f(ax, ay);
+        //
+        vector<double> x(n);
+        x[0] = 0.3;
+        x[1] = 0.5;
+        x[2] = 0.7;
+        ok &= check_hes_dir(f, x);
+        //
+        // other branch of the conditional expressions
+        x[0] = 0.9;
+        ok &= check_hes_dir(f, x);
+        //
+        // optimization creates cumulative summation operators
+        f.optimize();
+        ok &= check_hes_dir(f, x);
+        //
+        return ok;
+    }
+}
+
+bool hes_dir(void)
+{   bool ok = true;
+    ok     &= test_atomic();
+    ok     &= test_other();
+    return ok;
+}
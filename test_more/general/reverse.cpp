@@ -495,6 +495,123 @@ bool duplicate_dependent_var(void)
     return ok;
 }
 
+// ---------------------------------------------------------------------------
+// check Reverse(1, r, w) against Reverse(1, w) for each direction
+bool reverse_dir_check(CppAD::ADFun<double>& f, const CppAD::vector<double>& x)
+{   bool ok = true;
+    using CppAD::NearEqual;
+    double eps99 = 99.0 * std::numeric_limits<double>::epsilon();
+    size_t n = f.Domain();
+    size_t m = f.Range();
+    size_t r = 3;
+    //
+    f.Forward(0, x);
+    CppAD::vector<double> w(m * r), dw(n * r), w_one(m), dw_one(n);
+    for(size_t i = 0; i < m; ++i)
+        for(size_t ell = 0; ell < r; ++ell)
+            w[i * r + ell] = double(i + 1) / double(ell + 1);
+    // direction one has a zero weight for the first dependent variable
+    w[0 * r + 1] = 0.0;
+    dw = f.Reverse(1, r, w);
+    for(size_t ell = 0; ell < r; ++ell)
+    {   for(size_t i = 0; i < m; ++i)
+            w_one[i] = w[i * r + ell];
+        dw_one = f.Reverse(1, w_one);
+        for(size_t j = 0; j < n; ++j)
+            ok &= NearEqual(dw[j * r + ell], dw_one[j], eps99, eps99);
+    }
+    return ok;
+}
+double round_off(const double& x)
+{   return std::floor(x + 0.5); }
+CPPAD_DISCRETE_FUNCTION(double, round_off)
+//
+bool reverse_dir(void)
+{   bool ok = true;
+    using CppAD::AD;
+    //
+    // g(u) = [ u_0 * u_1 , sin(u_0) ] used as an atomic function
+    CPPAD_TESTVECTOR( AD<double> ) au(2), av(2);
+    au[0] = 0.5;
+    au[1] = 0.7;
+    CppAD::Independent(au);
+    av[0] = au[0] * au[1];
+    av[1] = sin( au[0] );
+    CppAD::ADFun<double> g(au, av);
+    bool internal_bool    = false;
+    bool use_hes_sparsity = false;
+    bool use_base2ad      = false;
+    bool use_in_parallel  = false;
+    CppAD::chkpoint_two<double> g_atom(g, "g_atom",
+        internal_bool, use_hes_sparsity, use_base2ad, use_in_parallel
+    );
+    //
+    size_t n = 3;
+    CPPAD_TESTVECTOR( AD<double> ) ax(n);
+    ax[0] = 0.3;
+    ax[1] = 0.4;
+    ax[2] = 0.5;
+    CppAD::Independent(ax);
+    //
+    CppAD::vector< AD<double> > ay;
+    AD<double> two(2.0);
+    for(size_t j = 0; j < n; ++j)
+    {   AD<double> ak = ax[j];
+        ay.push_back( abs(ak) + acos(ak) + acosh(ak + 1.0) + asin(ak) );
+        ay.push_back( asinh(ak) + atan(ak) + atanh(ak) + cos(ak) );
+        ay.push_back( cosh(ak) + erf(ak) + erfc(ak) + exp(ak) );
+        ay.push_back( expm1(ak) + log(ak) + log1p(ak) - ak + sign(ak) );
+        ay.push_back( sin(ak) + sinh(ak) + sqrt(ak) + tan(ak) + tanh(ak) );
+    }
+    // binary operators with variable and parameter arguments
+    ay.push_back( ax[0] + ax[1] + (two + ax[2]) + (ax[0] + two) );
+    ay.push_back( ax[0] - ax[1] - (two - ax[2]) + (ax[0] - two) );
+    ay.push_back( ax[0] * ax[1] * (two * ax[2]) + ax[0] * ax[0] );
+    ay.push_back( ax[0] / ax[1] + two / ax[2] + ax[0] / two );
+    ay.push_back( pow(ax[0], ax[1]) + pow(two, ax[2]) + pow(ax[0], two) );
+    ay.push_back(
+        azmul(ax[0], ax[1]) + azmul(two, ax[2]) + azmul(ax[0], two)
+    );
+    // conditional expressions (conditional skip after optimization)
+    ay.push_back( CppAD::CondExpLt(ax[0], ax[1], ax[0] * ax[2], sin(ax[2])) );
+    ay.push_back( CppAD::CondExpGt(ax[0], ax[1], ax[0] * ax[2], cos(ax[2])) );
+    // cumulative summation (after optimization)
+    ay.push_back( ax[0] + ax[1] - ax[2] + 1.0 );
+    // discrete function
+    ay.push_back( round_off(ax[0]) * ax[1] );
+    // VecAD load of a variable
+    CppAD::VecAD<double> av_vec(2);
+    AD<double> zero(0), one(1);
+    av_vec[zero] = ax[1] * ax[2];
+    av_vec[one]  = ax[2] + 1.0;
+    AD<double> index = CppAD::CondExpLt(ax[0], ax[1], zero, one);
+    ay.push_back( av_vec[index] * ax[0] + av_vec[one] );
+    // atomic function
+    au[0] = ax[0];
+    au[1] = ax[2];
+    g_atom(au, av);
+    ay.push_back( av[0] );
+    ay.push_back( av[1] * 4.0 );
+    //
+    CppAD::ADFun<double> f(ax, ay);
+    //
+    CppAD::vector<double> x(n);
+    x[0] = 0.3;
+    x[1] = 0.4;
+    x[2] = 0.5;
+    ok &= reverse_dir_check(f, x);
+    // other branch of conditional expressions
+    x[0] = 0.45;
+    ok &= reverse_dir_check(f, x);
+    //
+    f.optimize();
+    ok &= reverse_dir_check(f, x);
+    x[0] = 0.3;
+    ok &= reverse_dir_check(f, x);
+    //
+    return ok;
+}
+
 } // End empty namespace
 
 # include <vector>
@@ -504,6 +621,7 @@ bool reverse(void)
     ok &= reverse_one();
     ok &= reverse_mul();
     ok &= duplicate_dependent_var();
+    ok &= reverse_dir();
 
     ok &= reverse_any_cases< CppAD::vector  <double> >();
     ok &= reverse_any_cases< std::vector    <double> >();
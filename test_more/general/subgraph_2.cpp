@@ -56,10 +56,86 @@ bool test_subgraph_subset(void)
     return ok;
 }
 
+bool test_subgraph_work(void)
+{   bool ok = true;
+    using CppAD::AD;
+    using CppAD::NearEqual;
+    using CppAD::vector;
+    typedef vector<double> d_vector;
+    typedef vector<size_t> s_vector;
+    typedef vector<bool>   b_vector;
+    double eps99 = 99.0 * std::numeric_limits<double>::epsilon();
+    //
+    size_t n = 4, m = 4;
+    d_vector x(n);
+    vector< AD<double> > ax(n), ay(m);
+    for(size_t j = 0; j < n; ++j)
+        ax[j] = x[j] = double(j + 1) / 4.0;
+    CppAD::Independent(ax);
+    for(size_t i = 0; i < m; ++i)
+    {   ay[i] = sin( ax[i] );
+        if( i + 1 < n )
+            ay[i] += ax[i] * ax[i + 1];
+        ay[i] = CondExpLt(ax[0], ax[n-1], ay[i], exp( ay[i] ) );
+    }
+    CppAD::ADFun<double> f(ax, ay);
+    f.Forward(0, x);
+    //
+    // check the derivative of row ell in dw at the columns in col
+    d_vector check(m * n);
+    check = f.Jacobian(x);
+    //
+    b_vector select_domain(n);
+    for(size_t j = 0; j < n; ++j)
+        select_domain[j] = j != 1;
+    //
+    // two passes to check that the workspaces are updated
+    // after the domain is selected a second time
+    CppAD::subgraph_work<double> work_1, work_2;
+    for(size_t pass = 0; pass < 2; ++pass)
+    {   f.subgraph_reverse(select_domain);
+        //
+        // compute rows in an order that interleaves the workspaces
+        // (row 0 uses the workspace in f)
+        size_t q = 1;
+        s_vector col;
+        d_vector dw;
+        for(size_t k = 0; k < 2 * m - 1; ++k)
+        {   size_t ell;
+            if( k == 0 )
+            {   ell = 0;
+                f.subgraph_reverse(q, ell, col, dw);
+            }
+            else if( k % 2 == 1 )
+            {   ell = (k + 1) / 2;
+                f.subgraph_reverse(q, ell, col, dw, work_1);
+            }
+            else
+            {   ell = m - k / 2;
+                f.subgraph_reverse(q, ell, col, dw, work_2);
+            }
+            // derivatives that are not in col are zero
+            d_vector dw_full(n);
+            for(size_t j = 0; j < n; ++j)
+                dw_full[j] = 0.0;
+            for(size_t c = 0; c < col.size(); ++c)
+            {   size_t j = col[c];
+                ok &= select_domain[j];
+                dw_full[j] = dw[j];
+            }
+            for(size_t j = 0; j < n; ++j) if( select_domain[j] )
+                ok &= NearEqual(dw_full[j], check[ell * n + j], eps99, eps99);
+        }
+    }
+    //
+    return ok;
+}
+
 } // END_EMPTY_NAMESPACE
 
 bool subgraph_2(void)
 {   bool ok = true;
     ok &= test_subgraph_subset();
+    ok &= test_subgraph_work();
     return ok;
 }